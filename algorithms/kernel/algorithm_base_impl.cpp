@@ -155,6 +155,30 @@ void setHostApp(const services::SharedPtr<services::HostAppIface>& pHostApp, daa
         ptr->setExtension(algorithms::internal::ArgumentStorage::hostApp, pHostApp);
 }
 
+/* Returns the state of the prepared computation of the algorithm or NULL if the mode is disabled.
+ * The state inherited by a copy of the algorithm together with its input is replaced with a new one */
+algorithms::internal::PreparedComputeState* getPreparedState(algorithms::internal::ArgumentStorage& storage, const void* owner)
+{
+    auto ext = storage.getExtension(algorithms::internal::ArgumentStorage::preparedCompute);
+    if(!ext)
+        return NULL;
+    DAAL_ASSERT(dynamic_cast<algorithms::internal::PreparedComputeState*>(ext.get()));
+    algorithms::internal::PreparedComputeState* state = static_cast<algorithms::internal::PreparedComputeState*>(ext.get());
+    if(state->isOwnedBy(owner))
+        return state;
+    state = new algorithms::internal::PreparedComputeState(owner);
+    storage.setExtension(algorithms::internal::ArgumentStorage::preparedCompute, services::SharedPtr<Base>(state));
+    return state;
+}
+
+void setPreparedState(algorithms::internal::ArgumentStorage& storage, const void* owner, bool flag)
+{
+    services::SharedPtr<Base> state;
+    if(flag)
+        state.reset(new algorithms::internal::PreparedComputeState(owner));
+    storage.setExtension(algorithms::internal::ArgumentStorage::preparedCompute, state);
+}
+
 }//namespace internal
 }//namespace services
 
@@ -235,6 +259,9 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
 {
     this->setParameter();
 
+    internal::ArgumentStorage* inputStorage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    internal::PreparedComputeState* prepared = inputStorage ? services::internal::getPreparedState(*inputStorage, this) : NULL;
+
     if(this->isChecksEnabled())
     {
         services::Status _s = this->checkComputeParams();
@@ -242,7 +269,10 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
             return _s;
     }
 
-    services::Status s = this->allocateResultMemory();
+    /* Result of the prepared algorithm is reused while its inputs keep the dimensions.
+     * Otherwise it is reallocated unless it still fits the new inputs, e.g. was resized by the user */
+    const bool reallocate = prepared && _res && !prepared->matches(*inputStorage) && !this->checkResult();
+    services::Status s = reallocate ? this->allocateResult() : this->allocateResultMemory();
     DAAL_CHECK_MALLOC(s);
 
     this->_ac->setArguments(this->_in, this->_res, this->_par);
@@ -251,7 +281,11 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
     {
         s = this->checkResult();
         if(!s)
+        {
+            if(prepared)
+                prepared->invalidate();
             return s;
+        }
     }
 
     s = setupCompute();
@@ -273,12 +307,33 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
         }
     }
 
-    if(resetFlag)
+    if(resetFlag && !prepared)
         s |= resetCompute();
     _res = this->_ac->getResult();
+
+    if(prepared)
+    {
+        if(s)
+            prepared->update(*inputStorage);
+        else
+            prepared->invalidate();
+    }
     return s;
 }
 
+void AlgorithmImpl<batch>::enablePreparedCompute(bool flag)
+{
+    internal::ArgumentStorage* inputStorage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    if(!inputStorage)
+        return;
+    const bool wasEnabled = (services::internal::getPreparedState(*inputStorage, this) != NULL);
+    if(flag == wasEnabled)
+        return;
+    services::internal::setPreparedState(*inputStorage, this, flag);
+    if(!flag && resetFlag)
+        resetCompute();
+}
+
 services::HostAppIfacePtr AlgorithmImpl<batch>::hostApp()
 {
     return this->_in ? services::internal::getHostApp(*this->_in) : services::HostAppIfacePtr();
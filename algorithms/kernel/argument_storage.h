@@ -23,6 +23,7 @@
 #ifndef __ARGUMENT_STORAGE_H__
 #define __ARGUMENT_STORAGE_H__
 #include "data_collection.h"
+#include "numeric_table.h"
 #include "service_defines.h"
 
 namespace daal
@@ -37,7 +38,8 @@ class ArgumentStorage : public data_management::DataCollection
 public:
     enum Extension
     {
-        hostApp = 0
+        hostApp = 0,
+        preparedCompute = 1
     };
     DAAL_CAST_OPERATOR(ArgumentStorage);
     ArgumentStorage(const size_t n) : data_management::DataCollection(n) {}
@@ -53,6 +55,105 @@ protected:
     BasePtrCollection _extensions;
 };
 
+/**
+ * State of the prepared computation of an algorithm in the batch processing mode.
+ * Kept as an extension of the input argument storage of the algorithm.
+ * Keeps the references to the inputs of the last successful computation and
+ * the dimensions of its numeric tables
+ */
+class PreparedComputeState : public Base
+{
+public:
+    static const size_t maxInputs = 16;
+
+    PreparedComputeState(const void* owner) : _nInputs(0), _owner(owner), _isValid(false) {}
+
+    /* Returns true if the state was created by the given algorithm object and not inherited by its copy */
+    bool isOwnedBy(const void* owner) const { return _owner == owner; }
+
+    /* Returns true if the inputs are the tables of the same dimensions as at the last computation
+     * and the other inputs are the same objects */
+    bool matches(const data_management::DataCollection& input) const
+    {
+        if(!_isValid || input.size() != _nInputs)
+            return false;
+        for(size_t i = 0; i < _nInputs; ++i)
+        {
+            const data_management::NumericTable* nt = findTable(input[i], i);
+            if(!nt)
+            {
+                if(_shapes[i].table || input[i].get() != _inputs[i].get())
+                    return false;
+                continue;
+            }
+            if(nt->getNumberOfRows() != _shapes[i].nRows || nt->getNumberOfColumns() != _shapes[i].nCols)
+                return false;
+        }
+        return true;
+    }
+
+    /* Remembers the inputs of the successful computation. Inputs with too many arguments are never matched */
+    void update(const data_management::DataCollection& input)
+    {
+        _isValid = (input.size() <= maxInputs);
+        if(!_isValid)
+        {
+            clearInputs();
+            return;
+        }
+        Shape shapes[maxInputs];
+        for(size_t i = 0; i < input.size(); ++i)
+        {
+            data_management::NumericTable* nt = findTable(input[i], i);
+            shapes[i].table = nt;
+            shapes[i].nRows = nt ? nt->getNumberOfRows() : 0;
+            shapes[i].nCols = nt ? nt->getNumberOfColumns() : 0;
+        }
+        clearInputs();
+        for(size_t i = 0; i < input.size(); ++i)
+        {
+            _inputs[i] = input[i];
+            _shapes[i] = shapes[i];
+        }
+        _nInputs = input.size();
+    }
+
+    void invalidate()
+    {
+        clearInputs();
+        _isValid = false;
+    }
+
+private:
+    /* Returns the numeric table behind the input argument. The type of the argument is resolved
+     * only if it is not the object of the last computation, which is referenced by the state */
+    data_management::NumericTable* findTable(const data_management::SerializationIfacePtr& value, size_t i) const
+    {
+        if(i < _nInputs && value.get() == _inputs[i].get())
+            return _shapes[i].table;
+        return dynamic_cast<data_management::NumericTable*>(value.get());
+    }
+
+    void clearInputs()
+    {
+        for(size_t i = 0; i < _nInputs; ++i)
+            _inputs[i].reset();
+        _nInputs = 0;
+    }
+
+    struct Shape
+    {
+        data_management::NumericTable* table;
+        size_t nRows;
+        size_t nCols;
+    };
+    data_management::SerializationIfacePtr _inputs[maxInputs];
+    Shape _shapes[maxInputs];
+    size_t _nInputs;
+    const void* _owner;
+    bool _isValid;
+};
+
 }// namespace internal
 }// namespace algorithms
 }// namespace daal
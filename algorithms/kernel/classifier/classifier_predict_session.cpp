@@ -0,0 +1,62 @@
+/* file: classifier_predict_session.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low-latency prediction session of the classification algorithms.
+//--
+*/
+
+#include "algorithms/classifier/classifier_predict_session.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace prediction
+{
+namespace interface2
+{
+
+Session::Session(const Batch &algorithm, size_t nFeatures, size_t maxRows) :
+    algorithms::PredictionSession(nFeatures, 1, maxRows), _algorithm(algorithm.clone())
+{
+    DAAL_CHECK_COND_ERROR(_algorithm.get(), _status, services::ErrorMemoryAllocationFailed);
+    if(!_status)
+        return;
+    _algorithm->parameter().resultsToEvaluate = classifier::computeClassLabels;
+    _status |= initialize(_algorithm.get());
+}
+
+services::Status Session::bind(const data_management::NumericTablePtr &data, const data_management::NumericTablePtr &prediction)
+{
+    DAAL_CHECK(_algorithm->getInput()->get(classifier::prediction::model), services::ErrorNullModel);
+    _algorithm->getInput()->set(classifier::prediction::data, data);
+
+    ResultPtr result(new Result());
+    DAAL_CHECK_MALLOC(result.get());
+    result->set(classifier::prediction::prediction, prediction);
+    return _algorithm->setResult(result);
+}
+
+} // namespace interface2
+} // namespace prediction
+} // namespace classifier
+} // namespace algorithms
+} // namespace daal
@@ -34,6 +34,7 @@
 #include "service_math.h"
 #include "service_kernel_math.h"
 #include "service_error_handling.h"
+#include "service_sort.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -51,6 +52,7 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE 8
 #define __DBSCAN_DEFAULT_VECTOR_SIZE 8
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 8
+#define __DBSCAN_GRID_MAX_DIMENSION 4
 
 template <typename T, CpuType cpu>
 class Queue
@@ -601,6 +603,342 @@ private:
     FPType _p;
 };
 
+template<typename FPType, CpuType cpu>
+class NeighborhoodEngine<gridDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+    struct CellOfObservation
+    {
+        size_t cell;
+        size_t index;
+    };
+
+public:
+
+    NeighborhoodEngine(const NumericTable* inTable, const NumericTable* outTable, const NumericTable* weights, FPType eps, FPType p) :
+        _inTable(inTable),
+        _outTable(outTable),
+        _weights(weights),
+        _eps(eps),
+        _p(p),
+        _allPairs(inTable, outTable, weights, eps, p),
+        _isBuilt(false),
+        _nCells(0) {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine &operator= (const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> *neighs, bool doReset = false)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, build());
+        if (!_nCells)
+        {
+            return _allPairs.queryFull(neighs, doReset);
+        }
+
+        SafeStatus safeStat;
+
+        const size_t inRows = _inTable->getNumberOfRows();
+        const size_t dim = _inTable->getNumberOfColumns();
+
+        size_t inBlockSize = 256;
+        size_t nInBlocks = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock)
+        {
+            size_t i1 = inBlock * inBlockSize;
+            size_t i2 = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            Vector<size_t, cpu> candidates;
+            for (size_t i = i1; i < i2; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i].reset();
+                }
+                DAAL_CHECK_STATUS_THR(queryObservation(&inData[(i - i1) * dim], candidates, neighs[i]));
+            }
+        });
+        s = safeStat.detach();
+
+        return s;
+    }
+
+    services::Status query(size_t *indices, size_t n, Neighborhood<FPType, cpu> *neighs, bool doReset = false)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, build());
+        if (!_nCells)
+        {
+            return _allPairs.query(indices, n, neighs, doReset);
+        }
+
+        SafeStatus safeStat;
+
+        daal::threader_for(n, n, [&](size_t i)
+        {
+            ReadRows<FPType, cpu> queryRows(const_cast<NumericTable *>(_inTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+
+            if (doReset)
+            {
+                neighs[i].reset();
+            }
+
+            Vector<size_t, cpu> candidates;
+            DAAL_CHECK_STATUS_THR(queryObservation(queryRows.get(), candidates, neighs[i]));
+        });
+        s = safeStat.detach();
+
+        return s;
+    }
+
+private:
+    /* Sorts the observations of the out table by the cells of the grid. The cells are numbered in the row-major order of their
+       coordinates, only the non-empty cells are stored. The grid is not built if the number of cells does not fit into size_t,
+       and for the data sets with many features, where the number of neighboring cells grows exponentially */
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+        _isBuilt = true;
+
+        const size_t outRows = _outTable->getNumberOfRows();
+        const size_t dim = _inTable->getNumberOfColumns();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= dim);
+
+        /* The neighbors of an observation differ from it by at most the radius in every feature, so they are in the same
+           or in the adjacent cells. The cell is slightly larger than the radius to absorb the rounding errors */
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+        const double radius = Math<double, cpu>::sSqrt((double)epsP);
+        _cellSize = radius * (1.0 + 1e-4);
+        if (outRows == 0 || dim == 0 || dim > __DBSCAN_GRID_MAX_DIMENSION || !(radius > 0.0))
+        {
+            return services::Status();
+        }
+
+        ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), 0, outRows);
+        DAAL_CHECK_BLOCK_STATUS(outDataRows);
+        const FPType * const outData = outDataRows.get();
+
+        double totalCells = 1.0;
+        for (size_t k = 0; k < dim; k++)
+        {
+            double lower = outData[k];
+            double upper = outData[k];
+            for (size_t j = 1; j < outRows; j++)
+            {
+                const double value = outData[j * outDim + k];
+                lower = (value < lower) ? value : lower;
+                upper = (value > upper) ? value : upper;
+            }
+            _lower[k] = lower;
+            totalCells *= (upper - lower) / _cellSize + 1.0;
+            if (!(totalCells < 4.0e18))
+            {
+                return services::Status();
+            }
+            _extent[k] = (size_t)((upper - lower) / _cellSize) + 1;
+            _stride[k] = (k == 0 ? 1 : _stride[k - 1] * _extent[k - 1]);
+        }
+
+        TArray<CellOfObservation, cpu> cellOfObservationArray(outRows);
+        CellOfObservation * const cellOfObservation = cellOfObservationArray.get();
+        DAAL_CHECK_MALLOC(cellOfObservation);
+
+        size_t blockSize = 1024;
+        size_t nBlocks = outRows / blockSize + (outRows % blockSize > 0);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            size_t j1 = iBlock * blockSize;
+            size_t j2 = (iBlock + 1 == nBlocks ? outRows : j1 + blockSize);
+            for (size_t j = j1; j < j2; j++)
+            {
+                size_t cell = 0;
+                for (size_t k = 0; k < dim; k++)
+                {
+                    const double coordinate = ((double)outData[j * outDim + k] - _lower[k]) / _cellSize;
+                    cell += (coordinate >= 0.0 && coordinate < (double)_extent[k] ? (size_t)coordinate : _extent[k] - 1) * _stride[k];
+                }
+                cellOfObservation[j].cell = cell;
+                cellOfObservation[j].index = j;
+            }
+        });
+
+        daal::algorithms::internal::introSort<cpu>(cellOfObservation, cellOfObservation + outRows,
+                                                   [](const CellOfObservation & a, const CellOfObservation & b) -> bool
+        {
+            return (a.cell < b.cell) || (a.cell == b.cell && a.index < b.index);
+        } );
+
+        size_t nCells = 1;
+        for (size_t j = 1; j < outRows; j++)
+        {
+            nCells += (cellOfObservation[j].cell != cellOfObservation[j - 1].cell);
+        }
+
+        DAAL_CHECK_MALLOC(_cells.reset(nCells));
+        DAAL_CHECK_MALLOC(_cellStart.reset(nCells + 1));
+        DAAL_CHECK_MALLOC(_indices.reset(outRows));
+        DAAL_CHECK_MALLOC(_data.reset(outRows * dim));
+
+        size_t iCell = 0;
+        for (size_t j = 0; j < outRows; j++)
+        {
+            if (j == 0 || cellOfObservation[j].cell != cellOfObservation[j - 1].cell)
+            {
+                _cells[iCell] = cellOfObservation[j].cell;
+                _cellStart[iCell] = j;
+                iCell++;
+            }
+            _indices[j] = cellOfObservation[j].index;
+        }
+        _cellStart[nCells] = outRows;
+
+        /* The observations are copied in the order of cells, so the observations of a cell are contiguous */
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            size_t j1 = iBlock * blockSize;
+            size_t j2 = (iBlock + 1 == nBlocks ? outRows : j1 + blockSize);
+            for (size_t j = j1; j < j2; j++)
+            {
+                const FPType * const observation = &outData[_indices[j] * outDim];
+                for (size_t k = 0; k < dim; k++)
+                {
+                    _data[j * dim + k] = observation[k];
+                }
+            }
+        });
+
+        if (_weights)
+        {
+            ReadColumns<FPType, cpu> weightsColumn(const_cast<NumericTable *>(_weights), 0, 0, outRows);
+            DAAL_CHECK_BLOCK_STATUS(weightsColumn);
+            DAAL_CHECK_MALLOC(_weightValues.reset(outRows));
+            services::daal_memcpy_s(_weightValues.get(), outRows * sizeof(FPType), weightsColumn.get(), outRows * sizeof(FPType));
+        }
+
+        _nCells = nCells;
+        return services::Status();
+    }
+
+    /* Checks the observations of the cells adjacent to the cell of the query. The cells that differ in the first coordinate only
+       are consecutive, so they are found with one binary search. The neighbors are added in the ascending order of indices,
+       as the default method adds them */
+    services::Status queryObservation(const FPType * query, Vector<size_t, cpu> & candidates, Neighborhood<FPType, cpu> & neigh) const
+    {
+        const size_t dim = _inTable->getNumberOfColumns();
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        size_t first[__DBSCAN_GRID_MAX_DIMENSION];
+        size_t last[__DBSCAN_GRID_MAX_DIMENSION];
+        size_t current[__DBSCAN_GRID_MAX_DIMENSION];
+        for (size_t k = 0; k < dim; k++)
+        {
+            const double coordinate = -Math<double, cpu>::sCeil(-((double)query[k] - _lower[k]) / _cellSize);
+            if (!(coordinate >= -1.0 && coordinate <= (double)_extent[k]))
+            {
+                return services::Status();
+            }
+            first[k] = (coordinate >= 1.0 ? (size_t)coordinate - 1 : 0);
+            last[k] = (coordinate + 1.0 < (double)_extent[k] ? (size_t)(coordinate + 1.0) : _extent[k] - 1);
+            if (first[k] > last[k])
+            {
+                return services::Status();
+            }
+            current[k] = first[k];
+        }
+
+        candidates.reset();
+        for (;;)
+        {
+            size_t cellFirst = first[0];
+            for (size_t k = 1; k < dim; k++)
+            {
+                cellFirst += current[k] * _stride[k];
+            }
+            const size_t cellLast = cellFirst + (last[0] - first[0]);
+
+            size_t lo = 0;
+            size_t hi = _nCells;
+            while (lo < hi)
+            {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (_cells[mid] < cellFirst) { lo = mid + 1; }
+                else { hi = mid; }
+            }
+            for (size_t iCell = lo; iCell < _nCells && _cells[iCell] <= cellLast; iCell++)
+            {
+                for (size_t j = _cellStart[iCell]; j < _cellStart[iCell + 1]; j++)
+                {
+                    FPType dist = distancePow2<FPType, cpu>(query, &_data[j * dim], dim);
+                    if (dist <= epsP)
+                    {
+                        DAAL_CHECK_STATUS_VAR(candidates.push_back(_indices[j]));
+                    }
+                }
+            }
+
+            size_t k = 1;
+            for (; k < dim; k++)
+            {
+                if (current[k] < last[k])
+                {
+                    current[k]++;
+                    break;
+                }
+                current[k] = first[k];
+            }
+            if (k >= dim)
+            {
+                break;
+            }
+        }
+
+        size_t * const found = candidates.ptr();
+        const size_t nFound = candidates.size();
+        daal::algorithms::internal::introSort<cpu>(found, found + nFound, [](size_t a, size_t b) -> bool { return a < b; });
+        for (size_t j = 0; j < nFound; j++)
+        {
+            DAAL_CHECK_STATUS_VAR(neigh.add(found[j], (_weights ? _weightValues[found[j]] : (FPType)1.0)));
+        }
+
+        return services::Status();
+    }
+
+    const NumericTable *_inTable;
+    const NumericTable *_outTable;
+    const NumericTable *_weights;
+
+    FPType _eps;
+    FPType _p;
+
+    NeighborhoodEngine<defaultDense, FPType, cpu> _allPairs;
+
+    bool _isBuilt;
+    size_t _nCells;
+    double _cellSize;
+    double _lower[__DBSCAN_GRID_MAX_DIMENSION];
+    size_t _extent[__DBSCAN_GRID_MAX_DIMENSION];
+    size_t _stride[__DBSCAN_GRID_MAX_DIMENSION];
+    TArray<size_t, cpu> _cells;
+    TArray<size_t, cpu> _cellStart;
+    TArray<size_t, cpu> _indices;
+    TArray<FPType, cpu> _data;
+    TArray<FPType, cpu> _weightValues;
+};
+
 template<typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType *values, size_t nElements, size_t k)
 {
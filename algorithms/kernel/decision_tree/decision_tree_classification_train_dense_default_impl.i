@@ -351,13 +351,15 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         if (parameter->splitCriterion == gini)
         {
             Gini<algorithmFPType, cpu> splitCriterion;
-            tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+            DAAL_CHECK_STATUS(status, tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
+                                                 parameter->minObservationsInLeafNodes));
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
         else
         {
             InfoGain<algorithmFPType, cpu> splitCriterion;
-            tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+            DAAL_CHECK_STATUS(status, tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
+                                                 parameter->minObservationsInLeafNodes));
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
     }
@@ -367,13 +369,15 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         if (parameter->splitCriterion == gini)
         {
             GiniWeighted<algorithmFPType, cpu> splitCriterion;
-            tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+            DAAL_CHECK_STATUS(status, tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
+                                                 parameter->minObservationsInLeafNodes));
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
         else
         {
             InfoGainWeighted<algorithmFPType, cpu> splitCriterion;
-            tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+            DAAL_CHECK_STATUS(status, tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
+                                                 parameter->minObservationsInLeafNodes));
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
         }
     }
@@ -194,18 +194,18 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::default
     DAAL_ASSERT(r->impl());
     r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
 
+    services::Status status;
     Tree<cpu, algorithmFPType, algorithmFPType> tree;
     if(w == nullptr)
     {
         MSE<algorithmFPType, cpu> splitCriterion;
-        tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        DAAL_CHECK_STATUS(status, tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes));
     }
     else
     {
         MSEWeighted<algorithmFPType, cpu> splitCriterion;
-        tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        DAAL_CHECK_STATUS(status, tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes));
     }
-    services::Status status;
     if (parameter->pruning == reducedErrorPruning)
     {
         DAAL_ASSERT(px);
@@ -32,6 +32,8 @@
 #include "service_math.h"
 #include "service_data_utils.h"
 #include "service_threading.h"
+#include "service_error_handling.h"
+#include "service_arrays.h"
 #include "data_management/features/defines.h"
 
 namespace daal
@@ -584,12 +586,14 @@ public:
 #include "decision_stump_train_impl.i"
 
     template <typename SplitCriterion, typename LeavesData>
-    void train(SplitCriterion & splitCriterion, LeavesData & leavesData, const NumericTable & x, const NumericTable & y, const NumericTable * w,
-               size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
+    services::Status train(SplitCriterion & splitCriterion, LeavesData & leavesData, const NumericTable & x, const NumericTable & y,
+                           const NumericTable * w, size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1,
+                           size_t minSplitObservations = 2)
     {
         if(maxTreeDepth == 2) // stump with weights
         {
-            return trainStump(splitCriterion, leavesData, x, y, w, numberOfClasses, minLeafObservations, minSplitObservations);
+            trainStump(splitCriterion, leavesData, x, y, w, numberOfClasses, minLeafObservations, minSplitObservations);
+            return services::Status();
         }
         const size_t xRowCount = x.getNumberOfRows();
         const size_t xColumnCount = x.getNumberOfColumns();
@@ -629,6 +633,7 @@ public:
         BlockDescriptor<IndependentVariableType> wBD;
         if (w) { const_cast<NumericTable *>(w)->getBlockOfColumnValues(0, 0, xRowCount, readOnly, wBD);}
 
+        services::Status status;
         const size_t depthLimit = (maxTreeDepth != 0) ? maxTreeDepth : static_cast<size_t>(-1);
         const TrainigContext<SplitCriterion, LeavesData> context{ splitCriterion, leavesData, x, y, w, featureTypesCache, dataStatistics,
                                                                   minLeafObservations, minSplitObservations, dx, yBD.getBlockPtr(),
@@ -639,7 +644,20 @@ public:
         }
         else
         {
-            internalTrainManyFeatures(context, indexes, xRowCount, pushBack(), totalDataStatistics, depthLimit);
+            size_t * sortedIndexes = presortIndexes(dx, xRowCount, xColumnCount);
+            bool * isLeft = sortedIndexes ? daal_alloc<bool>(xRowCount) : nullptr;
+            if (isLeft)
+            {
+                status = internalTrainLevelwise(context, sortedIndexes, isLeft, xRowCount, pushBack(), totalDataStatistics, depthLimit);
+            }
+            else
+            {
+                internalTrainManyFeatures(context, indexes, xRowCount, pushBack(), totalDataStatistics, depthLimit);
+            }
+            daal_free(isLeft);
+            daal_free(sortedIndexes);
+            isLeft        = nullptr;
+            sortedIndexes = nullptr;
         }
 
         if (w) { const_cast<NumericTable *>(w)->releaseBlockOfColumnValues(wBD); }
@@ -655,14 +673,15 @@ public:
         indexes = nullptr;
         dx      = nullptr;
         xBD     = nullptr;
+        return status;
     }
 
     template <typename SplitCriterion>
-    void train(SplitCriterion & splitCriterion, const NumericTable & x, const NumericTable & y, const NumericTable * w,
-               size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
+    services::Status train(SplitCriterion & splitCriterion, const NumericTable & x, const NumericTable & y, const NumericTable * w,
+                           size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
     {
         LeavesData<cpu, void> leavesData;
-        train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations);
+        return train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations);
     }
 
     template <typename Data>
@@ -765,6 +784,31 @@ protected:
         return indexes;
     }
 
+    // Returns the row indexes sorted by the values of every feature, the indexes of a feature are stored contiguously.
+    // Returns nullptr if the size of the indexes overflows size_t or the memory cannot be allocated
+    size_t * presortIndexes(const IndependentVariableType * const * dx, size_t rowCount, size_t featureCount)
+    {
+        if (featureCount != 0 && rowCount > static_cast<size_t>(-1) / sizeof(size_t) / featureCount) { return nullptr; }
+
+        size_t * const sortedIndexes = daal_alloc<size_t>(rowCount * featureCount);
+        if (!sortedIndexes) { return nullptr; }
+
+        daal::threader_for(featureCount, featureCount, [=](int featureIndex)
+        {
+            size_t * const first = &sortedIndexes[featureIndex * rowCount];
+            const IndependentVariableType * const column = dx[featureIndex];
+            for (size_t i = 0; i < rowCount; ++i)
+            {
+                first[i] = i;
+            }
+            introSort<cpu>(first, &first[rowCount], [column](size_t i1, size_t i2) -> bool
+            {
+                return column[i1] < column[i2];
+            });
+        } );
+        return sortedIndexes;
+    }
+
     void makeLeaf(TreeNodeIndex nodeIndex, DependentVariableType dependentVariable, LeavesDataIndex leavesDataIndex, double impurity, int count)
     {
         const TreeNodeType tmp(dependentVariable, leavesDataIndex, impurity, count);
@@ -1000,6 +1044,358 @@ protected:
                                   rightDataStatistics, depthLimit - 1);
     }
 
+    // Builds the tree level by level using the row indexes presorted by every feature.
+    // The rows of a node occupy the same range of the sorted indexes of every feature, so the split search does not sort,
+    // features are processed in parallel for all nodes of a level and the indexes of all nodes of a level
+    // are partitioned in one pass over the sorted indexes of every feature
+    template <typename SplitCriterion, typename LeavesData>
+    services::Status internalTrainLevelwise(const TrainigContext<SplitCriterion, LeavesData> & context, size_t * sortedIndexes, bool * isLeft,
+                                size_t rowCount, TreeNodeIndex nodeIndex, const typename SplitCriterion::DataStatistics & totalDataStatistics,
+                                size_t depthLimit)
+    {
+        typedef typename SplitCriterion::DataStatistics DataStatistics;
+        typedef typename SplitCriterion::ValueType ValueType;
+        typedef daal::internal::Math<ValueType, cpu> SplitCriterionMath;
+        typedef daal::services::internal::EpsilonVal<ValueType> SplitCriterionEpsilon;
+
+        DAAL_ASSERT(depthLimit != 0);
+        DAAL_ASSERT(context.minLeafSize >= 1);
+        DAAL_ASSERT(sortedIndexes);
+        DAAL_ASSERT(isLeft);
+        DAAL_ASSERT(context.dx);
+        DAAL_ASSERT(context.dy);
+        DAAL_ASSERT((context.w == nullptr) == (context.dw == nullptr));
+
+        struct Item
+        {
+            IndependentVariable x;
+            IndependentVariable w;
+            DependentVariable y;
+        };
+
+        // Node of the current level. Its rows are in the range [firstIndex, lastIndex) of the sorted indexes of every feature
+        struct LevelNode
+        {
+            DataStatistics totalDataStatistics;
+            size_t firstIndex;
+            size_t lastIndex;
+            TreeNodeIndex nodeIndex;
+
+            void moveFrom(LevelNode & src)
+            {
+                firstIndex = src.firstIndex;
+                lastIndex = src.lastIndex;
+                nodeIndex = src.nodeIndex;
+                totalDataStatistics.swap(src.totalDataStatistics);
+            }
+        };
+
+        // Best split of a node of the current level
+        struct NodeSplit
+        {
+            FeatureIndex featureIndex;
+            IndependentVariableType cutPoint;
+            ValueType splitCriterionValue;
+            size_t pointsAtLeft;
+            DataStatistics dataStatistics;
+            bool isLeaf;
+
+            NodeSplit() : featureIndex(0), pointsAtLeft(0), isLeaf(true) {}
+
+            bool isWorseThan(ValueType value, FeatureIndex index, ValueType epsilon) const
+            {
+                return (isLeaf || value < splitCriterionValue ||
+                        (SplitCriterionMath::sFabs(value - splitCriterionValue) <= epsilon && featureIndex > index));
+            }
+        };
+
+        struct Local
+        {
+            DAAL_NEW_DELETE();
+            SplitCriterion splitCriterion;
+            ValueType splitCriterionValue;
+            DataStatistics dataStatistics, bestCutPointDataStatistics;
+            Item * items;
+            TArray<NodeSplit, cpu> splits;
+
+            Local(const SplitCriterion & criterion, size_t itemCount, size_t nodeCount) : splitCriterion(criterion),
+                items(daal_alloc<Item>(itemCount)), splits(nodeCount) {}
+
+            ~Local()
+            {
+                daal_free(items);
+                items = nullptr;
+            }
+        };
+
+        const size_t featureCount = context.x.getNumberOfColumns();
+        const ValueType epsilon = SplitCriterionEpsilon::get();
+
+        TArray<LevelNode, cpu> level(1);
+        DAAL_CHECK_MALLOC(level.get());
+        size_t levelSize = 1;
+        level[0].totalDataStatistics = totalDataStatistics;
+        level[0].firstIndex = 0;
+        level[0].lastIndex = rowCount;
+        level[0].nodeIndex = nodeIndex;
+
+        for (size_t levelDepthLimit = depthLimit; levelSize != 0; --levelDepthLimit)
+        {
+            // Nodes which cannot be split become leaves.
+            TArray<LevelNode, cpu> activeArray(levelSize);
+            DAAL_CHECK_MALLOC(activeArray.get());
+            LevelNode * const active = activeArray.get();
+            size_t activeSize = 0;
+            size_t maxIndexCount = 0;
+            for (size_t k = 0; k < levelSize; ++k)
+            {
+                LevelNode & node = level[k];
+                const size_t indexCount = node.lastIndex - node.firstIndex;
+                typename SplitCriterion::DependentVariableType leafDependentVariableValue;
+                if (levelDepthLimit == 1 || indexCount < context.minSplitSize || indexCount < context.minLeafSize * 2)
+                {
+                    makeLeaf(node.nodeIndex, node.totalDataStatistics.getBestDependentVariableValue(), context.leavesData.add(node.totalDataStatistics),
+                             static_cast<double>(context.splitCriterion(node.totalDataStatistics, indexCount)), static_cast<int>(indexCount));
+                }
+                else if (node.totalDataStatistics.isPure(leafDependentVariableValue))
+                {
+                    makeLeaf(node.nodeIndex, leafDependentVariableValue, context.leavesData.add(node.totalDataStatistics),
+                             static_cast<double>(context.splitCriterion(node.totalDataStatistics, indexCount)), static_cast<int>(indexCount));
+                }
+                else
+                {
+                    active[activeSize++].moveFrom(node);
+                    maxIndexCount = max<cpu>(maxIndexCount, indexCount);
+                }
+            }
+            level.reset();
+            levelSize = 0;
+
+            if (activeSize == 0) { break; }
+
+            // Split search for all nodes of the level, features are processed in parallel.
+            SafeStatus safeStat;
+            daal::tls<Local *> localTLS([=, &context, &safeStat]()-> Local *
+            {
+                Local * const ptr = new Local(context.splitCriterion, maxIndexCount, activeSize);
+                if (!ptr || !ptr->items || !ptr->splits.get())
+                {
+                    delete ptr;
+                    safeStat.add(services::ErrorMemoryAllocationFailed);
+                    return nullptr;
+                }
+                return ptr;
+            } );
+
+            daal::threader_for(featureCount, featureCount, [=, &localTLS, &context](int featureIndex)
+            {
+                Local * const local = localTLS.local();
+                if (!local) { return; }
+                Item * const items = local->items;
+                const size_t * const sorted = &sortedIndexes[featureIndex * rowCount];
+                const IndependentVariableType * const dx = context.dx[featureIndex];
+
+                for (size_t k = 0; k < activeSize; ++k)
+                {
+                    const LevelNode & node = active[k];
+                    const size_t indexCount = node.lastIndex - node.firstIndex;
+                    const size_t * const rows = &sorted[node.firstIndex];
+
+                    for (size_t i = 0; i < indexCount; ++i)
+                    {
+                        items[i].x = dx[rows[i]];
+                        items[i].y = context.dy[rows[i]];
+                    }
+                    if (context.dw)
+                    {
+                        for (size_t i = 0; i < indexCount; ++i)
+                        {
+                            items[i].w = context.dw[rows[i]];
+                        }
+                    }
+                    DAAL_ASSERT(isSorted<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool
+                    {
+                        return v1.x < v2.x;
+                    }));
+
+                    Item * next = nullptr;
+                    const auto i = CutPointFinder<cpu, IndependentVariableType, SplitCriterion>::find(local->splitCriterion, items, &items[indexCount],
+                                                                             local->dataStatistics, node.totalDataStatistics,
+                                                                             context.featureTypesCache[featureIndex], next, local->splitCriterionValue,
+                                                                             local->bestCutPointDataStatistics,
+                                                                             [](const Item & v) -> IndependentVariableType { return v.x; },
+                                                                             [](const Item & v) -> DependentVariable { return v.y; },
+                                                                             [](const Item & v) -> IndependentVariableType { return v.w; },
+                                                                             [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+
+                    NodeSplit & split = local->splits[k];
+                    if (i != &items[indexCount] && split.isWorseThan(local->splitCriterionValue, featureIndex, epsilon))
+                    {
+                        split.isLeaf = false;
+                        split.featureIndex = featureIndex;
+                        split.splitCriterionValue = local->splitCriterionValue;
+                        switch (context.featureTypesCache[featureIndex])
+                        {
+                        case data_management::features::DAAL_CATEGORICAL:
+                            split.cutPoint = i->x;
+                            break;
+                        case data_management::features::DAAL_ORDINAL:
+                            split.cutPoint = next->x;
+                            break;
+                        case data_management::features::DAAL_CONTINUOUS:
+                            split.cutPoint = (i->x + next->x) / 2;
+                            break;
+                        default:
+                            DAAL_ASSERT(false);
+                            break;
+                        }
+                        split.pointsAtLeft = next - items; // distance.
+                        split.dataStatistics = local->bestCutPointDataStatistics;
+                    }
+                }
+            } );
+
+            TArray<NodeSplit, cpu> splitsArray(activeSize);
+            NodeSplit * const splits = splitsArray.get();
+            localTLS.reduce([=](Local * v) -> void
+            {
+                for (size_t k = 0; v && splits && k < activeSize; ++k)
+                {
+                    const NodeSplit & local = v->splits[k];
+                    if (!local.isLeaf && splits[k].isWorseThan(local.splitCriterionValue, local.featureIndex, epsilon))
+                    {
+                        splits[k].isLeaf = false;
+                        splits[k].featureIndex = local.featureIndex;
+                        splits[k].splitCriterionValue = local.splitCriterionValue;
+                        splits[k].cutPoint = local.cutPoint;
+                        splits[k].pointsAtLeft = local.pointsAtLeft;
+                        splits[k].dataStatistics.swap(v->splits[k].dataStatistics);
+                    }
+                }
+
+                delete v;
+                v = nullptr;
+            } );
+            DAAL_CHECK_SAFE_STATUS();
+            DAAL_CHECK_MALLOC(splits);
+
+            size_t splitCount = 0;
+            for (size_t k = 0; k < activeSize; ++k)
+            {
+                LevelNode & node = active[k];
+                NodeSplit & split = splits[k];
+                const size_t indexCount = node.lastIndex - node.firstIndex;
+                const double impurity = static_cast<double>(context.splitCriterion(node.totalDataStatistics, indexCount));
+                if (split.isLeaf || split.pointsAtLeft < context.minLeafSize || indexCount - split.pointsAtLeft < context.minLeafSize)
+                {
+                    split.isLeaf = true;
+                    makeLeaf(node.nodeIndex, node.totalDataStatistics.getBestDependentVariableValue(), context.leavesData.add(node.totalDataStatistics),
+                             impurity, static_cast<int>(indexCount));
+                    continue;
+                }
+                makeSplit(node.nodeIndex, split.featureIndex, split.cutPoint, impurity, static_cast<int>(indexCount));
+                DAAL_ASSERT(!_nodes[node.nodeIndex].isLeaf());
+                ++splitCount;
+            }
+
+            // Rows going to the left children, the actual counts of the rows are stored in pointsAtLeft.
+            daal::threader_for(activeSize, activeSize, [=, &context](int k)
+            {
+                const LevelNode & node = active[k];
+                NodeSplit & split = splits[k];
+                if (split.isLeaf) { return; }
+
+                const size_t * const rows = &sortedIndexes[split.featureIndex * rowCount];
+                const IndependentVariableType * const dx = context.dx[split.featureIndex];
+                const IndependentVariableType cutPoint = split.cutPoint;
+                size_t leftCount = 0;
+                if (context.featureTypesCache[split.featureIndex] == data_management::features::DAAL_CATEGORICAL)
+                {
+                    for (size_t i = node.firstIndex; i < node.lastIndex; ++i)
+                    {
+                        leftCount += (isLeft[rows[i]] = (dx[rows[i]] == cutPoint));
+                    }
+                }
+                else
+                {
+                    for (size_t i = node.firstIndex; i < node.lastIndex; ++i)
+                    {
+                        leftCount += (isLeft[rows[i]] = (dx[rows[i]] < cutPoint));
+                    }
+                }
+                split.pointsAtLeft = leftCount;
+            } );
+
+            // Stable partition of the sorted indexes of every feature for all split nodes of the level.
+            daal::tls<size_t *> bufferTLS([=, &safeStat]()-> size_t *
+            {
+                size_t * const ptr = daal_alloc<size_t>(maxIndexCount);
+                DAAL_CHECK_COND_ERROR(ptr, safeStat, services::ErrorMemoryAllocationFailed);
+                return ptr;
+            } );
+
+            daal::threader_for(featureCount, featureCount, [=, &bufferTLS](int featureIndex)
+            {
+                size_t * const buffer = bufferTLS.local();
+                if (!buffer) { return; }
+                size_t * const sorted = &sortedIndexes[featureIndex * rowCount];
+                for (size_t k = 0; k < activeSize; ++k)
+                {
+                    if (splits[k].isLeaf) { continue; }
+
+                    const LevelNode & node = active[k];
+                    size_t leftCount = 0, rightCount = 0;
+                    for (size_t i = node.firstIndex; i < node.lastIndex; ++i)
+                    {
+                        const size_t row = sorted[i];
+                        if (isLeft[row]) { sorted[node.firstIndex + leftCount++] = row; }
+                        else { buffer[rightCount++] = row; }
+                    }
+                    DAAL_ASSERT(leftCount == splits[k].pointsAtLeft);
+                    for (size_t i = 0; i < rightCount; ++i)
+                    {
+                        sorted[node.firstIndex + leftCount + i] = buffer[i];
+                    }
+                }
+            } );
+
+            bufferTLS.reduce([](size_t * v) -> void
+            {
+                daal_free(v);
+                v = nullptr;
+            } );
+
+            DAAL_CHECK_SAFE_STATUS();
+
+            // Nodes of the next level.
+            if (splitCount != 0)
+            {
+                DAAL_CHECK_MALLOC(level.reset(splitCount * 2));
+            }
+            for (size_t k = 0; k < activeSize; ++k)
+            {
+                LevelNode & node = active[k];
+                NodeSplit & split = splits[k];
+                if (split.isLeaf) { continue; }
+
+                LevelNode & leftChild = level[levelSize++];
+                leftChild.firstIndex = node.firstIndex;
+                leftChild.lastIndex = node.firstIndex + split.pointsAtLeft;
+                leftChild.nodeIndex = _nodes[node.nodeIndex].leftChildIndex();
+                leftChild.totalDataStatistics.swap(split.dataStatistics);
+
+                LevelNode & rightChild = level[levelSize++];
+                rightChild.firstIndex = leftChild.lastIndex;
+                rightChild.lastIndex = node.lastIndex;
+                rightChild.nodeIndex = _nodes[node.nodeIndex].rightChildIndex();
+                rightChild.totalDataStatistics.swap(node.totalDataStatistics);
+                rightChild.totalDataStatistics -= leftChild.totalDataStatistics;
+            }
+        }
+
+        return services::Status();
+    }
+
     template <typename SplitCriterion, typename LeavesData>
     void internalTrainFewFeatures(const TrainigContext<SplitCriterion, LeavesData> & context, size_t * indexes, size_t indexCount,
                                   TreeNodeIndex nodeIndex, const typename SplitCriterion::DataStatistics & totalDataStatistics, size_t depthLimit)
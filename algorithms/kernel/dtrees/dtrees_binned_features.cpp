@@ -0,0 +1,158 @@
+/* file: dtrees_binned_features.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class holding the binned features of a data set
+//--
+*/
+
+#include "daal_kernel_defines.h"
+#include "services/env_detect.h"
+#include "dtrees_binned_features_impl.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace tree_utils
+{
+namespace interface1
+{
+
+int BinnedFeatures::serializationTag() { return _desc.tag(); }
+int BinnedFeatures::getSerializationTag() const { return _desc.tag(); }
+static data_management::SerializationIface* creatorBinnedFeatures() { return new BinnedFeatures(); }
+data_management::SerializationDesc BinnedFeatures::_desc(creatorBinnedFeatures, SERIALIZATION_TREE_UTILS_BINNED_FEATURES_ID);
+
+BinnedFeatures::BinnedFeatures() : _impl(new BinnedFeaturesImpl())
+{
+}
+
+BinnedFeatures::~BinnedFeatures()
+{
+    delete _impl;
+}
+
+size_t BinnedFeatures::getNumberOfRows() const
+{
+    return _impl->indexedFeatures().nRows();
+}
+
+size_t BinnedFeatures::getNumberOfFeatures() const
+{
+    return _impl->indexedFeatures().nCols();
+}
+
+size_t BinnedFeatures::getMaxBins() const
+{
+    return _impl->maxBins();
+}
+
+size_t BinnedFeatures::getMinBinSize() const
+{
+    return _impl->minBinSize();
+}
+
+services::Status BinnedFeatures::serializeImpl(data_management::InputDataArchive *arch)
+{
+    return _impl->serialImpl<data_management::InputDataArchive, false>(arch);
+}
+
+services::Status BinnedFeatures::deserializeImpl(const data_management::OutputDataArchive *arch)
+{
+    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+}
+
+template <typename algorithmFPType>
+services::SharedPtr<BinnedFeatures> BinnedFeatures::create(const NumericTable& data, size_t maxBins, size_t minBinSize,
+    services::Status *stat)
+{
+    services::SharedPtr<BinnedFeatures> res(new BinnedFeatures());
+    services::Status s;
+    if(!res.get() || !res->_impl)
+        s.add(services::ErrorMemoryAllocationFailed);
+    else
+        s = res->_impl->init<algorithmFPType>(data, maxBins, minBinSize);
+    if(stat)
+        *stat = s;
+    return s ? res : services::SharedPtr<BinnedFeatures>();
+}
+
+template <typename algorithmFPType>
+services::Status BinnedFeatures::BinnedFeaturesImpl::init(const NumericTable& data, size_t maxBins, size_t minBinSize)
+{
+    _maxBins = maxBins;
+    _minBinSize = minBinSize;
+    _fpType = (int)data_management::features::internal::getIndexNumType<algorithmFPType>();
+
+    const BinParams prm(maxBins, minBinSize);
+    const BinParams* pPrm = maxBins ? &prm : nullptr;
+
+    int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
+    switch(cpuid)
+    {
+#ifdef DAAL_KERNEL_AVX512
+        case avx512    : return dtrees::internal::computeBinnedFeatures<algorithmFPType, avx512    >(data, pPrm, _indexedFeatures);
+#endif
+#ifdef DAAL_KERNEL_AVX512_MIC
+        case avx512_mic: return dtrees::internal::computeBinnedFeatures<algorithmFPType, avx512_mic>(data, pPrm, _indexedFeatures);
+#endif
+#ifdef DAAL_KERNEL_AVX2
+        case avx2      : return dtrees::internal::computeBinnedFeatures<algorithmFPType, avx2      >(data, pPrm, _indexedFeatures);
+#endif
+#ifdef DAAL_KERNEL_AVX
+        case avx       : return dtrees::internal::computeBinnedFeatures<algorithmFPType, avx       >(data, pPrm, _indexedFeatures);
+#endif
+#ifdef DAAL_KERNEL_SSE42
+        case sse42     : return dtrees::internal::computeBinnedFeatures<algorithmFPType, sse42     >(data, pPrm, _indexedFeatures);
+#endif
+#ifdef DAAL_KERNEL_SSSE3
+        case ssse3     : return dtrees::internal::computeBinnedFeatures<algorithmFPType, ssse3     >(data, pPrm, _indexedFeatures);
+#endif
+        default        : return dtrees::internal::computeBinnedFeatures<algorithmFPType, sse2      >(data, pPrm, _indexedFeatures);
+    };
+}
+
+template DAAL_EXPORT services::SharedPtr<BinnedFeatures> BinnedFeatures::create<float>(const NumericTable& data,
+    size_t maxBins, size_t minBinSize, services::Status *stat);
+template DAAL_EXPORT services::SharedPtr<BinnedFeatures> BinnedFeatures::create<double>(const NumericTable& data,
+    size_t maxBins, size_t minBinSize, services::Status *stat);
+
+services::Status computeConcurrently(const services::Collection<services::SharedPtr<Training<batch> > >& algorithms)
+{
+    const size_t n = algorithms.size();
+    for(size_t i = 0; i < n; ++i)
+        DAAL_CHECK(algorithms[i].get(), services::ErrorNullParameterNotSupported);
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(n, n, [&](size_t i)
+    {
+        safeStat |= algorithms[i]->compute();
+    });
+    return safeStat.detach();
+}
+
+} // namespace interface1
+} // namespace tree_utils
+} // namespace algorithms
+} // namespace daal
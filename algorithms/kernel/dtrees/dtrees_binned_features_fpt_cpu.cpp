@@ -0,0 +1,50 @@
+/* file: dtrees_binned_features_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the computation of the binned features of a data set
+//--
+*/
+
+#include "dtrees_binned_features_impl.h"
+#include "dtrees_feature_type_helper.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeBinnedFeatures(const NumericTable& data, const BinParams* prm, IndexedFeatures& indexedFeatures)
+{
+    FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(data));
+    return indexedFeatures.init<algorithmFPType, cpu>(data, &featTypes, prm);
+}
+
+template services::Status computeBinnedFeatures<DAAL_FPTYPE, DAAL_CPU>(const NumericTable& data, const BinParams* prm,
+    IndexedFeatures& indexedFeatures);
+
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
@@ -0,0 +1,116 @@
+/* file: dtrees_binned_features_impl.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class holding the binned features of a data set
+//--
+*/
+
+#ifndef __DTREES_BINNED_FEATURES_IMPL_H__
+#define __DTREES_BINNED_FEATURES_IMPL_H__
+
+#include "algorithms/tree_utils/tree_utils_binned_features.h"
+#include "dtrees_feature_type_helper.h"
+#include "data_management/features/internal/helpers.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace tree_utils
+{
+namespace interface1
+{
+
+class BinnedFeatures::BinnedFeaturesImpl
+{
+public:
+    typedef dtrees::internal::IndexedFeatures IndexedFeatures;
+    typedef dtrees::internal::BinParams BinParams;
+
+    BinnedFeaturesImpl() : _maxBins(0), _minBinSize(0), _fpType(0) {}
+
+    size_t maxBins() const { return _maxBins; }
+    size_t minBinSize() const { return _minBinSize; }
+    const IndexedFeatures& indexedFeatures() const { return _indexedFeatures; }
+
+    //returns true if the index is built from the data of the given size
+    //with the given floating-point type and binning parameters
+    template <typename algorithmFPType>
+    bool isApplicable(const BinParams* prm, size_t nRows, size_t nCols) const
+    {
+        if((_fpType != (int)data_management::features::internal::getIndexNumType<algorithmFPType>()) ||
+            (_indexedFeatures.nRows() != nRows) || (_indexedFeatures.nCols() != nCols))
+            return false;
+        if(!prm)
+            return !_maxBins;
+        return (_maxBins == prm->maxBins) && (_minBinSize == prm->minBinSize);
+    }
+
+    template <typename algorithmFPType>
+    services::Status init(const data_management::NumericTable& data, size_t maxBins, size_t minBinSize);
+
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive* arch)
+    {
+        arch->set(_maxBins);
+        arch->set(_minBinSize);
+        arch->set(_fpType);
+        return _indexedFeatures.serialImpl<Archive, onDeserialize>(arch);
+    }
+
+private:
+    size_t _maxBins;
+    size_t _minBinSize;
+    int _fpType;
+    IndexedFeatures _indexedFeatures;
+};
+
+} // namespace interface1
+} // namespace tree_utils
+
+namespace dtrees
+{
+namespace internal
+{
+
+//Builds the index of the features of the data set, bins them if the binning parameters are given
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeBinnedFeatures(const NumericTable& data, const BinParams* prm, IndexedFeatures& indexedFeatures);
+
+//Returns the index of the features from the binned features given to the training if it is applicable,
+//otherwise builds the index in the local object
+template <typename algorithmFPType, CpuType cpu>
+services::Status getIndexedFeatures(const NumericTable& data, const FeatureTypes& featTypes, const BinParams* prm,
+    const tree_utils::BinnedFeatures* binnedFeatures, IndexedFeatures& localIndexedFeatures, const IndexedFeatures*& indexedFeatures)
+{
+    if(binnedFeatures && binnedFeatures->impl()->isApplicable<algorithmFPType>(prm, data.getNumberOfRows(), data.getNumberOfColumns()))
+    {
+        indexedFeatures = &binnedFeatures->impl()->indexedFeatures();
+        return services::Status();
+    }
+    indexedFeatures = &localIndexedFeatures;
+    return localIndexedFeatures.init<algorithmFPType, cpu>(data, &featTypes, prm);
+}
+
+} /* namespace internal */
+} /* namespace dtrees */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
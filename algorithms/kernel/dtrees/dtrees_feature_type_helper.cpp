@@ -130,10 +130,17 @@ services::Status IndexedFeatures::FeatureEntry::allocBorders()
     return binBorders ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed);
 }
 
-services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
+services::Status IndexedFeatures::alloc(size_t nC, size_t nR, bool bRowIndex)
 {
     const size_t newCapacity = nC*nR;
-    if(_data)
+    if(!bRowIndex)
+    {
+        if(_data)
+            services::daal_free(_data);
+        _data = nullptr;
+        _capacity = 0;
+    }
+    else if(_data)
     {
         if(newCapacity > _capacity)
         {
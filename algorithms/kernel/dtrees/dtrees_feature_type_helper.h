@@ -107,9 +107,12 @@ public:
     IndexedFeatures() : _data(nullptr), _entries(nullptr), _sizeOfIndex(sizeof(IndexType)), _nCols(0), _nRows(0), _capacity(0), _maxNumIndices(0){}
     ~IndexedFeatures();
 
+    //creates the index, bins the features if the binning parameters are given.
+    //If bRowIndex is false only the bins of the features are computed and data() is not available,
+    //the unique values of the features which are not binned are kept as their bin borders
     template <typename algorithmFPType, CpuType cpu>
     services::Status init(const NumericTable& nt, const FeatureTypes* featureTypes = nullptr,
-        const BinParams* pBimPrm = nullptr);
+        const BinParams* pBimPrm = nullptr, bool bRowIndex = true);
 
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const
@@ -140,8 +143,47 @@ public:
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
 
+    //writes the index to the archive or reads it from the archive
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive* arch)
+    {
+        size_t nC = _nCols;
+        size_t nR = _nRows;
+        size_t maxNumIndices = _maxNumIndices;
+        arch->set(nC);
+        arch->set(nR);
+        arch->set(maxNumIndices);
+        if(!nC || !nR)
+            return services::Status();
+        if(onDeserialize)
+        {
+            services::Status s = alloc(nC, nR);
+            if(!s)
+                return s;
+            _maxNumIndices = maxNumIndices;
+        }
+        for(size_t i = 0; i < nC; ++i)
+        {
+            FeatureEntry& entry = _entries[i];
+            int bBinned = !!entry.binBorders;
+            arch->set(entry.numIndices);
+            arch->set(bBinned);
+            if(!bBinned)
+                continue;
+            if(onDeserialize)
+            {
+                services::Status s = entry.allocBorders();
+                if(!s)
+                    return s;
+            }
+            arch->set(entry.binBorders, entry.numIndices);
+        }
+        arch->set(_data, nC*nR);
+        return services::Status();
+    }
+
 protected:
-    services::Status alloc(size_t nCols, size_t nRows);
+    services::Status alloc(size_t nCols, size_t nRows, bool bRowIndex = true);
 
 protected:
     IndexType* _data;
@@ -36,12 +36,61 @@ namespace dtrees
 namespace internal
 {
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Nonzero values of a CSR numeric table grouped by columns.
+// Allows to sort only the nonzero values of a feature when its index is created
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+struct SparseColumns
+{
+    services::Status init(CSRNumericTableIface& nt, size_t nRows, size_t nCols)
+    {
+        daal::internal::ReadRowsCSR<algorithmFPType, cpu> block(&nt, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(block);
+        const algorithmFPType* values = block.values();
+        const size_t* colIndices = block.cols();
+        const size_t* rowOffsets = block.rows();
+        const size_t nNonZero = rowOffsets[nRows] - rowOffsets[0];
+
+        colOffsets.reset(nCols + 1);
+        rowIdx.reset(nNonZero ? nNonZero : 1);
+        colValues.reset(nNonZero ? nNonZero : 1);
+        DAAL_CHECK_MALLOC(colOffsets.get() && rowIdx.get() && colValues.get());
+
+        colOffsets.setAll(0);
+        for(size_t i = 0; i < nNonZero; ++i)
+            ++colOffsets[colIndices[i]]; //column indices are 1-based
+        for(size_t iCol = 0; iCol < nCols; ++iCol)
+            colOffsets[iCol + 1] += colOffsets[iCol];
+
+        for(size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            for(size_t i = rowOffsets[iRow] - rowOffsets[0], iEnd = rowOffsets[iRow + 1] - rowOffsets[0]; i < iEnd; ++i)
+            {
+                const size_t pos = colOffsets[colIndices[i] - 1]++;
+                rowIdx[pos] = IndexType(iRow);
+                colValues[pos] = values[i];
+            }
+        }
+        //restore offsets shifted by the previous loop
+        for(size_t iCol = nCols; iCol > 0; --iCol)
+            colOffsets[iCol] = colOffsets[iCol - 1];
+        colOffsets[0] = 0;
+        return services::Status();
+    }
+
+    TVector<size_t, cpu, DefaultAllocator<cpu>> colOffsets;
+    TVector<IndexType, cpu, DefaultAllocator<cpu>> rowIdx;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu>> colValues;
+};
+
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1){}
-    bool isValid() const { return _index.get(); }
+    ColIndexTask(size_t nRows, const SparseColumns<IndexType, algorithmFPType, cpu>* sparse = nullptr) :
+        maxNumDiffValues(1), _index(nRows), _sparse(sparse), _isNonZero(sparse ? nRows : 0, false){}
+    bool isValid() const { return _index.get() && (!_sparse || _isNonZero.get()); }
 
     struct FeatureIdx
     {
@@ -68,35 +117,73 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable& nt, IndexedFeatures::FeatureEntry& entry,
         IndexType* aRes, size_t iCol, size_t nRows, bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        services::Status s = this->getSorted(nt, iCol, nRows);
         if(!s)
             return s;
         const FeatureIdx* index = _index.get();
         if(index[0].key == index[nRows - 1].key)
         {
             entry.numIndices = 1;
-            for(size_t i = 0; i < nRows; ++i)
-                aRes[i] = 0;
+            if(aRes)
+            {
+                for(size_t i = 0; i < nRows; ++i)
+                    aRes[i] = 0;
+            }
+            else
+            {
+                s = entry.allocBorders();
+                if(!s)
+                    return s;
+                entry.binBorders[0] = index[0].key;
+            }
            return s;
         }
         IndexType iUnique = 0;
-        aRes[index[0].val] = iUnique;
         algorithmFPType prev = index[0].key;
-        for(size_t i = 1; i < nRows; ++i)
+        if(aRes)
         {
-            const IndexType idx = index[i].val;
-            if(index[i].key == prev)
-                aRes[idx] = iUnique;
-            else
+            aRes[index[0].val] = iUnique;
+            for(size_t i = 1; i < nRows; ++i)
             {
-                aRes[idx] = ++iUnique;
-                prev = index[i].key;
+                const IndexType idx = index[i].val;
+                if(index[i].key == prev)
+                    aRes[idx] = iUnique;
+                else
+                {
+                    aRes[idx] = ++iUnique;
+                    prev = index[i].key;
+                }
+            }
+        }
+        else
+        {
+            for(size_t i = 1; i < nRows; ++i)
+            {
+                if(index[i].key != prev)
+                {
+                    ++iUnique;
+                    prev = index[i].key;
+                }
             }
         }
         ++iUnique;
         entry.numIndices = iUnique;
         if(maxNumDiffValues < iUnique)
             maxNumDiffValues = iUnique;
+        if(!aRes)
+        {
+            //no index of the rows, the unique values are the right borders of the bins
+            s = entry.allocBorders();
+            if(!s)
+                return s;
+            IndexType iBin = 0;
+            entry.binBorders[0] = index[0].key;
+            for(size_t i = 1; i < nRows; ++i)
+            {
+                if(index[i].key != index[i - 1].key)
+                    entry.binBorders[++iBin] = index[i].key;
+            }
+        }
         return services::Status();
     }
 
@@ -104,8 +191,10 @@ public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable& nt, size_t iCol, size_t nRows)
+    services::Status getSorted(NumericTable& nt, size_t iCol, size_t nRows)
     {
+        if(_sparse)
+            return getSortedSparse(iCol, nRows);
         const algorithmFPType* pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx* index = _index.get();
@@ -115,12 +204,53 @@ protected:
             index[i].val = i;
         }
         daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
-        return Status();
+        return services::Status();
+    }
+
+    //Sorts nonzero values of the column only, implicit zeros are inserted between
+    //negative and non-negative values without comparisons
+    services::Status getSortedSparse(size_t iCol, size_t nRows)
+    {
+        const size_t iFirst = _sparse->colOffsets[iCol];
+        const size_t nNonZero = _sparse->colOffsets[iCol + 1] - iFirst;
+        const IndexType* rowIdx = _sparse->rowIdx.get() + iFirst;
+        const algorithmFPType* values = _sparse->colValues.get() + iFirst;
+
+        FeatureIdx* index = _index.get();
+        FeatureIdx* nonZero = index + nRows - nNonZero;
+        for(size_t i = 0; i < nNonZero; ++i)
+        {
+            nonZero[i].key = values[i];
+            nonZero[i].val = rowIdx[i];
+            _isNonZero[rowIdx[i]] = true;
+        }
+        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nNonZero, nonZero);
+
+        size_t nNegative = 0;
+        for(; (nNegative < nNonZero) && (nonZero[nNegative].key < 0); ++nNegative)
+            index[nNegative] = nonZero[nNegative];
+
+        size_t pos = nNegative;
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            if(_isNonZero[i])
+                _isNonZero[i] = false;
+            else
+            {
+                index[pos].key = algorithmFPType(0);
+                index[pos].val = IndexType(i);
+                ++pos;
+            }
+        }
+        DAAL_ASSERT(pos == nRows - nNonZero + nNegative);
+        return services::Status();
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu>> _index;
+    const SparseColumns<IndexType, algorithmFPType, cpu>* _sparse;
+    TVector<bool, cpu, DefaultAllocator<cpu>> _isNonZero;
 };
 
 
@@ -128,7 +258,8 @@ template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams& prm) : super(nRows), _prm(prm), _bins(_prm.maxBins){}
+    ColIndexTaskBins(size_t nRows, const BinParams& prm, const SparseColumns<IndexType, algorithmFPType, cpu>* sparse = nullptr) :
+        super(nRows, sparse), _prm(prm), _bins(_prm.maxBins){}
     virtual services::Status makeIndex(NumericTable& nt, IndexedFeatures::FeatureEntry& entry,
         IndexType* aRes, size_t iCol, size_t nRows, bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
@@ -178,11 +309,12 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
         entry.numIndices = 1;
         services::Status s = entry.allocBorders();
         DAAL_CHECK(s, s);
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+        if(aRes)
+            services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
 
         entry.binBorders[0] = index[nRows - 1].key;
         _bins[0] = nRows;
-        return Status();
+        return services::Status();
     }
     entry.numIndices = nBins;
     services::Status s = entry.allocBorders();
@@ -192,8 +324,13 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
     size_t i = 0;
     for(size_t iBin = 0; iBin < nBins; ++iBin)
     {
-        for(size_t n = i + _bins[iBin]; i < n; ++i)
-            aRes[index[i].val] = iBin;
+        if(aRes)
+        {
+            for(size_t n = i + _bins[iBin]; i < n; ++i)
+                aRes[index[i].val] = iBin;
+        }
+        else
+            i += _bins[iBin];
         entry.binBorders[iBin] = index[i - 1].key;
     }
     if(this->maxNumDiffValues < entry.numIndices)
@@ -208,7 +345,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     if(bUnorderedFeature || nRows <= _prm.maxBins*_prm.minBinSize)
         return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    services::Status s = this->getSorted(nt, iCol, nRows);
     if(!s)
         return s;
 
@@ -216,7 +353,8 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     if(index[0].key == index[nRows - 1].key)
     {
         _bins[0] = nRows;
-        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+        if(aRes)
+            services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
 
         entry.numIndices = 1;
         s |= entry.allocBorders();
@@ -307,7 +445,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureTypes* featureTypes,
-    const BinParams* pBimPrm)
+    const BinParams* pBimPrm, bool bRowIndex)
 {
     dtrees::internal::FeatureTypes autoFT;
     if(!featureTypes)
@@ -317,7 +455,7 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
     }
 
     _maxNumIndices = 0;
-    services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows());
+    services::Status s = alloc(nt.getNumberOfColumns(), nt.getNumberOfRows(), bRowIndex);
     if(!s)
         return s;
 
@@ -326,11 +464,27 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> TlsTask;
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> DefaultTask;
     typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
+    typedef SparseColumns<IndexType, algorithmFPType, cpu> SparseColumnsType;
+
+    //columns of a CSR table are extracted in one pass instead of scanning all rows for every column
+    SparseColumnsType sparseColumns;
+    const SparseColumnsType* pSparse = nullptr;
+    if(nt.getDataLayout() == NumericTableIface::csrArray)
+    {
+        CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(&nt));
+        if(csr)
+        {
+            s = sparseColumns.init(*csr, nR, nC);
+            if(!s)
+                return s;
+            pSparse = &sparseColumns;
+        }
+    }
 
     daal::tls<TlsTask*> tlsData([=, &nt]()->TlsTask*
     {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask* res = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask* res = (pBimPrm ? new BinningTask(nRows, *pBimPrm, pSparse) : new DefaultTask(nRows, pSparse));
         if(res && !res->isValid())
         {
             delete res;
@@ -345,7 +499,7 @@ services::Status IndexedFeatures::init(const NumericTable& nt, const FeatureType
         //in case of single thread no need to allocate
         TlsTask* task = tlsData.local();
         DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
-        safeStat |= task->makeIndex(const_cast<NumericTable&>(nt), _entries[iCol], _data + iCol*nRows(), iCol, nRows(),
+        safeStat |= task->makeIndex(const_cast<NumericTable&>(nt), _entries[iCol], bRowIndex ? _data + iCol*nRows() : nullptr, iCol, nRows(),
             featureTypes->isUnordered(iCol));
     });
     tlsData.reduce([&](TlsTask* task)-> void
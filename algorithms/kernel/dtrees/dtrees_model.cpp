@@ -22,6 +22,9 @@
 */
 
 #include "dtrees_model_impl.h"
+#include "service_data_utils.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -39,7 +42,7 @@ Tree::~Tree()
 {
 }
 
-ModelImpl::ModelImpl() : _nTree(0)
+ModelImpl::ModelImpl() : _nTree(0), _version(0)
 {
 }
 
@@ -51,12 +54,123 @@ ModelImpl::~ModelImpl()
 void ModelImpl::destroy()
 {
     _serializationData.reset();
+    resetFlatForest();
 }
 
+void ModelImpl::resetFlatForest()
+{
+    AUTOLOCK(_flatForestMutex);
+    updateVersion();
+    _flatForestFloat.reset();
+    _flatForestDouble.reset();
+}
+
+template <typename algorithmFPType>
+static SharedPtr<const FlatForest<algorithmFPType> > getCachedFlatForest(SharedPtr<FlatForest<algorithmFPType> >& cache,
+    Mutex& mutex, const DataCollection* trees, size_t nTrees, size_t version)
+{
+    AUTOLOCK(mutex);
+    if(cache.get() && cache->getModelVersion() == version)
+        return cache;
+    cache.reset();
+    if(!trees || !nTrees)
+        return SharedPtr<const FlatForest<algorithmFPType> >();
+    SharedPtr<FlatForest<algorithmFPType> > forest(new FlatForest<algorithmFPType>());
+    if(!forest.get() || !forest->init(*trees, nTrees, version))
+        return SharedPtr<const FlatForest<algorithmFPType> >();
+    cache = forest;
+    return cache;
+}
+
+template <>
+SharedPtr<const FlatForest<float> > ModelImpl::getFlatForest<float>() const
+{
+    return getCachedFlatForest<float>(_flatForestFloat, _flatForestMutex, _serializationData.get(), size(), getVersion());
+}
+
+template <>
+SharedPtr<const FlatForest<double> > ModelImpl::getFlatForest<double>() const
+{
+    return getCachedFlatForest<double>(_flatForestDouble, _flatForestMutex, _serializationData.get(), size(), getVersion());
+}
+
+/* Split value for the flat layout is chosen so that 'x > value' gives the same result
+   as the comparison of x with the split value stored in the model */
+template <typename algorithmFPType>
+static algorithmFPType convertSplitValue(ModelFPType val)
+{
+    return algorithmFPType(val);
+}
+
+template <>
+float convertSplitValue<float>(ModelFPType val)
+{
+    union { float f; uint32_t u; } res;
+    res.f = float(val);
+    if(ModelFPType(res.f) > val)
+    {
+        /* rounded up: take the closest float value below */
+        if(res.u == 0 || res.u == 0x80000000u)
+            res.u = 0x80000001u;
+        else if(res.u & 0x80000000u)
+            ++res.u;
+        else
+            --res.u;
+    }
+    return res.f;
+}
+
+template <typename algorithmFPType>
+Status FlatForest<algorithmFPType>::init(const DataCollection& trees, size_t nTrees, size_t modelVersion)
+{
+    _nTrees = 0;
+    _modelVersion = modelVersion;
+    _treeOffset = Collection<size_t>(nTrees + 1);
+    DAAL_CHECK_MALLOC(_treeOffset.data());
+    size_t nNodes = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const DecisionTreeTable* pTree = static_cast<const DecisionTreeTable*>(trees[iTree].get());
+        DAAL_CHECK(pTree, ErrorNullModel);
+        DAAL_CHECK(pTree->getNumberOfRows() < size_t(services::internal::MaxVal<IndexType>::get()), ErrorIncorrectSizeOfModel);
+        _treeOffset[iTree] = nNodes;
+        nNodes += pTree->getNumberOfRows();
+    }
+    _treeOffset[nTrees] = nNodes;
+
+    _featureIndex = Collection<IndexType>(nNodes);
+    _leftIndexOrClass = Collection<IndexType>(nNodes);
+    _featureValue = Collection<algorithmFPType>(nNodes);
+    DAAL_CHECK_MALLOC(_featureIndex.data() && _leftIndexOrClass.data() && _featureValue.data());
+
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const DecisionTreeTable* pTree = static_cast<const DecisionTreeTable*>(trees[iTree].get());
+        const DecisionTreeNode* aNode = (const DecisionTreeNode*)pTree->getArray();
+        IndexType* fi = _featureIndex.data() + _treeOffset[iTree];
+        IndexType* lc = _leftIndexOrClass.data() + _treeOffset[iTree];
+        algorithmFPType* fv = _featureValue.data() + _treeOffset[iTree];
+        for(size_t i = 0, n = getTreeSize(iTree); i < n; ++i)
+        {
+            const bool bSplit = aNode[i].isSplit() && aNode[i].featureIndex >= 0;
+            fi[i] = bSplit ? IndexType(aNode[i].featureIndex) : IndexType(-1);
+            lc[i] = IndexType(aNode[i].leftIndexOrClass);
+            fv[i] = bSplit ? convertSplitValue<algorithmFPType>(aNode[i].featureValueOrResponse) :
+                algorithmFPType(aNode[i].featureValueOrResponse);
+        }
+    }
+    _nTrees = nTrees;
+    return Status();
+}
+
+template class FlatForest<float>;
+template class FlatForest<double>;
+
 bool ModelImpl::reserve(const size_t nTrees)
 {
     if(_serializationData.get())
         return false;
+    resetFlatForest();
     _nTree.set(0);
     _serializationData.reset(new DataCollection());
     _serializationData->resize(nTrees);
@@ -74,6 +188,7 @@ bool ModelImpl::resize(const size_t nTrees)
 {
     if(_serializationData.get())
         return false;
+    resetFlatForest();
     _nTree.set(0);
     _serializationData.reset(new DataCollection(nTrees));
     _impurityTables.reset(new DataCollection(nTrees));
@@ -81,6 +196,40 @@ bool ModelImpl::resize(const size_t nTrees)
     return _serializationData.get();
 }
 
+bool ModelImpl::addTreesOf(const ModelImpl& other)
+{
+    if(!_serializationData.get() || size() || !other._serializationData.get())
+        return false;
+    const size_t nTrees = other.size();
+    //resize() allocates the slots for the trees, reserve() only the memory for them
+    const bool bSlots = (_serializationData->size() > 0);
+    if(bSlots && (_serializationData->size() < nTrees))
+        return false;
+    for(size_t i = 0; i < nTrees; ++i)
+    {
+        //impurities and numbers of observations are not available in the models created by the model builders
+        SerializationIfacePtr imp = other._impurityTables.get() && (i < other._impurityTables->size()) ?
+            (*other._impurityTables)[i] : SerializationIfacePtr();
+        SerializationIfacePtr nSamples = other._nNodeSampleTables.get() && (i < other._nNodeSampleTables->size()) ?
+            (*other._nNodeSampleTables)[i] : SerializationIfacePtr();
+        if(bSlots)
+        {
+            (*_serializationData)[i] = (*other._serializationData)[i];
+            (*_impurityTables)[i] = imp;
+            (*_nNodeSampleTables)[i] = nSamples;
+        }
+        else
+        {
+            _serializationData->push_back((*other._serializationData)[i]);
+            _impurityTables->push_back(imp);
+            _nNodeSampleTables->push_back(nSamples);
+        }
+    }
+    _nTree.set(nTrees);
+    resetFlatForest();
+    return true;
+}
+
 void ModelImpl::clear()
 {
     if(_serializationData.get())
@@ -93,6 +242,7 @@ void ModelImpl::clear()
         _nNodeSampleTables.reset();
 
     _nTree.set(0);
+    resetFlatForest();
 }
 
 void MemoryManager::destroy()
@@ -314,6 +464,141 @@ services::Status addSplitNodeInternal(data_management::DataCollectionPtr& serial
     return s;
 }
 
+/* View of a tree stored in DecisionTreeTable used by the export of the trees */
+struct DecisionTreeTableView
+{
+    DecisionTreeTableView(const DecisionTreeTable* tbl, const double* imp, const int* nodeSampleCount, bool bClassification) :
+        aNode(tbl ? (const DecisionTreeNode*)tbl->getArray() : nullptr), nNodes(aNode ? tbl->getNumberOfRows() : 0),
+        impVals(imp), nodeSampleCounts(nodeSampleCount), classification(bClassification) {}
+
+    size_t getMaxNumberOfNodes() const { return nNodes; }
+    bool isSplit(size_t idx, size_t) const { return aNode[idx].featureIndex >= 0; }
+    size_t leftChild(size_t idx) const { return aNode[idx].leftIndexOrClass; }
+    size_t rightChild(size_t idx) const { return aNode[idx].leftIndexOrClass + 1; }
+    int featureIndex(size_t idx) const { return aNode[idx].featureIndex; }
+    double splitValue(size_t idx) const { return aNode[idx].featureValueOrResponse; }
+    double leafValue(size_t idx) const
+    {
+        return classification ? double(aNode[idx].leftIndexOrClass) : aNode[idx].featureValueOrResponse;
+    }
+    double impurity(size_t idx) const { return impVals ? impVals[idx] : 0; }
+    size_t nodeSampleCount(size_t idx) const { return nodeSampleCounts ? size_t(nodeSampleCounts[idx]) : 0; }
+
+    const DecisionTreeNode* aNode;
+    size_t nNodes;
+    const double* impVals;
+    const int* nodeSampleCounts;
+    bool classification;
+};
+
+services::Status ModelImpl::exportTrees(size_t iFirstTree, size_t nTrees, bool classification, tree_utils::TreeArrays& trees) const
+{
+    DAAL_CHECK(iFirstTree + nTrees <= size() && iFirstTree + nTrees >= iFirstTree, services::ErrorIncorrectParameter);
+    auto getTree = [&](size_t iTree) -> DecisionTreeTableView
+    {
+        const size_t i = iFirstTree + iTree;
+        return DecisionTreeTableView(at(i), getImpVals(i), getNodeSampleCount(i), classification);
+    };
+    return exportTreesToArrays(nTrees, getTree, trees);
+}
+
+/* Fills the table of a tree from the arrays of its nodes. Nodes are numbered breadth-first
+   so that the right child of a split node immediately follows its left child */
+static services::Status fillTreeTable(DecisionTreeNode* aNode, size_t nNodes, const int* featureIndexes,
+    const size_t* leftChildren, const size_t* rightChildren, const double* values, bool classification)
+{
+    services::Collection<size_t> srcIdxArr(nNodes);
+    services::Collection<bool> visitedArr(nNodes);
+    DAAL_CHECK_MALLOC(srcIdxArr.data() && visitedArr.data())
+    size_t* const srcIdx = srcIdxArr.data();
+    bool* const visited = visitedArr.data();
+    for(size_t i = 0; i < nNodes; ++i)
+        visited[i] = false;
+
+    srcIdx[0] = 0;
+    visited[0] = true;
+    size_t nAssigned = 1;
+    for(size_t i = 0; i < nAssigned; ++i)
+    {
+        const size_t iSrc = srcIdx[i];
+        if(featureIndexes[iSrc] < 0)
+        {
+            DAAL_CHECK(featureIndexes[iSrc] == -1, services::ErrorIncorrectParameter);
+            if(classification)
+            {
+                /* class labels must be non-negative integers */
+                DAAL_CHECK(values[iSrc] >= 0 && double(size_t(values[iSrc])) == values[iSrc], services::ErrorIncorrectParameter);
+                setNode(aNode[i], -1, size_t(values[iSrc]));
+            }
+            else
+            {
+                setNode(aNode[i], -1, values[iSrc]);
+            }
+            continue;
+        }
+        const size_t iLeft = leftChildren[iSrc];
+        const size_t iRight = rightChildren[iSrc];
+        DAAL_CHECK(iLeft < nNodes && iRight < nNodes && !visited[iLeft] && !visited[iRight] && iLeft != iRight,
+            services::ErrorIncorrectParameter);
+        aNode[i].featureIndex = featureIndexes[iSrc];
+        aNode[i].leftIndexOrClass = nAssigned;
+        aNode[i].featureValueOrResponse = values[iSrc];
+        visited[iLeft] = visited[iRight] = true;
+        srcIdx[nAssigned++] = iLeft;
+        srcIdx[nAssigned++] = iRight;
+    }
+    /* all the nodes must be reachable from the root */
+    DAAL_CHECK(nAssigned == nNodes, services::ErrorIncorrectParameter);
+    return services::Status();
+}
+
+services::Status addTreesInternal(data_management::DataCollectionPtr& serializationData, size_t firstTreeId, size_t lastTreeId,
+    size_t nTrees, const size_t* treeOffsets, const int* featureIndexes, const size_t* leftChildren, const size_t* rightChildren,
+    const double* values, bool classification, size_t& resId)
+{
+    DAAL_CHECK(nTrees, services::ErrorIncorrectParameter);
+    DAAL_CHECK(treeOffsets && featureIndexes && leftChildren && rightChildren && values, services::ErrorNullPtr);
+    DAAL_CHECK(lastTreeId <= serializationData->size(), services::ErrorIncorrectParameter);
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        DAAL_CHECK(treeOffsets[iTree] < treeOffsets[iTree + 1], services::ErrorIncorrectParameter);
+    }
+
+    /* trees are added to the first free slots */
+    size_t treeId = firstTreeId;
+    while((treeId < lastTreeId) && (*serializationData)[treeId].get())
+        ++treeId;
+    DAAL_CHECK(treeId + nTrees <= lastTreeId, services::ErrorIncorrectParameter);
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        DAAL_CHECK(!(*serializationData)[treeId + iTree].get(), services::ErrorIncorrectParameter);
+    }
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+    {
+        const size_t first = treeOffsets[iTree];
+        const size_t nNodes = treeOffsets[iTree + 1] - first;
+        DecisionTreeTablePtr treeTablePtr(new DecisionTreeTable(nNodes));
+        DecisionTreeNode* const aNode = treeTablePtr.get() ? (DecisionTreeNode*)treeTablePtr->getArray() : nullptr;
+        DAAL_CHECK_MALLOC_THR(aNode);
+
+        services::Status s = fillTreeTable(aNode, nNodes, featureIndexes + first, leftChildren + first, rightChildren + first,
+            values + first, classification);
+        DAAL_CHECK_STATUS_THR(s);
+        (*serializationData)[treeId + iTree] = treeTablePtr;
+    });
+    services::Status s = safeStat.detach();
+    if(!s)
+    {
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            (*serializationData)[treeId + iTree].reset();
+        return s;
+    }
+    resId = treeId;
+    return s;
+}
+
 } // namespace internal
 } // namespace dtrees
 } // namespace algorithms
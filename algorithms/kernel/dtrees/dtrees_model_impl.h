@@ -30,6 +30,10 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "service_memory.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "algorithms/tree_utils/tree_utils_arrays.h"
 
 typedef size_t ClassIndexType;
 typedef double ModelFPType;
@@ -69,6 +73,43 @@ public:
 typedef services::SharedPtr<DecisionTreeTable> DecisionTreeTablePtr;
 typedef services::SharedPtr<const DecisionTreeTable> DecisionTreeTableConstPtr;
 
+/* Prediction-oriented copy of the trees of a model. Fields of the nodes are kept in separate
+   arrays so that a block of observations can be advanced through a tree with vector gathers.
+   Nodes of all trees are stored one after another, indices of the nodes are local to a tree */
+template <typename algorithmFPType>
+class FlatForest
+{
+public:
+    typedef int32_t IndexType;
+
+    FlatForest() : _nTrees(0), _modelVersion(0){}
+
+    /* modelVersion is the version of the model the trees are taken from */
+    services::Status init(const data_management::DataCollection& trees, size_t nTrees, size_t modelVersion);
+
+    size_t getNumberOfTrees() const { return _nTrees; }
+    size_t getModelVersion() const { return _modelVersion; }
+    size_t getNumberOfNodes() const { return _featureIndex.size(); }
+    size_t getTreeSize(size_t iTree) const { return _treeOffset[iTree + 1] - _treeOffset[iTree]; }
+    size_t getAverageTreeSize() const { return _nTrees ? getNumberOfNodes() / _nTrees : 0; }
+    static size_t getNodeSize() { return 2*sizeof(IndexType) + sizeof(algorithmFPType); }
+
+    /* Split: index of the feature, leaf: -1 */
+    const IndexType* featureIndex(size_t iTree) const { return _featureIndex.data() + _treeOffset[iTree]; }
+    /* Split: index of the left child, classification leaf: class index */
+    const IndexType* leftIndexOrClass(size_t iTree) const { return _leftIndexOrClass.data() + _treeOffset[iTree]; }
+    /* Split: feature value, regression leaf: response */
+    const algorithmFPType* featureValue(size_t iTree) const { return _featureValue.data() + _treeOffset[iTree]; }
+
+private:
+    size_t _nTrees;
+    size_t _modelVersion;
+    services::Collection<size_t> _treeOffset;
+    services::Collection<IndexType> _featureIndex;
+    services::Collection<IndexType> _leftIndexOrClass;
+    services::Collection<algorithmFPType> _featureValue;
+};
+
 template <typename TResponse, typename THistogramm>
 class ClassifierResponse
 {
@@ -316,6 +357,12 @@ void setNode(DecisionTreeNode& node, int featureIndex, double response);
 
 services::Status addSplitNodeInternal(data_management::DataCollectionPtr& serializationData,size_t treeId, size_t parentId, size_t position, size_t featureIndex, double featureValue, size_t& res);
 
+/* Adds nTrees trees built from the arrays of their nodes to the first free slots in [firstTreeId, lastTreeId).
+   Trees are built in parallel, resId is the identifier of the first added tree */
+services::Status addTreesInternal(data_management::DataCollectionPtr& serializationData, size_t firstTreeId, size_t lastTreeId,
+    size_t nTrees, const size_t* treeOffsets, const int* featureIndexes, const size_t* leftChildren, const size_t* rightChildren,
+    const double* values, bool classification, size_t& resId);
+
 template<typename ClassOrResponseType>
 static services::Status addLeafNodeInternal(data_management::DataCollectionPtr& serializationData, size_t treeId, size_t parentId, size_t position, ClassOrResponseType response, size_t& res)
 {
@@ -424,6 +471,100 @@ static services::Status addLeafNodeInternal(data_management::DataCollectionPtr&
     return s;
 }
 
+/* Visits the nodes of a tree breadth-first. The visitor gets the position of a node in the order of the traversal,
+   the index of the node in the tree view and the position of its left child (0 for leaves).
+   The right child follows the left one. nNodes is set to the number of visited nodes */
+template <typename TreeView, typename Visitor>
+services::Status traverseTreeBF(const TreeView& tree, Visitor& visit, size_t& nNodes)
+{
+    const size_t maxNodes = tree.getMaxNumberOfNodes();
+    DAAL_CHECK(maxNodes, services::ErrorNullModel);
+    services::Collection<size_t> idxArr(maxNodes);
+    services::Collection<size_t> levelArr(maxNodes);
+    DAAL_CHECK_MALLOC(idxArr.data() && levelArr.data())
+    size_t* const idx = idxArr.data();
+    size_t* const level = levelArr.data();
+
+    idx[0] = 0;
+    level[0] = 0;
+    nNodes = 1;
+    for(size_t i = 0; i < nNodes; ++i)
+    {
+        if(tree.isSplit(idx[i], level[i]))
+        {
+            DAAL_CHECK(nNodes + 2 <= maxNodes, services::ErrorIncorrectParameter);
+            visit(i, idx[i], nNodes);
+            idx[nNodes] = tree.leftChild(idx[i]);
+            idx[nNodes + 1] = tree.rightChild(idx[i]);
+            level[nNodes] = level[nNodes + 1] = level[i] + 1;
+            nNodes += 2;
+        }
+        else
+        {
+            visit(i, idx[i], 0);
+        }
+    }
+    return services::Status();
+}
+
+/* Exports nTrees trees to the arrays, getTree(i) returns the view of the i-th tree.
+   The nodes are counted and then copied, the trees are processed in parallel at both steps */
+template <typename GetTreeView>
+services::Status exportTreesToArrays(size_t nTrees, const GetTreeView& getTree, tree_utils::TreeArrays& trees)
+{
+    services::Collection<size_t> nNodesArr(nTrees);
+    DAAL_CHECK_MALLOC(nNodesArr.data())
+    size_t* const nNodes = nNodesArr.data();
+
+    {
+        daal::SafeStatus safeStat;
+        daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+        {
+            auto countNode = [](size_t, size_t, size_t) {};
+            DAAL_CHECK_STATUS_THR(traverseTreeBF(getTree(iTree), countNode, nNodes[iTree]));
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    size_t nTotalNodes = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        nTotalNodes += nNodes[iTree];
+    services::Status s = trees.allocate(nTrees, nTotalNodes);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t* const treeOffsets = trees.getTreeOffsets().get();
+    treeOffsets[0] = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        treeOffsets[iTree + 1] = treeOffsets[iTree] + nNodes[iTree];
+
+    int* const featureIndexes = trees.getFeatureIndexes().get();
+    size_t* const leftChildren = trees.getLeftChildren().get();
+    size_t* const rightChildren = trees.getRightChildren().get();
+    double* const values = trees.getValues().get();
+    double* const impurities = trees.getImpurities().get();
+    size_t* const nodeSampleCounts = trees.getNodeSampleCounts().get();
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree)
+    {
+        const auto tree = getTree(iTree);
+        const size_t first = treeOffsets[iTree];
+        auto copyNode = [&](size_t iNode, size_t idx, size_t iLeft)
+        {
+            const size_t i = first + iNode;
+            featureIndexes[i]   = iLeft ? tree.featureIndex(idx) : -1;
+            leftChildren[i]     = iLeft;
+            rightChildren[i]    = iLeft ? iLeft + 1 : 0;
+            values[i]           = iLeft ? tree.splitValue(idx) : tree.leafValue(idx);
+            impurities[i]       = tree.impurity(idx);
+            nodeSampleCounts[i] = tree.nodeSampleCount(idx);
+        };
+        size_t nCopied = 0;
+        DAAL_CHECK_STATUS_THR(traverseTreeBF(tree, copyNode, nCopied));
+    });
+    return safeStat.detach();
+}
+
 class ModelImpl
 {
 public:
@@ -435,6 +576,10 @@ public:
     bool resize(const size_t nTrees);
     void clear();
 
+    /* Makes the trees of the other model the first trees of this model, the trees are shared by both models.
+       This model should be allocated with reserve() or resize() and should not contain trees */
+    bool addTreesOf(const ModelImpl& other);
+
     const data_management::DataCollection* serializationData() const
     {
         return _serializationData.get();
@@ -447,16 +592,36 @@ public:
 
     const double* getImpVals(size_t i) const
     {
-        return _impurityTables ? ((const data_management::HomogenNumericTable<double>*)(*_impurityTables)[i].get())->getArray() : nullptr;
+        const data_management::HomogenNumericTable<double>* tbl = _impurityTables ?
+            (const data_management::HomogenNumericTable<double>*)(*_impurityTables)[i].get() : nullptr;
+        return tbl ? tbl->getArray() : nullptr;
     }
 
     const int* getNodeSampleCount(size_t i) const
     {
-        return _nNodeSampleTables ? ((const data_management::HomogenNumericTable<int>*)(*_nNodeSampleTables)[i].get())->getArray() : nullptr;
+        const data_management::HomogenNumericTable<int>* tbl = _nNodeSampleTables ?
+            (const data_management::HomogenNumericTable<int>*)(*_nNodeSampleTables)[i].get() : nullptr;
+        return tbl ? tbl->getArray() : nullptr;
     }
 
+    /* Returns the prediction-oriented copy of the trees. It is built on the first call and cached
+       until the version of the model is changed. Returns empty pointer if the copy can't be built */
+    template <typename algorithmFPType>
+    services::SharedPtr<const FlatForest<algorithmFPType> > getFlatForest() const;
+
+    /* Exports the trees [iFirstTree, iFirstTree + nTrees) to the arrays. Leaves of the classification trees
+       store class labels, leaves of the regression trees store responses */
+    services::Status exportTrees(size_t iFirstTree, size_t nTrees, bool classification, tree_utils::TreeArrays& trees) const;
+
+    /* Version of the model, it is changed on every change of the trees */
+    size_t getVersion() const { return _version.get(); }
+
 protected:
     void destroy();
+    /* Changes the version of the model and releases the cached copies of the trees */
+    void resetFlatForest();
+    /* Changes the version of the model, called when the trees are modified */
+    void updateVersion() { _version.inc(); }
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
@@ -469,7 +634,10 @@ protected:
         }
 
         if(onDeserialize)
+        {
             _nTree.set(_serializationData->size());
+            resetFlatForest();
+        }
 
         return services::Status();
     }
@@ -477,11 +645,22 @@ protected:
 protected:
     data_management::DataCollectionPtr _serializationData; //collection of DecisionTreeTables
     daal::services::Atomic<size_t> _nTree;
+    daal::services::Atomic<size_t> _version;
 
     data_management::DataCollectionPtr _impurityTables;
     data_management::DataCollectionPtr _nNodeSampleTables;
+
+    mutable services::SharedPtr<FlatForest<float> > _flatForestFloat;
+    mutable services::SharedPtr<FlatForest<double> > _flatForestDouble;
+    mutable Mutex _flatForestMutex;
 };
 
+template <>
+services::SharedPtr<const FlatForest<float> > ModelImpl::getFlatForest<float>() const;
+
+template <>
+services::SharedPtr<const FlatForest<double> > ModelImpl::getFlatForest<double>() const;
+
 template <typename NodeType, typename Allocator>
 void TreeImpl<NodeType, Allocator>::destroy()
 {
@@ -30,6 +30,10 @@
 #include "dtrees_feature_type_helper.h"
 #include "service_environment.h"
 
+#if defined (__INTEL_COMPILER)
+  #include <immintrin.h>
+#endif
+
 using namespace daal::internal;
 using namespace daal::services::internal;
 
@@ -111,6 +115,201 @@ const DecisionTreeNode* findNode(const dtrees::internal::DecisionTreeTable& t,
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds leaves of the tree stored in the flat layout for a block
+// of observations. Observations are advanced through the tree simultaneously, one level
+// per pass, without branches on the split results
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+void findLeavesCommon(const algorithmFPType* x, size_t nRows, size_t nCols,
+    const typename FlatForest<algorithmFPType>::IndexType* fi,
+    const typename FlatForest<algorithmFPType>::IndexType* lc,
+    const algorithmFPType* fv, typename FlatForest<algorithmFPType>::IndexType* leaf)
+{
+    typedef typename FlatForest<algorithmFPType>::IndexType IndexType;
+    for(size_t i = 0; i < nRows; ++i)
+        leaf[i] = 0;
+    for(bool bSplit = (fi[0] >= 0); bSplit;)
+    {
+        bSplit = false;
+        PRAGMA_IVDEP
+        for(size_t i = 0; i < nRows; ++i)
+        {
+            const IndexType iNode = leaf[i];
+            const IndexType iFeature = fi[iNode];
+            const bool bNodeSplit = (iFeature >= 0);
+            const IndexType sn = IndexType(x[i*nCols + (bNodeSplit ? iFeature : 0)] > fv[iNode]);
+            leaf[i] = bNodeSplit ? lc[iNode] + sn : iNode;
+            bSplit |= bNodeSplit;
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+struct FlatTreeTraversal
+{
+    typedef typename FlatForest<algorithmFPType>::IndexType IndexType;
+    static void findLeaves(const algorithmFPType* x, size_t nRows, size_t nCols,
+        const IndexType* fi, const IndexType* lc, const algorithmFPType* fv, IndexType* leaf)
+    {
+        findLeavesCommon<algorithmFPType>(x, nRows, nCols, fi, lc, fv, leaf);
+    }
+};
+
+#if defined (__INTEL_COMPILER)
+#if __CPUID__(DAAL_CPU) == __avx512__
+/* 16 (float) or 8 (double) observations are advanced through the tree with one vector of node indices */
+template <>
+struct FlatTreeTraversal<float, DAAL_CPU>
+{
+    typedef FlatForest<float>::IndexType IndexType;
+    static void findLeaves(const float* x, size_t nRows, size_t nCols,
+        const IndexType* fi, const IndexType* lc, const float* fv, IndexType* leaf)
+    {
+        const size_t nVecRows = nRows - nRows % 16;
+        const __m512i rowOffset = _mm512_mullo_epi32(_mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+            _mm512_set1_epi32(int(nCols)));
+        const __m512i minusOne = _mm512_set1_epi32(-1);
+        const __m512i one = _mm512_set1_epi32(1);
+        for(size_t i = 0; i < nVecRows; i += 16)
+        {
+            const float* xi = x + i*nCols;
+            __m512i node = _mm512_setzero_si512();
+            __mmask16 isSplit = 0xffff;
+            for(;;)
+            {
+                const __m512i feature = _mm512_mask_i32gather_epi32(minusOne, isSplit, node, fi, 4);
+                isSplit = _mm512_mask_cmp_epi32_mask(isSplit, feature, minusOne, _MM_CMPINT_NE);
+                if(!isSplit)
+                    break;
+                const __m512 splitValue = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), isSplit, node, fv, 4);
+                const __m512 value = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), isSplit, _mm512_add_epi32(rowOffset, feature), xi, 4);
+                const __m512i left = _mm512_mask_i32gather_epi32(node, isSplit, node, lc, 4);
+                const __mmask16 isRight = _mm512_mask_cmp_ps_mask(isSplit, value, splitValue, _CMP_GT_OQ);
+                node = _mm512_mask_mov_epi32(node, isSplit, left);
+                node = _mm512_mask_add_epi32(node, isRight, node, one);
+            }
+            _mm512_storeu_si512(leaf + i, node);
+        }
+        if(nVecRows < nRows)
+            findLeavesCommon<float>(x + nVecRows*nCols, nRows - nVecRows, nCols, fi, lc, fv, leaf + nVecRows);
+    }
+};
+
+template <>
+struct FlatTreeTraversal<double, DAAL_CPU>
+{
+    typedef FlatForest<double>::IndexType IndexType;
+    static void findLeaves(const double* x, size_t nRows, size_t nCols,
+        const IndexType* fi, const IndexType* lc, const double* fv, IndexType* leaf)
+    {
+        const size_t nVecRows = nRows - nRows % 8;
+        const __m256i rowOffset = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32(int(nCols)));
+        const __m256i minusOne = _mm256_set1_epi32(-1);
+        const __m256i one = _mm256_set1_epi32(1);
+        for(size_t i = 0; i < nVecRows; i += 8)
+        {
+            const double* xi = x + i*nCols;
+            __m256i node = _mm256_setzero_si256();
+            __mmask8 isSplit = 0xff;
+            for(;;)
+            {
+                const __m256i feature = _mm256_mmask_i32gather_epi32(minusOne, isSplit, node, fi, 4);
+                isSplit = _mm256_mask_cmp_epi32_mask(isSplit, feature, minusOne, _MM_CMPINT_NE);
+                if(!isSplit)
+                    break;
+                const __m512d splitValue = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), isSplit, node, fv, 8);
+                const __m512d value = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), isSplit, _mm256_add_epi32(rowOffset, feature), xi, 8);
+                const __m256i left = _mm256_mmask_i32gather_epi32(node, isSplit, node, lc, 4);
+                const __mmask8 isRight = _mm512_mask_cmp_pd_mask(isSplit, value, splitValue, _CMP_GT_OQ);
+                node = _mm256_mask_mov_epi32(node, isSplit, left);
+                node = _mm256_mask_add_epi32(node, isRight, node, one);
+            }
+            _mm256_storeu_si256((__m256i*)(leaf + i), node);
+        }
+        if(nVecRows < nRows)
+            findLeavesCommon<double>(x + nVecRows*nCols, nRows - nVecRows, nCols, fi, lc, fv, leaf + nVecRows);
+    }
+};
+
+#elif __CPUID__(DAAL_CPU) == __avx2__
+/* 8 (float) or 4 (double) observations are advanced through the tree with one vector of node indices */
+template <>
+struct FlatTreeTraversal<float, DAAL_CPU>
+{
+    typedef FlatForest<float>::IndexType IndexType;
+    static void findLeaves(const float* x, size_t nRows, size_t nCols,
+        const IndexType* fi, const IndexType* lc, const float* fv, IndexType* leaf)
+    {
+        const size_t nVecRows = nRows - nRows % 8;
+        const __m256i rowOffset = _mm256_mullo_epi32(_mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0), _mm256_set1_epi32(int(nCols)));
+        const __m256i minusOne = _mm256_set1_epi32(-1);
+        for(size_t i = 0; i < nVecRows; i += 8)
+        {
+            const float* xi = x + i*nCols;
+            __m256i node = _mm256_setzero_si256();
+            __m256i isSplit = minusOne;
+            for(;;)
+            {
+                const __m256i feature = _mm256_mask_i32gather_epi32(minusOne, fi, node, isSplit, 4);
+                isSplit = _mm256_andnot_si256(_mm256_cmpeq_epi32(feature, minusOne), isSplit);
+                if(_mm256_testz_si256(isSplit, isSplit))
+                    break;
+                const __m256 splitMask = _mm256_castsi256_ps(isSplit);
+                const __m256 splitValue = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), fv, node, splitMask, 4);
+                const __m256 value = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), xi, _mm256_add_epi32(rowOffset, feature), splitMask, 4);
+                const __m256i left = _mm256_mask_i32gather_epi32(node, lc, node, isSplit, 4);
+                const __m256i isRight = _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(value, splitValue, _CMP_GT_OQ)), isSplit);
+                /* isRight lanes are equal to -1 */
+                node = _mm256_sub_epi32(_mm256_blendv_epi8(node, left, isSplit), isRight);
+            }
+            _mm256_storeu_si256((__m256i*)(leaf + i), node);
+        }
+        if(nVecRows < nRows)
+            findLeavesCommon<float>(x + nVecRows*nCols, nRows - nVecRows, nCols, fi, lc, fv, leaf + nVecRows);
+    }
+};
+
+template <>
+struct FlatTreeTraversal<double, DAAL_CPU>
+{
+    typedef FlatForest<double>::IndexType IndexType;
+    static void findLeaves(const double* x, size_t nRows, size_t nCols,
+        const IndexType* fi, const IndexType* lc, const double* fv, IndexType* leaf)
+    {
+        const size_t nVecRows = nRows - nRows % 4;
+        const __m128i rowOffset = _mm_mullo_epi32(_mm_set_epi32(3, 2, 1, 0), _mm_set1_epi32(int(nCols)));
+        const __m128i minusOne = _mm_set1_epi32(-1);
+        /* packs the lower halves of 64-bit lanes into the lower 128 bits */
+        const __m256i packMask = _mm256_set_epi32(7, 5, 3, 1, 6, 4, 2, 0);
+        for(size_t i = 0; i < nVecRows; i += 4)
+        {
+            const double* xi = x + i*nCols;
+            __m128i node = _mm_setzero_si128();
+            __m128i isSplit = minusOne;
+            for(;;)
+            {
+                const __m128i feature = _mm_mask_i32gather_epi32(minusOne, fi, node, isSplit, 4);
+                isSplit = _mm_andnot_si128(_mm_cmpeq_epi32(feature, minusOne), isSplit);
+                if(_mm_testz_si128(isSplit, isSplit))
+                    break;
+                const __m256d splitMask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(isSplit));
+                const __m256d splitValue = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), fv, node, splitMask, 8);
+                const __m256d value = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), xi, _mm_add_epi32(rowOffset, feature), splitMask, 8);
+                const __m128i left = _mm_mask_i32gather_epi32(node, lc, node, isSplit, 4);
+                const __m256i isRight64 = _mm256_castpd_si256(_mm256_and_pd(_mm256_cmp_pd(value, splitValue, _CMP_GT_OQ), splitMask));
+                const __m128i isRight = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(isRight64, packMask));
+                node = _mm_sub_epi32(_mm_blendv_epi8(node, left, isSplit), isRight);
+            }
+            _mm_storeu_si128((__m128i*)(leaf + i), node);
+        }
+        if(nVecRows < nRows)
+            findLeavesCommon<double>(x + nVecRows*nCols, nRows - nVecRows, nCols, fi, lc, fv, leaf + nVecRows);
+    }
+};
+#endif
+#endif /* defined (__INTEL_COMPILER) */
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
@@ -164,6 +164,15 @@ public:
         return val;
     }
 
+    //returns the split value for the feature value given by its index in the indexed features:
+    //the right border of the bin for a binned feature or the value in the given row otherwise
+    algorithmFPType getSplitValue(size_t iCol, size_t iRow, size_t iIndex) const
+    {
+        if(_indexedFeatures && _indexedFeatures->isBinned(iCol))
+            return algorithmFPType(_indexedFeatures->binRightBorder(iCol, iIndex));
+        return getValue(iCol, iRow);
+    }
+
 protected:
     const dtrees::internal::IndexedFeatures* _indexedFeatures;
     const algorithmFPType* _dataDirect = nullptr;
@@ -113,6 +113,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::size();
 }
 
+services::Status ModelImpl::exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const
+{
+    return ImplType::exportTrees(iFirstTree, nTrees, true, trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, classifier::TreeNodeVisitor& visitor) const
 {
     if(iTree >= size())
@@ -227,6 +232,7 @@ bool ModelImpl::add(const TreeType& tree)
 {
     DAAL_CHECK_STATUS_VAR(!(size() >= _serializationData->size()));
     size_t i = _nTree.inc();
+    updateVersion();
     const size_t nNode = tree.getNumberOfNodes();
 
     auto pTbl           = new DecisionTreeTable(nNode);
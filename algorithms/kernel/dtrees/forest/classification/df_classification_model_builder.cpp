@@ -58,21 +58,33 @@ services::Status ModelBuilder::initialize(size_t nClasses, size_t nTrees)
 services::Status ModelBuilder::createTreeInternal(size_t nNodes, TreeId& resId)
 {
     decision_forest::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl,ModelPtr>(_model);
+    modelImplRef.updateVersion();
     return daal::algorithms::dtrees::internal::createTreeInternal(modelImplRef._serializationData, nNodes, resId);
 }
 
 services::Status ModelBuilder::addLeafNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t classLabel, NodeId& res)
 {
     decision_forest::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl,ModelPtr>(_model);
+    modelImplRef.updateVersion();
     return daal::algorithms::dtrees::internal::addLeafNodeInternal<size_t>(modelImplRef._serializationData, treeId, parentId, position, classLabel, res);
 }
 
 services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t featureIndex, double featureValue, NodeId& res)
 {
     decision_forest::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl,ModelPtr>(_model);
+    modelImplRef.updateVersion();
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+    const size_t* leftChildren, const size_t* rightChildren, const double* values, TreeId& resId)
+{
+    decision_forest::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl,ModelPtr>(_model);
+    modelImplRef.updateVersion();
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, 0, modelImplRef._serializationData->size(), nTrees,
+        treeOffsets, featureIndexes, leftChildren, rightChildren, values, true, resId);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
@@ -54,8 +54,6 @@ namespace prediction
 namespace internal
 {
 
-typedef int32_t leftOrClassType; /* tree size and number of classes are fit in to 2^31 */
-typedef int32_t featureIndexType;
 #define _DEFAULT_BLOCK_SIZE 32
 #define _DEFAULT_BLOCK_SIZE_COMMON 22
 #define _MIN_TREES_FOR_THREADING 100
@@ -71,6 +69,8 @@ class PredictClassificationTask
 protected:
     typedef dtrees::internal::TreeImpClassification<> TreeType;
     typedef dtrees::prediction::internal::TileDimensions<algorithmFPType> DimType;
+    typedef dtrees::internal::FlatForest<algorithmFPType> FlatForestType;
+    typedef typename FlatForestType::IndexType IndexType; /* tree size and number of classes are fit in to 2^31 */
     typedef daal::tls<ClassIndexType *> ClassesCounterTlsBase;
     class ClassesCounterTls : public ClassesCounterTlsBase
     {
@@ -97,10 +97,9 @@ public:
 
 protected:
     void predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, ClassIndexType* res);
-    void predictByTree(const algorithmFPType* x, size_t sizeOfBlock, size_t nCols, const featureIndexType* tFI, const leftOrClassType* tLC, const algorithmFPType* tFV, ClassIndexType* res);
-    void predictByTreeCommon(const algorithmFPType* x, size_t sizeOfBlock, size_t nCols, const featureIndexType* tFI, const leftOrClassType* tLC, const algorithmFPType* tFV, ClassIndexType* res);
+    void predictByTree(const algorithmFPType* x, size_t sizeOfBlock, size_t nCols, const IndexType* tFI, const IndexType* tLC, const algorithmFPType* tFV, ClassIndexType* res);
 
-    void parallelPredict(const algorithmFPType* aX, const DecisionTreeNode* aNode, size_t treeSize, size_t nBlocks, size_t nCols, size_t blockSize, size_t residualSize, ClassIndexType* bufVal);
+    void parallelPredict(const algorithmFPType* aX, size_t iTree, size_t nBlocks, size_t nCols, size_t blockSize, size_t residualSize, ClassIndexType* bufVal);
     Status predictByAllTrees(size_t nTreesTotal, const DimType& dim);
     Status predictAllPointsByAllTrees(size_t nTreesTotal);
     Status predictByBlocksOfTrees(services::HostAppIface* pHostApp,
@@ -110,33 +109,10 @@ protected:
         return services::internal::getMaxElementIndex<ClassIndexType, cpu>(counts, _nClasses);
     }
 
-    DAAL_FORCEINLINE void predictByTreeInternal(size_t check, size_t blockSize, size_t nCols, uint32_t* currentNodes, bool* isSplits, const algorithmFPType* x, const featureIndexType* fi, const leftOrClassType* lc, const algorithmFPType* fv, ClassIndexType* res)
-    {
-            for(;check > 0;)
-            {
-                check = 0;
-                for(size_t i = 0; i < blockSize; i++)
-                {
-                    const algorithmFPType* currentSample = x + i * nCols;
-                    const uint32_t cnIdx = currentNodes[i];
-                    size_t idx = isSplits[i] * fi[cnIdx];
-                    bool sn = currentSample[idx] > fv[cnIdx];
-                    currentNodes[i] -= isSplits[i] * (cnIdx - lc[cnIdx] - sn);
-                    isSplits[i] = (fi[currentNodes[i]] != -1);
-                    check += isSplits[i];
-                }
-            }
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for(size_t i = 0; i < blockSize; i++)
-            {
-                const size_t cl = lc[currentNodes[i]];
-                res[i*_nClasses + cl]++;
-            }
-    }
 protected:
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const dtrees::internal::DecisionTreeTable*, cpu> _aTree;
+    services::SharedPtr<const FlatForestType> _flatForest;
     const NumericTable* _data;
     NumericTable* _res;
     const dtrees::internal::ModelImpl* _model;
@@ -171,25 +147,12 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(size_t iFir
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType* aX, const DecisionTreeNode* aNode, size_t treeSize, size_t nBlocks,
+void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType* aX, size_t iTree, size_t nBlocks,
                      size_t nCols, size_t blockSize, size_t residualSize, ClassIndexType* bufVal)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu>  tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu>  tFV(treeSize);
-
-    featureIndexType* fi =  tFI.get();
-    leftOrClassType* lc  =  tLC.get();
-    algorithmFPType* fv  =  tFV.get();
-
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for(size_t i = 0; i < treeSize; i++)
-    {
-        fi[i] = aNode[i].featureIndex;
-        lc[i] = aNode[i].leftIndexOrClass;
-        fv[i] = (algorithmFPType)aNode[i].featureValueOrResponse;
-    }
+    const IndexType* fi = _flatForest->featureIndex(iTree);
+    const IndexType* lc = _flatForest->leftIndexOrClass(iTree);
+    const algorithmFPType* fv = _flatForest->featureValue(iTree);
 
     daal::threader_for(nBlocks,nBlocks,[&,nCols](size_t iBlock){
        predictByTree(aX + iBlock*blockSize*nCols, blockSize, nCols, fi, lc, fv, bufVal + iBlock*blockSize*_nClasses);
@@ -202,163 +165,20 @@ void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algo
 
 }
 
-template <typename algorithmFPType, CpuType cpu>
-void PredictClassificationTask<algorithmFPType, cpu>::predictByTreeCommon(const algorithmFPType* x, const size_t sizeOfBlock, const size_t nCols,
-                                                      const featureIndexType* fi, const leftOrClassType* lc, const algorithmFPType* fv, ClassIndexType* res)
-{
-    size_t check = 0;
-    check = fi[0] != -1;
-
-    /* done for unrollig */
-    if(sizeOfBlock == _DEFAULT_BLOCK_SIZE_COMMON)
-    {
-        uint32_t currentNodes[_DEFAULT_BLOCK_SIZE_COMMON];
-        bool isSplits[_DEFAULT_BLOCK_SIZE_COMMON];
-        services::internal::service_memset_seq<uint32_t, avx512>(currentNodes, uint32_t(0), _DEFAULT_BLOCK_SIZE_COMMON);
-        services::internal::service_memset_seq<bool, avx512>(isSplits, bool(1), _DEFAULT_BLOCK_SIZE_COMMON);
-        predictByTreeInternal(check, _DEFAULT_BLOCK_SIZE_COMMON, nCols, currentNodes, isSplits, x, fi, lc, fv, res);
-    }
-    else
-    {
-        services::internal::TArray<uint32_t, cpu> currentNodesT(sizeOfBlock);
-        services::internal::TArray<bool, cpu> isSplitsT(sizeOfBlock);
-        uint32_t* const currentNodes = currentNodesT.get();
-        bool* isSplits = isSplitsT.get();
-        if(isSplits && currentNodes)
-        {
-            services::internal::service_memset_seq<uint32_t, avx512>(currentNodes, uint32_t(0), sizeOfBlock);
-            services::internal::service_memset_seq<bool, avx512>(isSplits, bool(1), sizeOfBlock);
-            predictByTreeInternal(check, sizeOfBlock, nCols, currentNodes, isSplits, x, fi, lc, fv, res);
-        }
-    }
-}
-
 template <typename algorithmFPType, CpuType cpu>
 void PredictClassificationTask<algorithmFPType, cpu>::predictByTree(const algorithmFPType* x, const size_t sizeOfBlock, const size_t nCols,
-    const featureIndexType* tFI, const leftOrClassType* tLC, const algorithmFPType* tFV, ClassIndexType* res)
+    const IndexType* fi, const IndexType* lc, const algorithmFPType* fv, ClassIndexType* res)
 {
-    predictByTreeCommon(x, sizeOfBlock, nCols, tFI, tLC, tFV, res);
-}
-
-#if defined (__INTEL_COMPILER)
-template <>
-void PredictClassificationTask<float, avx512>::predictByTree(const float* x, const size_t sizeOfBlock, const size_t nCols, const featureIndexType* feat_idx,
-    const leftOrClassType* left_son, const float* split_point, ClassIndexType* res)
-{
-    if(sizeOfBlock == _DEFAULT_BLOCK_SIZE)
+    DAAL_ASSERT(sizeOfBlock <= _DEFAULT_BLOCK_SIZE);
+    IndexType leaf[_DEFAULT_BLOCK_SIZE];
+    dtrees::prediction::internal::FlatTreeTraversal<algorithmFPType, cpu>::findLeaves(x, sizeOfBlock, nCols, fi, lc, fv, leaf);
+    for(size_t i = 0; i < sizeOfBlock; i++)
     {
-        uint32_t idx[_DEFAULT_BLOCK_SIZE];
-        services::internal::service_memset_seq<uint32_t, avx512>(idx, uint32_t(0), _DEFAULT_BLOCK_SIZE);
-
-        __mmask16 isSplit = 0xffff;
-
-        __m512i offset = _mm512_set_epi32(15*nCols, 14*nCols, 13*nCols,12*nCols, 11*nCols, 10*nCols, 9*nCols, 8*nCols,
-                                          7*nCols, 6*nCols, 5*nCols, 4*nCols, 3*nCols, 2*nCols, nCols, 0);
-
-        __mmask16 checkMask = feat_idx[0] != -1;
-
-        __m512i nOne = _mm512_set1_epi32(-1);
-        __m512i zero = _mm512_set1_epi32(0);
-        __m512 zero_ps = _mm512_set1_ps(0);
-        __m512i one  = _mm512_set1_epi32(1);
-
-        while(checkMask)
-        {
-
-            checkMask = 0x0000;
-            size_t i = 0;
-            for(size_t i = 0; i < _DEFAULT_BLOCK_SIZE; i += 16) {
-                __m512i idxr =_mm512_castps_si512(_mm512_loadu_ps((float*)(idx + i)));
-                __m512  sp   = _mm512_i32gather_ps(idxr, split_point, 4);
-
-                __m512i left = _mm512_i32gather_epi32(idxr, left_son, 4);
-
-                __m512i fi   = _mm512_i32gather_epi32(idxr, feat_idx, 4);
-
-                isSplit = _mm512_cmp_epi32_mask(fi, nOne, _MM_CMPINT_NE);
-
-                __m512 X  = _mm512_mask_i32gather_ps(zero_ps, isSplit, _mm512_add_epi32(offset, fi), x + i*nCols, 4);
-
-                __mmask16 res = _mm512_cmp_ps_mask(X, sp, _CMP_GT_OS);
-                __m512i next_indexes = _mm512_mask_add_epi32(zero, res, one, zero);
-                __m512i reservedLeft = _mm512_add_epi32(next_indexes, left);
-
-                _mm512_mask_storeu_epi32(idx + i, isSplit, reservedLeft);
-
-                checkMask =  _kor_mask16(checkMask, isSplit);
-            }
-        }
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for(size_t i = 0; i < sizeOfBlock; i++)
-        {
-            const size_t cl = left_son[idx[i]];
-            res[i*_nClasses + cl]++;
-        }
-    }
-    else
-    {
-        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, res);
+        const size_t cl = lc[leaf[i]];
+        res[i*_nClasses + cl]++;
     }
 }
 
-
-template <>
-void PredictClassificationTask<double, avx512>::predictByTree(const double* x, const size_t sizeOfBlock, const size_t nCols,
-    const featureIndexType* feat_idx, const leftOrClassType* left_son, const double* split_point, ClassIndexType* res)
-{
-    if(sizeOfBlock == _DEFAULT_BLOCK_SIZE)
-    {
-        uint32_t idx[_DEFAULT_BLOCK_SIZE];
-        services::internal::service_memset_seq<uint32_t, avx512>(idx, uint32_t(0), _DEFAULT_BLOCK_SIZE);
-
-        __mmask8 isSplit = 1;
-
-        __m256i offset = _mm256_set_epi32(7*nCols, 6*nCols, 5*nCols, 4*nCols, 3*nCols, 2*nCols, nCols, 0);
-
-        __mmask8 checkMask = feat_idx[0] != -1;
-
-        while(checkMask)
-        {
-            checkMask = 0;
-            size_t i = 0;
-            for(size_t i = 0; i < _DEFAULT_BLOCK_SIZE; i += 8) {
-                __m256i idxr = _mm256_castps_si256(_mm256_loadu_ps((float*)(idx + i)));
-                __m512d sp   = _mm512_i32gather_pd(idxr, split_point, 8);
-
-                __m256i left = _mm256_i32gather_epi32(left_son, idxr, 4);
-
-                __m256i fi   = _mm256_i32gather_epi32(feat_idx, idxr, 4);
-
-                isSplit = _mm256_cmp_epi32_mask(fi, _mm256_set1_epi32(-1), _MM_CMPINT_NE);
-
-                __m512d X  = _mm512_mask_i32gather_pd(_mm512_set1_pd(0), isSplit, _mm256_add_epi32(offset, fi), x + i*nCols, 8);
-
-                __mmask8 res = _mm512_cmp_pd_mask(X, sp, _CMP_GT_OS);
-
-                __m256i next_indexes = _mm256_mask_add_epi32(_mm256_set1_epi32(0), res, _mm256_set1_epi32(1), _mm256_set1_epi32(0));
-                __m256i reservedLeft = _mm256_add_epi32(next_indexes, left);
-
-                _mm256_mask_storeu_epi32(idx + i, isSplit, reservedLeft);
-
-                checkMask =  _kor_mask8(checkMask, isSplit);
-            }
-        }
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for(size_t i = 0; i < sizeOfBlock; i++)
-        {
-            const size_t cl = left_son[idx[i]];
-            res[i*_nClasses + cl]++;
-        }
-    }
-    else
-    {
-        predictByTreeCommon(x, sizeOfBlock, nCols, feat_idx, left_son, split_point, res);
-    }
-}
-#endif
-
 template <typename algorithmFPType, CpuType cpu>
 Status PredictClassificationTask<algorithmFPType, cpu>::predictByAllTrees(size_t nTreesTotal,
     const DimType& dim)
@@ -400,7 +220,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
 
     daal::SafeStatus safeStat;
     const size_t nRowsOfRes= _res->getNumberOfRows();
-    const size_t blockSize = cpu == avx512 ? _DEFAULT_BLOCK_SIZE : _DEFAULT_BLOCK_SIZE_COMMON;
+    const size_t blockSize = (cpu == avx512 || cpu == avx2) ? _DEFAULT_BLOCK_SIZE : _DEFAULT_BLOCK_SIZE_COMMON;
     const size_t nBlocks = nRowsOfRes / blockSize;
     const size_t residualSize = nRowsOfRes - nBlocks * blockSize;
 
@@ -420,9 +240,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     {
         daal::threader_for(numberOfTrees, numberOfTrees, [&,nCols](const size_t iTree)
         {
-            const size_t treeSize = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode* aNode = (const DecisionTreeNode*)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, tlsData.local());
+            parallelPredict(aX, iTree, nBlocks, nCols, blockSize, residualSize, tlsData.local());
         });
         if(threader_get_threads_number())
         {
@@ -442,9 +260,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     {
         for(size_t iTree = 0; iTree < numberOfTrees; iTree++)
         {
-            const size_t treeSize = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode* aNode = (const DecisionTreeNode*)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, commonBufVal);
+            parallelPredict(aX, iTree, nBlocks, nCols, blockSize, residualSize, commonBufVal);
         }
     }
 
@@ -468,8 +284,10 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         averageTreeSize += _aTree[i]->getNumberOfRows();
     }
     averageTreeSize = averageTreeSize / nTreesTotal;
+    if(!_featHelper.hasUnorderedFeatures())
+        _flatForest = _model->getFlatForest<algorithmFPType>();
 
-    if(_featHelper.hasUnorderedFeatures() || (_res->getNumberOfRows() < averageTreeSize*_SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
+    if(!_flatForest.get() || (_res->getNumberOfRows() < averageTreeSize*_SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
         || (_res->getNumberOfRows() < _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE && daal::threader_get_threads_number() == 1))
     {
         const auto treeSize = _aTree[0]->getNumberOfRows()*sizeof(dtrees::internal::DecisionTreeNode);
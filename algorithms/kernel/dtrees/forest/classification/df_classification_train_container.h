@@ -30,6 +30,7 @@
 #include "df_classification_train_kernel.h"
 #include "df_classification_model_impl.h"
 #include "service_algo_utils.h"
+#include "daal_strings.h"
 
 namespace daal
 {
@@ -41,6 +42,21 @@ namespace classification
 {
 namespace training
 {
+namespace internal
+{
+/* Checks the parameters of the training that depend on the training data */
+inline services::Status checkComputeParams(const decision_forest::training::Parameter &par, const NumericTable *x)
+{
+    const size_t nFeatures = x->getNumberOfColumns();
+    DAAL_CHECK_EX(par.featuresPerNode <= nFeatures,
+        services::ErrorIncorrectParameter, services::ParameterName, featuresPerNodeStr());
+    const size_t nSamplesPerTree(par.observationsPerTreeFraction*x->getNumberOfRows());
+    DAAL_CHECK_EX(nSamplesPerTree > 0,
+        services::ErrorIncorrectParameter, services::ParameterName, observationsPerTreeFractionStr());
+    return services::Status();
+}
+}
+
 namespace interface1
 {
 
@@ -72,7 +88,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, nullptr, nullptr, *m, *result, *par);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -106,20 +122,23 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
+    const decision_forest::classification::Model *mInit = input->get(inputModel).get();
+    const tree_utils::BinnedFeatures *xBinned = input->get(binnedFeatures).get();
 
     decision_forest::classification::Model *m = result->get(classifier::training::model).get();
 
-    const decision_forest::classification::training::Parameter *par =
-        static_cast<decision_forest::classification::training::Parameter*>(_par);
+    typedef typename decision_forest::classification::training::MethodParameter<method>::Type ParameterType;
+    const ParameterType *par = static_cast<ParameterType*>(_par);
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, mInit, xBinned, *m, *result, *par,
+        internal::histParameter(par));
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -22,7 +22,6 @@
 */
 
 #include "df_classification_train_container.h"
-#include "daal_strings.h"
 
 namespace daal
 {
@@ -46,14 +45,7 @@ DAAL_EXPORT services::Status interface1::Batch<DAAL_FPTYPE, decision_forest::cla
     services::Status s = classifier::training::interface1::Batch::checkComputeParams();
     if(!s)
         return s;
-    const auto x = input.get(classifier::training::data);
-    const auto nFeatures = x->getNumberOfColumns();
-    DAAL_CHECK_EX(parameter.featuresPerNode <= nFeatures,
-        services::ErrorIncorrectParameter, services::ParameterName, featuresPerNodeStr());
-    const size_t nSamplesPerTree(parameter.observationsPerTreeFraction*x->getNumberOfRows());
-    DAAL_CHECK_EX(nSamplesPerTree > 0,
-        services::ErrorIncorrectParameter, services::ParameterName, observationsPerTreeFractionStr());
-    return s;
+    return internal::checkComputeParams(parameter, input.get(classifier::training::data).get());
 }
 }
 namespace interface2
@@ -64,14 +56,7 @@ DAAL_EXPORT services::Status Batch<DAAL_FPTYPE, decision_forest::classification:
     services::Status s = classifier::training::Batch::checkComputeParams();
     if(!s)
         return s;
-    const auto x = input.get(classifier::training::data);
-    const auto nFeatures = x->getNumberOfColumns();
-    DAAL_CHECK_EX(parameter.featuresPerNode <= nFeatures,
-        services::ErrorIncorrectParameter, services::ParameterName, featuresPerNodeStr());
-    const size_t nSamplesPerTree(parameter.observationsPerTreeFraction*x->getNumberOfRows());
-    DAAL_CHECK_EX(nSamplesPerTree > 0,
-        services::ErrorIncorrectParameter, services::ParameterName, observationsPerTreeFractionStr());
-    return s;
+    return internal::checkComputeParams(parameter, input.get(classifier::training::data).get());
 }
 }
 }
@@ -563,7 +563,7 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
 
     DAAL_ASSERT(iRowSplitVal >= 0);
     bestSplit.iStart = 0;
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #else
 template <typename algorithmFPType, CpuType cpu>
@@ -689,7 +689,7 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     DAAL_ASSERT(iLeft == bestSplit.nLeft);
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #endif
 
@@ -792,7 +792,7 @@ public:
         const dtrees::internal::FeatureTypes& featTypes,
         const dtrees::internal::IndexedFeatures* indexedFeatures,
         typename super::ThreadCtxType& ctx, size_t dummy) :
-        super(pHostApp, x, y, par, featTypes, indexedFeatures, ctx, dummy)
+        super(pHostApp, x, y, par, featTypes, indexedFeatures, ctx, dummy, method == decision_forest::classification::training::hist)
     {
         if(!this->_nFeaturesPerNode)
         {
@@ -807,8 +807,8 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface* pHostApp,
-    const NumericTable *x, const NumericTable *y, decision_forest::classification::Model& m,
-    Result& res,
+    const NumericTable *x, const NumericTable *y, const decision_forest::classification::Model *mInit,
+    const tree_utils::BinnedFeatures *xBinned, decision_forest::classification::Model& m, Result& res,
     const decision_forest::classification::training::interface1::Parameter& par)
 {
     Parameter tmpPar(par.nClasses);
@@ -824,21 +824,24 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.resultsToCompute = par.resultsToCompute;
     tmpPar.memorySavingMode = par.memorySavingMode;
     tmpPar.bootstrap = par.bootstrap;
-    return compute(pHostApp, x, y, m, res, tmpPar);
+    //the deprecated interface trains the 'hist' method with the default binning parameters
+    const decision_forest::training::HistParameter histPar;
+    return compute(pHostApp, x, y, mInit, xBinned, m, res, tmpPar, method == hist ? &histPar : nullptr);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface* pHostApp,
-    const NumericTable *x, const NumericTable *y, decision_forest::classification::Model& m,
-    Result& res,
-    const decision_forest::classification::training::Parameter& par)
+    const NumericTable *x, const NumericTable *y, const decision_forest::classification::Model *mInit,
+    const tree_utils::BinnedFeatures *xBinned, decision_forest::classification::Model& m, Result& res,
+    const decision_forest::classification::training::Parameter& par, const decision_forest::training::HistParameter *histPar)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
     services::Status s = computeImpl<algorithmFPType, cpu,
         daal::algorithms::decision_forest::classification::internal::ModelImpl,
         TrainBatchTask<algorithmFPType, method, cpu> >
         (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl*>(&m),
-        rd, par, par.nClasses);
+        rd, par, par.nClasses, histPar, static_cast<const daal::algorithms::decision_forest::classification::internal::ModelImpl*>(mInit),
+        xBinned);
     if(s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -0,0 +1,54 @@
+/* file: df_classification_train_hist_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest training functions for the histogram method
+//--
+*/
+
+#include "df_classification_train_container.h"
+#include "df_classification_train_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
+}
+namespace interface2
+{
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
+}
+
+namespace internal
+{
+template class ClassificationTrainBatchKernel<DAAL_FPTYPE, hist, DAAL_CPU>;
+}
+}
+}
+}
+}
+}
@@ -50,14 +50,18 @@ class ClassificationTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-        decision_forest::classification::Model& m,
-        Result& res, const decision_forest::classification::training::interface1::Parameter& par);
+        const decision_forest::classification::Model *mInit, const tree_utils::BinnedFeatures *xBinned,
+        decision_forest::classification::Model& m, Result& res, const decision_forest::classification::training::interface1::Parameter& par);
     services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-        decision_forest::classification::Model& m,
-        Result& res, const decision_forest::classification::training::Parameter& par);
-
+        const decision_forest::classification::Model *mInit, const tree_utils::BinnedFeatures *xBinned,
+        decision_forest::classification::Model& m, Result& res, const decision_forest::classification::training::Parameter& par,
+        const decision_forest::training::HistParameter *histPar);
 };
 
+/* Returns the parameters specific to the 'hist' training method or nullptr for other methods */
+inline const decision_forest::training::HistParameter* histParameter(const Parameter *) { return nullptr; }
+inline const decision_forest::training::HistParameter* histParameter(const HistParameter *par) { return par; }
+
 } // namespace internal
 }
 }
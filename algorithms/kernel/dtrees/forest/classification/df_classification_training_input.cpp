@@ -0,0 +1,91 @@
+/* file: df_classification_training_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest classification training input class.
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_classification_training_types.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+
+Input::Input() : classifier::training::Input(lastInputBinnedFeaturesId + 1) {}
+
+decision_forest::classification::ModelPtr Input::get(InputModelId id) const
+{
+    return staticPointerCast<decision_forest::classification::Model, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(InputModelId id, const decision_forest::classification::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+tree_utils::BinnedFeaturesPtr Input::get(InputBinnedFeaturesId id) const
+{
+    return staticPointerCast<tree_utils::BinnedFeatures, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value)
+{
+    Argument::set(id, value);
+}
+
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(par, method));
+
+    const decision_forest::classification::ModelPtr m = get(inputModel);
+    if(m)
+    {
+        DAAL_CHECK_EX(m->getNumberOfFeatures() == this->getNumberOfFeatures(), ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+    }
+
+    const tree_utils::BinnedFeaturesPtr bf = get(binnedFeatures);
+    if(bf)
+    {
+        DAAL_CHECK_EX(bf->getNumberOfFeatures() == this->getNumberOfFeatures(), ErrorIncorrectNumberOfFeatures, ArgumentName, binnedFeaturesStr());
+        DAAL_CHECK_EX(bf->getNumberOfRows() == classifier::training::Input::get(classifier::training::data)->getNumberOfRows(),
+            ErrorIncorrectNumberOfObservations, ArgumentName, binnedFeaturesStr());
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
@@ -35,7 +35,11 @@ namespace algorithms
 namespace decision_forest
 {
 
-namespace training { services::Status checkImpl(const decision_forest::training::Parameter& prm); }
+namespace training
+{
+services::Status checkImpl(const decision_forest::training::Parameter& prm);
+services::Status checkImpl(const decision_forest::training::HistParameter& prm);
+}
 
 namespace classification
 {
@@ -129,6 +133,14 @@ services::Status Parameter::check() const
     DAAL_CHECK_STATUS(s, decision_forest::training::checkImpl(*this));
     return s;
 }
+
+services::Status HistParameter::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, Parameter::check());
+    DAAL_CHECK_STATUS(s, decision_forest::training::checkImpl(static_cast<const decision_forest::training::HistParameter&>(*this)));
+    return s;
+}
 }
 
 } // namespace training
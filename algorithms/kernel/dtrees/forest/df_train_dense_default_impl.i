@@ -28,6 +28,7 @@
 #include "dtrees_train_data_helper.i"
 #include "threading.h"
 #include "dtrees_model_impl.h"
+#include "dtrees_binned_features_impl.h"
 #include "engine_types_internal.h"
 #include "service_defines.h"
 #include "uniform_kernel.h"
@@ -248,17 +249,30 @@ services::Status selectParallelizationTechnique(const Parameter& par, engines::i
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-    ModelType& md, ResultData& res, const Parameter& par, size_t nClasses)
+    ModelType& md, ResultData& res, const Parameter& par, size_t nClasses, const HistParameter* histPar = nullptr,
+    const ModelType* mdInit = nullptr, const tree_utils::BinnedFeatures* xBinned = nullptr)
 {
-    DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
+    //continued training: the trees of the input model are shared with the trained model,
+    //the new trees are stored after them
+    const size_t nInitTrees = mdInit ? mdInit->size() : 0;
+    DAAL_CHECK(md.resize(nInitTrees + par.nTrees), ErrorMemoryAllocationFailed);
+    if(nInitTrees)
+        DAAL_CHECK(md.addTreesOf(*mdInit), ErrorMemoryAllocationFailed);
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK(featTypes.init(*x), ErrorMemoryAllocationFailed);
 
-    dtrees::internal::IndexedFeatures indexedFeatures;
+    //features are indexed once and the index is shared by all trees,
+    //in case of binned features ('hist' method) the index is required regardless of memory saving mode.
+    //The index given in the input binned features is used when built with the same parameters
+    dtrees::internal::IndexedFeatures localIndexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = nullptr;
+    const bool bUseIndexedFeatures = histPar || !par.memorySavingMode;
     services::Status s;
-    if(!par.memorySavingMode)
+    if(bUseIndexedFeatures)
     {
-        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
+        dtrees::internal::BinParams binParams(histPar ? histPar->maxBins : 0, histPar ? histPar->minBinSize : 0);
+        s = dtrees::internal::getIndexedFeatures<algorithmFPType, cpu>(*x, featTypes, histPar ? &binParams : nullptr,
+            xBinned, localIndexedFeatures, pIndexedFeatures);
         DAAL_CHECK_STATUS_VAR(s);
     }
 
@@ -287,7 +301,7 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
     {
         //in case of single thread no need to allocate
         Ctx* ctx = tlsCtx.local();
-        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses) : nullptr;
+        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, pIndexedFeatures, *ctx, nClasses) : nullptr;
     });
 
     engines::internal::ParallelizationTechnique technique = engines::internal::family;
@@ -336,7 +350,7 @@ services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, cons
         task = nullptr;
     });
     DAAL_CHECK_STATUS_VAR(s);
-    DAAL_CHECK_MALLOC(md.size() == par.nTrees);
+    DAAL_CHECK_MALLOC(md.size() == nInitTrees + par.nTrees);
 
     res.updatedEngine = enginesCollection.getUpdatedEngine(par.engine, engines, numElems);
 
@@ -377,7 +391,7 @@ protected:
     TrainBatchTaskBase(HostAppIface* hostApp, const NumericTable *x, const NumericTable *y, const Parameter& par,
         const dtrees::internal::FeatureTypes& featTypes,
         const dtrees::internal::IndexedFeatures* indexedFeatures,
-        ThreadCtxType& threadCtx, size_t nClasses):
+        ThreadCtxType& threadCtx, size_t nClasses, bool bBinnedFeatures = false):
         _hostApp(hostApp, 0), //set granularity later
         _data(x), _resp(y), _par(par), _nClasses(nClasses),
         _nSamples(par.observationsPerTreeFraction*x->getNumberOfRows()),
@@ -387,7 +401,8 @@ protected:
         _nFeatureBufs(1), //for sequential processing
         _featHelper(featTypes),
         _threadCtx(threadCtx),
-        _accuracy(daal::services::internal::EpsilonVal<algorithmFPType>::get())
+        _accuracy(daal::services::internal::EpsilonVal<algorithmFPType>::get()),
+        _bBinnedFeatures(bBinnedFeatures)
     {
         if(_impurityThreshold < _accuracy)
             _impurityThreshold = _accuracy;
@@ -479,6 +494,7 @@ protected:
     ThreadCtxType& _threadCtx;
     size_t _nClasses;
     size_t *_numElems;
+    const bool _bBinnedFeatures; //if true then features are binned and splits are always found with the indexed features
 };
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
@@ -663,8 +679,8 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     for(size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
         const auto iFeature = _aFeatureIdx[i];
-        const bool bUseIndexedFeatures = (!_par.memorySavingMode) &&
-            (fact > qMax*float(_helper.indexedFeatures().numIndices(iFeature)));
+        const bool bUseIndexedFeatures = _bBinnedFeatures || ((!_par.memorySavingMode) &&
+            (fact > qMax*float(_helper.indexedFeatures().numIndices(iFeature))));
 
         if(bUseIndexedFeatures)
         {
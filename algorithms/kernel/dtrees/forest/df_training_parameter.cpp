@@ -54,6 +54,13 @@ Status checkImpl(const decision_forest::training::Parameter& prm)
     return s;
 }
 
+Status checkImpl(const decision_forest::training::HistParameter& prm)
+{
+    DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
+    DAAL_CHECK_EX((prm.minBinSize >= 1), ErrorIncorrectParameter, ParameterName, minBinSizeStr());
+    return Status();
+}
+
 } // namespace training
 } // namespace decision_forest
 } // namespace algorithms
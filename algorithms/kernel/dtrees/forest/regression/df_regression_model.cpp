@@ -63,6 +63,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::size();
 }
 
+services::Status ModelImpl::exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const
+{
+    return ImplType::exportTrees(iFirstTree, nTrees, false, trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const
 {
     if(iTree >= size())
@@ -176,6 +181,7 @@ bool ModelImpl::add(const TreeType& tree)
 {
     DAAL_CHECK_STATUS_VAR(!(size() >= _serializationData->size()));
     size_t i = _nTree.inc();
+    updateVersion();
     const size_t nNode = tree.getNumberOfNodes();
 
     auto pTbl           = new DecisionTreeTable(nNode);
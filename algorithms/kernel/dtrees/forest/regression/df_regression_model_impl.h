@@ -68,6 +68,7 @@ public:
     bool add(const TreeType& tree);
 
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
+    virtual services::Status exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const DAAL_C11_OVERRIDE;
 };
 
 } // namespace internal
@@ -88,6 +88,8 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
+    if(!this->_featHelper.hasUnorderedFeatures())
+        this->_flatForest = m->getFlatForest<algorithmFPType>();
     const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
     return super::run(pHostApp, div);
 }
@@ -62,14 +62,18 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     const NumericTable *x = input->get(data).get();
     const NumericTable *y = input->get(dependentVariable).get();
+    const decision_forest::regression::Model *mInit = input->get(inputModel).get();
+    const tree_utils::BinnedFeatures *xBinned = input->get(binnedFeatures).get();
 
     decision_forest::regression::Model *m = result->get(model).get();
 
-    const Parameter *par = static_cast<decision_forest::regression::training::Parameter*>(_par);
+    typedef typename MethodParameter<method>::Type ParameterType;
+    const ParameterType *par = static_cast<ParameterType*>(_par);
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, mInit, xBinned, *m, *result, *par,
+        internal::histParameter(par));
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
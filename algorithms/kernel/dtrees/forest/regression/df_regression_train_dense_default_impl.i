@@ -326,7 +326,7 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType*
     bestSplit.left.var *= divL;
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -588,7 +588,7 @@ public:
         const dtrees::internal::FeatureTypes& featTypes,
         const dtrees::internal::IndexedFeatures* indexedFeatures,
         typename super::ThreadCtxType& ctx, size_t dummy) :
-        super(hostApp, x, y, par, featTypes, indexedFeatures, ctx, dummy)
+        super(hostApp, x, y, par, featTypes, indexedFeatures, ctx, dummy, method == decision_forest::regression::training::hist)
     {
         if(!this->_nFeaturesPerNode)
         {
@@ -603,14 +603,17 @@ public:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, decision_forest::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface* pHostApp,
-    const NumericTable *x, const NumericTable *y, decision_forest::regression::Model& m, Result& res, const Parameter& par)
+    const NumericTable *x, const NumericTable *y, const decision_forest::regression::Model *mInit,
+    const tree_utils::BinnedFeatures *xBinned, decision_forest::regression::Model& m, Result& res, const Parameter& par,
+    const decision_forest::training::HistParameter *histPar)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
     services::Status s = computeImpl<algorithmFPType, cpu,
         daal::algorithms::decision_forest::regression::internal::ModelImpl,
         TrainBatchTask<algorithmFPType, method, cpu> >
         (pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl*>(&m),
-        rd, par, 0);
+        rd, par, 0, histPar, static_cast<const daal::algorithms::decision_forest::regression::internal::ModelImpl*>(mInit),
+        xBinned);
     if(s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
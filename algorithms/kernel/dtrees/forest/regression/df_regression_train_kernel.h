@@ -50,9 +50,15 @@ class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-        decision_forest::regression::Model& m, Result& res, const Parameter& par);
+        const decision_forest::regression::Model *mInit, const tree_utils::BinnedFeatures *xBinned,
+        decision_forest::regression::Model& m, Result& res, const Parameter& par,
+        const decision_forest::training::HistParameter *histPar);
 };
 
+/* Returns the parameters specific to the 'hist' training method or nullptr for other methods */
+inline const decision_forest::training::HistParameter* histParameter(const Parameter *) { return nullptr; }
+inline const decision_forest::training::HistParameter* histParameter(const HistParameter *par) { return par; }
+
 } // namespace internal
 }
 }
@@ -33,7 +33,11 @@ namespace algorithms
 {
 namespace decision_forest
 {
-namespace training { Status checkImpl(const decision_forest::training::Parameter& prm); }
+namespace training
+{
+Status checkImpl(const decision_forest::training::Parameter& prm);
+Status checkImpl(const decision_forest::training::HistParameter& prm);
+}
 
 namespace regression
 {
@@ -48,8 +52,17 @@ Status Parameter::check() const
     return decision_forest::training::checkImpl(*this);
 }
 
+HistParameter::HistParameter(){}
+Status HistParameter::check() const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, Parameter::check());
+    DAAL_CHECK_STATUS(s, decision_forest::training::checkImpl(static_cast<const decision_forest::training::HistParameter&>(*this)));
+    return s;
+}
+
 /** Default constructor */
-Input::Input() : algorithms::regression::training::Input(lastInputId + 1) {}
+Input::Input() : algorithms::regression::training::Input(lastInputBinnedFeaturesId + 1) {}
 
 /**
  * Returns an input object for decision forest model-based training
@@ -71,6 +84,46 @@ void Input::set(InputId id, const NumericTablePtr &value)
     algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
 }
 
+/**
+ * Returns an input model for decision forest model-based training
+ * \param[in] id    Identifier of the input model
+ * \return          %Input model that corresponds to the given identifier
+ */
+decision_forest::regression::ModelPtr Input::get(InputModelId id) const
+{
+    return staticPointerCast<decision_forest::regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input model for decision forest model-based training
+ * \param[in] id      Identifier of the input model
+ * \param[in] value   Pointer to the model
+ */
+void Input::set(InputModelId id, const decision_forest::regression::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Returns the input binned features for decision forest model-based training
+ * \param[in] id    Identifier of the input binned features
+ * \return          %Input binned features that correspond to the given identifier
+ */
+tree_utils::BinnedFeaturesPtr Input::get(InputBinnedFeaturesId id) const
+{
+    return staticPointerCast<tree_utils::BinnedFeatures, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input binned features for decision forest model-based training
+ * \param[in] id      Identifier of the input binned features
+ * \param[in] value   Pointer to the binned features
+ */
+void Input::set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
 * Checks an input object for the decision forest algorithm
 * \param[in] par     Algorithm parameter
@@ -93,6 +146,19 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures,
         ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+
+    const decision_forest::regression::ModelPtr m = get(inputModel);
+    if(m)
+    {
+        DAAL_CHECK_EX(m->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+    }
+
+    const tree_utils::BinnedFeaturesPtr bf = get(binnedFeatures);
+    if(bf)
+    {
+        DAAL_CHECK_EX(bf->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, binnedFeaturesStr());
+        DAAL_CHECK_EX(bf->getNumberOfRows() == dataTable->getNumberOfRows(), ErrorIncorrectNumberOfObservations, ArgumentName, binnedFeaturesStr());
+    }
     return s;
 }
 
@@ -66,6 +66,11 @@ size_t ModelImpl::getNumberOfTrees() const
     return ImplType::numberOfTrees();
 }
 
+services::Status ModelImpl::exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const
+{
+    return ImplType::exportTrees(iFirstTree, nTrees, trees);
+}
+
 void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor& visitor) const
 {
     ImplType::traverseDF(iTree, visitor);
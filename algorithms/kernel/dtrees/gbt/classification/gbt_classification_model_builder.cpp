@@ -128,6 +128,20 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t classLabel, size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+    const size_t* leftChildren, const size_t* rightChildren, const double* values, TreeId& resId)
+{
+    gbt::classification::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl,ModelPtr>(_model);
+    if (classLabel > (_nClasses - 1))
+    {
+        return Status(ErrorID::ErrorIncorrectParameter);
+    }
+    const size_t firstTreeId = (_nClasses == 1) ? 0 : classLabel * _nIterations;
+    const size_t lastTreeId = (_nClasses == 1) ? modelImplRef._serializationData->size() : (classLabel + 1) * _nIterations;
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, firstTreeId, lastTreeId, nTrees, treeOffsets,
+        featureIndexes, leftChildren, rightChildren, values, false, resId);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
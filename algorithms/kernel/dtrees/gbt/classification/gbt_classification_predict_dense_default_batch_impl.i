@@ -75,6 +75,7 @@ public:
         DAAL_CHECK_MALLOC(this->_aTree.get());
         for(size_t i = 0; i < nTreesTotal; ++i)
             this->_aTree[i] = m->at(i);
+        this->initQuickScorer(m);
         const auto nRows = this->_data->getNumberOfRows();
         services::Status s;
         //compute raw boosted values
@@ -199,6 +200,7 @@ protected:
     NumericTable* _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType*, cpu> _aTree;
+    services::SharedPtr<const gbt::internal::QuickScorerForest> _quickScorer; //if set, it is used for the leading blocks of trees
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -230,6 +232,8 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
+    if(!this->_featHelper.hasUnorderedFeatures())
+        this->_quickScorer = m->getQuickScorerForest();
 
     DimType dim(*_data, nTreesTotal);
 
@@ -271,6 +275,19 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
     const size_t nCols(_data->getNumberOfColumns());
     const size_t nRows(_data->getNumberOfRows());
     daal::SafeStatus safeStat;
+
+    /* for the groups of VECTOR_BLOCK_SIZE rows leading blocks of trees are scored by QuickScorer, the rest ones are traversed */
+    typedef gbt::internal::QuickScorerForest::MaskType MaskType;
+    const size_t nQuickScorerBlocks = gbt::prediction::internal::getNumberOfQuickScorerBlocks(_quickScorer.get(), nTreesTotal);
+    const size_t nQuickScorerTrees = nQuickScorerBlocks ? _quickScorer->getNumberOfTreesInBlocks(nQuickScorerBlocks) : 0;
+    daal::TlsMem<MaskType, cpu> tlsMask(nQuickScorerBlocks ?
+        gbt::internal::QuickScorerForest::nTreesInBlock*gbt::prediction::internal::QUICK_SCORER_BLOCK_SIZE : 0);
+    auto predictByQuickScorer = [&](algorithmFPType* val, const algorithmFPType* x, size_t nRowsToPredict, MaskType* aMask)
+    {
+        if(nQuickScorerBlocks)
+            gbt::prediction::internal::predictByQuickScorer<algorithmFPType, cpu>(*_quickScorer, nQuickScorerBlocks,
+                x, nRowsToPredict, nCols, nClasses, val, aMask);
+    };
     if(_prob)
     {
         WriteOnlyRows<algorithmFPType, cpu> probBD(_prob, 0, 1);
@@ -288,12 +305,15 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType* res = resBD.get() ? resBD.get() + iStartRow : nullptr;
+            MaskType* aMask = nQuickScorerBlocks ? tlsMask.local() : nullptr;
+            DAAL_CHECK_MALLOC_THR(aMask || !nQuickScorerBlocks);
 
             size_t iRow = 0;
             for(; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 val = valL + iRow*nClasses;
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow*nCols);
+                predictByQuickScorer(val, xBD.get() + iRow*nCols, VECTOR_BLOCK_SIZE, aMask);
+                predictByTreesVector(val, nQuickScorerTrees, nTreesTotal - nQuickScorerTrees, nClasses, xBD.get() + iRow*nCols);
                 if(res)
                 {
                     for(size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
@@ -326,12 +346,15 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType* res = resBD.get() + iStartRow;
+            MaskType* aMask = nQuickScorerBlocks ? tlsMask.local() : nullptr;
+            DAAL_CHECK_MALLOC_THR(aMask || !nQuickScorerBlocks);
 
             size_t iRow = 0;
             for(; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses*VECTOR_BLOCK_SIZE);
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow*nCols);
+                predictByQuickScorer(val, xBD.get() + iRow*nCols, VECTOR_BLOCK_SIZE, aMask);
+                predictByTreesVector(val, nQuickScorerTrees, nTreesTotal - nQuickScorerTrees, nClasses, xBD.get() + iRow*nCols);
 
                 for(size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
                  {
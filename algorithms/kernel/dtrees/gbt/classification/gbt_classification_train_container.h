@@ -73,7 +73,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, nullptr, nullptr, nullptr, nullptr, *m, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -105,21 +105,36 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
     NumericTable *x = input->get(classifier::training::data).get();
     NumericTable *y = input->get(classifier::training::labels).get();
+    NumericTable *xValid = input->get(validationData).get();
+    NumericTable *yValid = input->get(validationLabels).get();
+    const gbt::classification::Model *mInit = input->get(inputModel).get();
+    const tree_utils::BinnedFeatures *xBinned = input->get(binnedFeatures).get();
 
     gbt::classification::Model *m = result->get(classifier::training::model).get();
 
-    const gbt::classification::training::Parameter *par =
-        static_cast<gbt::classification::training::Parameter*>(_par);
     daal::services::Environment::env &env = *_env;
+
+    /* Algorithms built with the headers of the previous version pass interface2::Parameter */
+    const gbt::classification::training::interface3::Parameter *par =
+        dynamic_cast<const gbt::classification::training::interface3::Parameter*>(_par);
+    if(!par)
+    {
+        const gbt::classification::training::interface2::Parameter *par2 =
+            static_cast<gbt::classification::training::interface2::Parameter*>(_par);
+        daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par2->engine.get());
+
+        __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
+            __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, xValid, yValid, mInit, xBinned, *m, *result, *par2, *engine);
+    }
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, xValid, yValid, mInit, xBinned, *m, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
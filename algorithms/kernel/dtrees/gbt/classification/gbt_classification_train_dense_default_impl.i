@@ -114,6 +114,36 @@ public:
             }
         }
     }
+
+    //L(y,f) = ln(1 + exp(-z)) where z = f for y = 1 and z = -f for y = 0,
+    //computed as max(-z, 0) + ln(1 + exp(-|z|)) to avoid overflow
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f) DAAL_C11_OVERRIDE
+    {
+        if(!n)
+            return algorithmFPType(0);
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu>> aBuf(n);
+        auto buf = aBuf.get();
+        if(!buf)
+            return daal::services::internal::MaxVal<algorithmFPType>::get();
+        const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
+        algorithmFPType sum(0);
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType z = (y[i] > algorithmFPType(0.5) ? f[i] : -f[i]);
+            buf[i] = (z > 0 ? -z : z);
+            if(buf[i] < expThreshold)
+                buf[i] = expThreshold;
+            if(z < 0)
+                sum -= z;
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, buf, buf);
+        daal::internal::Math<algorithmFPType, cpu>::vLog1p(n, buf, buf);
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            sum += buf[i];
+        return sum / algorithmFPType(n);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +183,35 @@ public:
         });
     }
 
+    //L(y,f) = -ln(p[y]) where p = softmax(f)
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f) DAAL_C11_OVERRIDE
+    {
+        if(!n)
+            return algorithmFPType(0);
+        TVector<algorithmFPType, cpu, ScalableAllocator<cpu>> aLoss(n);
+        auto loss = aLoss.get();
+        if(!loss)
+            return daal::services::internal::MaxVal<algorithmFPType>::get();
+        static const size_t s_cMaxClassesBufSize = 12;
+        const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
+        daal::TlsMem<algorithmFPType, cpu> lsData(_nClasses);
+        daal::threader_for(n, n, [&](size_t i)
+        {
+            algorithmFPType buf[s_cMaxClassesBufSize];
+            algorithmFPType* p = bUseTLS ? lsData.local() : buf;
+            const algorithmFPType* fi = f + _nClasses*i;
+            getSoftmax(fi, p);
+            const size_t k = size_t(y[i]);
+            const algorithmFPType pk = (k < _nClasses ? p[k] : algorithmFPType(0));
+            const algorithmFPType minP = daal::services::internal::EpsilonVal<algorithmFPType>::get();
+            loss[i] = -daal::internal::Math<algorithmFPType, cpu>::sLog(pk > minP ? pk : minP);
+        });
+        algorithmFPType sum(0);
+        for(size_t i = 0; i < n; ++i)
+            sum += loss[i];
+        return sum / algorithmFPType(n);
+    }
+
 protected:
     void getSoftmax(const algorithmFPType* arg, algorithmFPType* res) const
     {
@@ -316,8 +375,9 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, Result& res, const interface1::Parameter& par,
-    engines::internal::BatchBaseImpl& engine)
+    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, const NumericTable *xValid, const NumericTable *yValid,
+    const gbt::classification::Model *mInit, const tree_utils::BinnedFeatures *xBinned, gbt::classification::Model& m, Result& res,
+    const interface1::Parameter& par, engines::internal::BatchBaseImpl& engine)
 {
     Parameter tmpPar(par.nClasses);
     tmpPar.splitMethod = par.splitMethod;
@@ -334,26 +394,50 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.minBinSize = par.minBinSize;
     tmpPar.internalOptions = par.internalOptions;
     tmpPar.loss = par.loss;
-    return compute(pHost, x, y, m, res, tmpPar, engine);
+    return compute(pHost, x, y, xValid, yValid, mInit, xBinned, m, res, tmpPar, engine);
 }
 template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, gbt::classification::Model& m, Result& res, const Parameter& par,
-    engines::internal::BatchBaseImpl& engine)
+    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, const NumericTable *xValid, const NumericTable *yValid,
+    const gbt::classification::Model *mInit, const tree_utils::BinnedFeatures *xBinned, gbt::classification::Model& m, Result& res,
+    const interface2::Parameter& par, engines::internal::BatchBaseImpl& engine)
+{
+    Parameter tmpPar(par.nClasses);
+    static_cast<classifier::Parameter&>(tmpPar) = par;
+    static_cast<gbt::training::interface1::Parameter&>(tmpPar) = par;
+    tmpPar.loss = par.loss;
+    return compute(pHost, x, y, xValid, yValid, mInit, xBinned, m, res, tmpPar, engine);
+}
+template <typename algorithmFPType, gbt::classification::training::Method method, CpuType cpu>
+services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(
+    HostAppIface* pHost, const NumericTable *x, const NumericTable *y, const NumericTable *xValid, const NumericTable *yValid,
+    const gbt::classification::Model *mInit, const tree_utils::BinnedFeatures *xBinned, gbt::classification::Model& m, Result& res,
+    const Parameter& par, engines::internal::BatchBaseImpl& engine)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod = !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
 
     services::Status s;
-    dtrees::internal::IndexedFeatures indexedFeatures;
+    dtrees::internal::IndexedFeatures localIndexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = &localIndexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
     if(!par.memorySavingMode)
     {
         BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
+        if(inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+        {
+            //bins of the sparse input are computed per nonzero value, the index of the rows is not built
+            DAAL_CHECK_STATUS(s, (localIndexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, &prm, false)));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, (dtrees::internal::getIndexedFeatures<algorithmFPType, cpu>(*x, featTypes,
+                par.splitMethod == gbt::training::inexact ? &prm : nullptr, xBinned, localIndexedFeatures, pIndexedFeatures)));
+        }
     }
+    const dtrees::internal::IndexedFeatures& indexedFeatures = *pIndexedFeatures;
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
 
@@ -384,25 +468,27 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     algorithmFPType* ptrTotalGain  = totalGainRows.get();
     algorithmFPType* ptrGain       = gainRows.get();
 
+    const gbt::internal::ModelImpl* mdInit = mInit ? static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl*>(mInit) : nullptr;
+
     if(inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
+                (pHost, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
+                (pHost, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>
-                (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
+                (pHost, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>
-            (pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
+            (pHost, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl*>(&m), par, engine, par.nClasses, indexedFeatures, featTypes,
             &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
@@ -51,11 +51,20 @@ class ClassificationTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHost, const NumericTable *x, const NumericTable *y,
+        const NumericTable *xValid, const NumericTable *yValid, const gbt::classification::Model *mInit,
+        const tree_utils::BinnedFeatures *xBinned,
         gbt::classification::Model& m, Result& res, const interface1::Parameter& par,
         engines::internal::BatchBaseImpl& engine);
     services::Status compute(HostAppIface* pHost, const NumericTable *x, const NumericTable *y,
+        const NumericTable *xValid, const NumericTable *yValid, const gbt::classification::Model *mInit,
+        const tree_utils::BinnedFeatures *xBinned,
         gbt::classification::Model& m, Result& res, const interface2::Parameter& par,
         engines::internal::BatchBaseImpl& engine);
+    services::Status compute(HostAppIface* pHost, const NumericTable *x, const NumericTable *y,
+        const NumericTable *xValid, const NumericTable *yValid, const gbt::classification::Model *mInit,
+        const tree_utils::BinnedFeatures *xBinned,
+        gbt::classification::Model& m, Result& res, const interface3::Parameter& par,
+        engines::internal::BatchBaseImpl& engine);
 };
 
 } // namespace internal
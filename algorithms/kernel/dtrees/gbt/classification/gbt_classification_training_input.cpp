@@ -0,0 +1,115 @@
+/* file: gbt_classification_training_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification training input class.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+
+Input::Input() : classifier::training::Input(lastInputBinnedFeaturesId + 1) {}
+
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(InputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+gbt::classification::ModelPtr Input::get(InputModelId id) const
+{
+    return staticPointerCast<gbt::classification::Model, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(InputModelId id, const gbt::classification::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+tree_utils::BinnedFeaturesPtr Input::get(InputBinnedFeaturesId id) const
+{
+    return staticPointerCast<tree_utils::BinnedFeatures, SerializationIface>(Argument::get(id));
+}
+
+void Input::set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value)
+{
+    Argument::set(id, value);
+}
+
+Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(par, method));
+
+    const NumericTablePtr validationDataTable = get(validationData);
+    if(validationDataTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, this->getNumberOfFeatures()));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationLabels).get(), validationLabelsStr(), 0, 0, 1,
+            validationDataTable->getNumberOfRows()));
+    }
+    else
+    {
+        DAAL_CHECK_EX(get(validationLabels).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationLabelsStr());
+    }
+
+    const gbt::classification::ModelPtr m = get(inputModel);
+    if(m)
+    {
+        DAAL_CHECK_EX(m->getNumberOfFeatures() == this->getNumberOfFeatures(), ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+        const size_t nClasses = par ? static_cast<const classifier::Parameter*>(par)->nClasses : 2;
+        DAAL_CHECK((nClasses < 3) || (m->getNumberOfTrees() % nClasses == 0), ErrorGbtIncorrectNumberOfTrees);
+    }
+
+    const tree_utils::BinnedFeaturesPtr bf = get(binnedFeatures);
+    if(bf)
+    {
+        DAAL_CHECK_EX(bf->getNumberOfFeatures() == this->getNumberOfFeatures(), ErrorIncorrectNumberOfFeatures, ArgumentName, binnedFeaturesStr());
+        DAAL_CHECK_EX(bf->getNumberOfRows() == classifier::training::Input::get(classifier::training::data)->getNumberOfRows(), ErrorIncorrectNumberOfObservations,
+            ArgumentName, binnedFeaturesStr());
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
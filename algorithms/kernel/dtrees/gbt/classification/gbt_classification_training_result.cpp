@@ -35,7 +35,11 @@ namespace algorithms
 namespace gbt
 {
 
-namespace training { Status checkImpl(const gbt::training::Parameter& prm); }
+namespace training
+{
+Status checkImpl(const gbt::training::interface1::Parameter& prm);
+Status checkImpl(const gbt::training::interface2::Parameter& prm);
+}
 
 namespace classification
 {
@@ -86,6 +90,14 @@ Status Parameter::check() const
     return gbt::training::checkImpl(*this);
 }
 }
+
+namespace interface3
+{
+Status Parameter::check() const
+{
+    return gbt::training::checkImpl(*this);
+}
+}
 } // namespace training
 } // namespace classification
 } // namespace gbt
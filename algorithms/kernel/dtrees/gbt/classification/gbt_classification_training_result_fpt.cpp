@@ -43,7 +43,9 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const size_t nFeatures = inp->get(classifier::training::data)->getNumberOfColumns();
     set(classifier::training::model, daal::algorithms::gbt::classification::Model::create(nFeatures, &s));
 
-    const Parameter *par = static_cast<const Parameter *>(parameter);
+    /* The parameter of all interfaces derives from gbt::training::interface1::Parameter */
+    const gbt::training::interface1::Parameter *par = dynamic_cast<const gbt::training::interface1::Parameter *>(parameter);
+    DAAL_CHECK(par, services::ErrorNullParameterNotSupported);
     if(par->resultsToCompute & gbt::training::computeGain)
     {
         set(variableImportanceGain, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, data_management::NumericTable::doAllocate, 0, &s));
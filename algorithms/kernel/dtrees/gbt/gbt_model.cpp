@@ -24,6 +24,9 @@
 #include "daal_defines.h"
 #include "gbt_model_impl.h"
 #include "dtrees_model_impl_common.h"
+#include "service_sort.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -184,12 +187,17 @@ void ModelImpl::add(gbt::internal::GbtDecisionTree* pTbl, HomogenNumericTable<do
     DAAL_ASSERT(pTblSmplCnt);
 
     _nTree.inc();
+    updateVersion();
 
     _serializationData->push_back(SerializationIfacePtr(pTbl));
     _impurityTables->push_back(SerializationIfacePtr(pTblImp));
     _nNodeSampleTables->push_back(SerializationIfacePtr(pTblSmplCnt));
 }
 
+ModelImpl::ModelImpl() : _nTreesQuickScorerChecked(0)
+{
+}
+
 ModelImpl::~ModelImpl()
 {
     destroy();
@@ -202,24 +210,191 @@ size_t ModelImpl::size() const
 
 bool ModelImpl::reserve(const size_t nTrees)
 {
+    resetQuickScorerForest();
     return super::reserve(nTrees);
 }
 
 bool ModelImpl::resize(const size_t nTrees)
 {
+    resetQuickScorerForest();
     return super::resize(nTrees);
 }
 
+bool ModelImpl::addTreesOf(const ModelImpl& other)
+{
+    resetQuickScorerForest();
+    return super::addTreesOf(other);
+}
+
 void ModelImpl::clear()
 {
+    resetQuickScorerForest();
     super::clear();
 }
 
 void ModelImpl::destroy()
 {
+    resetQuickScorerForest();
     super::destroy();
 }
 
+void ModelImpl::resetQuickScorerForest()
+{
+    AUTOLOCK(_quickScorerMutex);
+    _quickScorerForest.reset();
+    _nTreesQuickScorerChecked = 0;
+}
+
+services::SharedPtr<const QuickScorerForest> ModelImpl::getQuickScorerForest() const
+{
+    AUTOLOCK(_quickScorerMutex);
+    const size_t nTrees = size();
+    if(_quickScorerForest.get() && _quickScorerForest->getNumberOfTrees() == nTrees)
+        return _quickScorerForest;
+    if(_nTreesQuickScorerChecked == nTrees)
+        return services::SharedPtr<const QuickScorerForest>(); //not applicable to the current set of trees
+    _quickScorerForest.reset();
+    _nTreesQuickScorerChecked = nTrees;
+    if(!nTrees || !QuickScorerForest::isApplicable(*_serializationData, nTrees))
+        return services::SharedPtr<const QuickScorerForest>();
+    services::SharedPtr<QuickScorerForest> forest(new QuickScorerForest());
+    if(!forest.get() || !forest->init(*_serializationData, nTrees))
+        return services::SharedPtr<const QuickScorerForest>();
+    _quickScorerForest = forest;
+    return _quickScorerForest;
+}
+
+const size_t QuickScorerForest::maxLvl;
+const size_t QuickScorerForest::nTreesInBlock;
+
+/* Splits that replicate a leaf down to the last level of the complete tree have both children
+   equal to themselves, they do not affect the leaf value and are not stored */
+static bool isReplicatedLeaf(const GbtDecisionTree& tree, size_t idx)
+{
+    const gbt::prediction::internal::ModelFPType* splitPoints = tree.getSplitPoints();
+    const gbt::prediction::internal::FeatureIndexType* featureIndexes = tree.getFeatureIndexesForSplit();
+    const size_t iLeft = 2*idx + 1;
+    const size_t iRight = iLeft + 1;
+    return splitPoints[iLeft] == splitPoints[idx] && featureIndexes[iLeft] == featureIndexes[idx] &&
+        splitPoints[iRight] == splitPoints[idx] && featureIndexes[iRight] == featureIndexes[idx];
+}
+
+bool QuickScorerForest::isApplicable(const data_management::DataCollection& trees, size_t nTrees)
+{
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const GbtDecisionTree* pTree = (const GbtDecisionTree*)trees[iTree].get();
+        if(!pTree || pTree->getMaxLvl() > maxLvl)
+            return false;
+    }
+    return true;
+}
+
+services::Status QuickScorerForest::init(const data_management::DataCollection& trees, size_t nTrees)
+{
+    using gbt::prediction::internal::ModelFPType;
+    _nTrees = 0;
+    _nFeatures = 0;
+    const size_t nBlocks = (nTrees + nTreesInBlock - 1) / nTreesInBlock;
+
+    /* count leaves and split points */
+    _leafOffset = services::Collection<size_t>(nTrees + 1);
+    DAAL_CHECK_MALLOC(_leafOffset.data());
+    size_t nLeaves = 0;
+    size_t nSplits = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const GbtDecisionTree& tree = *(const GbtDecisionTree*)trees[iTree].get();
+        const size_t nLvls = tree.getMaxLvl();
+        DAAL_CHECK(nLvls <= maxLvl, services::ErrorIncorrectSizeOfModel);
+        _leafOffset[iTree] = nLeaves;
+        nLeaves += size_t(1) << nLvls;
+        for(size_t idx = 0, nSplitNodes = (size_t(1) << nLvls) - 1; idx < nSplitNodes; ++idx)
+        {
+            if(isReplicatedLeaf(tree, idx))
+                continue;
+            ++nSplits;
+            if(_nFeatures <= tree.getFeatureIndexesForSplit()[idx])
+                _nFeatures = tree.getFeatureIndexesForSplit()[idx] + 1;
+        }
+    }
+    _leafOffset[nTrees] = nLeaves;
+
+    _leafValues = services::Collection<ModelFPType>(nLeaves);
+    _featureOffset = services::Collection<size_t>(nBlocks*(_nFeatures + 1));
+    _splitPoints = services::Collection<ModelFPType>(nSplits);
+    _treeIndexes = services::Collection<TreeIndexType>(nSplits);
+    _masks = services::Collection<MaskType>(nSplits);
+    DAAL_CHECK_MALLOC(_leafValues.data() && _featureOffset.data());
+    DAAL_CHECK_MALLOC(!nSplits || (_splitPoints.data() && _treeIndexes.data() && _masks.data()));
+
+    size_t iSplit = 0;
+    for(size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        const size_t iFirstTree = iBlock*nTreesInBlock;
+        const size_t iLastTree = (iFirstTree + nTreesInBlock < nTrees ? iFirstTree + nTreesInBlock : nTrees);
+        size_t* featureOffset = _featureOffset.data() + iBlock*(_nFeatures + 1);
+        for(size_t i = 0; i <= _nFeatures; ++i)
+            featureOffset[i] = 0;
+
+        /* count split points of every feature in the block */
+        for(size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            const GbtDecisionTree& tree = *(const GbtDecisionTree*)trees[iTree].get();
+            for(size_t idx = 0, nSplitNodes = (size_t(1) << tree.getMaxLvl()) - 1; idx < nSplitNodes; ++idx)
+            {
+                if(!isReplicatedLeaf(tree, idx))
+                    ++featureOffset[tree.getFeatureIndexesForSplit()[idx] + 1];
+            }
+        }
+        featureOffset[0] = iSplit;
+        for(size_t i = 0; i < _nFeatures; ++i)
+            featureOffset[i + 1] += featureOffset[i];
+
+        /* fill split points, use the beginning of the next feature range as a cursor */
+        for(size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            const GbtDecisionTree& tree = *(const GbtDecisionTree*)trees[iTree].get();
+            const ModelFPType* splitPoints = tree.getSplitPoints();
+            const gbt::prediction::internal::FeatureIndexType* featureIndexes = tree.getFeatureIndexesForSplit();
+            const size_t nLvls = tree.getMaxLvl();
+            for(size_t lvl = 0, idx = 0; lvl < nLvls; ++lvl)
+            {
+                const size_t nLeavesInSubtree = size_t(1) << (nLvls - lvl);
+                for(size_t iPos = 0, nNodesInLvl = size_t(1) << lvl; iPos < nNodesInLvl; ++iPos, ++idx)
+                {
+                    if(isReplicatedLeaf(tree, idx))
+                        continue;
+                    /* going to the right excludes the leaves of the left subtree */
+                    const size_t iFirstLeaf = iPos*nLeavesInSubtree;
+                    const MaskType leftLeaves = ((MaskType(1) << (nLeavesInSubtree/2)) - 1) << iFirstLeaf;
+                    const size_t iPoint = featureOffset[featureIndexes[idx]]++;
+                    _splitPoints[iPoint] = splitPoints[idx];
+                    _treeIndexes[iPoint] = TreeIndexType(iTree - iFirstTree);
+                    _masks[iPoint] = ~leftLeaves;
+                }
+            }
+            const size_t nTreeLeaves = size_t(1) << nLvls;
+            for(size_t i = 0; i < nTreeLeaves; ++i)
+                _leafValues[_leafOffset[iTree] + i] = splitPoints[nTreeLeaves - 1 + i];
+        }
+        /* shift offsets back and sort split points of every feature */
+        for(size_t i = _nFeatures; i > 0; --i)
+            featureOffset[i] = featureOffset[i - 1];
+        featureOffset[0] = iSplit;
+        for(size_t i = 0; i < _nFeatures; ++i)
+        {
+            const size_t n = featureOffset[i + 1] - featureOffset[i];
+            if(n > 1)
+                daal::algorithms::internal::qSort<ModelFPType, TreeIndexType, MaskType, sse2>(n,
+                    _splitPoints.data() + featureOffset[i], _treeIndexes.data() + featureOffset[i], _masks.data() + featureOffset[i]);
+        }
+        iSplit = featureOffset[_nFeatures];
+    }
+    _nTrees = nTrees;
+    return services::Status();
+}
+
 bool ModelImpl::nodeIsDummyLeaf(size_t idx, const GbtDecisionTree& gbtTree)
 {
     const gbt::prediction::internal::ModelFPType* splitPoints        = gbtTree.getSplitPoints();
@@ -313,19 +488,57 @@ services::Status ModelImpl::convertDecisionTreesToGbtTrees(data_management::Data
 {
     services::Status s;
     const size_t size = serializationData->size();
-    data_management::DataCollection* newTrees = new data_management::DataCollection();
-    DAAL_CHECK_MALLOC(newTrees)
-    for(size_t i = 0; i < size; ++i)
+    data_management::DataCollectionPtr newTrees(new data_management::DataCollection(size));
+    DAAL_CHECK_MALLOC(newTrees.get() && (newTrees->size() == size))
+
+    /* trees are converted independently */
+    daal::SafeStatus safeStat;
+    daal::threader_for(size, size, [&](size_t i)
     {
-        const DecisionTreeTable& tree = *(DecisionTreeTable*)(*(serializationData))[i].get();
-        GbtDecisionTree* newTree = allocateGbtTree(tree);
-        decisionTreeToGbtTree(tree, *newTree);
-        newTrees->push_back(SerializationIfacePtr(newTree));
-    }
-    serializationData.reset(newTrees);
+        const DecisionTreeTable* const tree = (const DecisionTreeTable*)(*(serializationData))[i].get();
+        DAAL_CHECK_THR(tree, services::ErrorNullModel);
+        GbtDecisionTree* newTree = allocateGbtTree(*tree);
+        DAAL_CHECK_MALLOC_THR(newTree);
+        (*newTrees)[i] = SerializationIfacePtr(newTree);
+        decisionTreeToGbtTree(*tree, *newTree);
+    });
+    s = safeStat.detach();
+    if(s)
+        serializationData = newTrees;
     return s;
 }
 
+services::Status ModelImpl::exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const
+{
+    DAAL_CHECK(iFirstTree + nTrees <= size() && iFirstTree + nTrees >= iFirstTree, services::ErrorIncorrectParameter);
+
+    /* View of a complete tree, the children of the i-th node are 2 * i + 1 and 2 * i + 2 */
+    struct GbtTreeView
+    {
+        size_t getMaxNumberOfNodes() const { return tree ? tree->getNumberOfNodes() : 0; }
+        bool isSplit(size_t idx, size_t level) const { return !nodeIsLeaf(idx, *tree, level); }
+        size_t leftChild(size_t idx) const { return 2 * idx + 1; }
+        size_t rightChild(size_t idx) const { return 2 * idx + 2; }
+        int featureIndex(size_t idx) const { return tree->getFeatureIndexesForSplit()[idx]; }
+        double splitValue(size_t idx) const { return tree->getSplitPoints()[idx]; }
+        double leafValue(size_t idx) const { return tree->getSplitPoints()[idx]; }
+        double impurity(size_t idx) const { return impVals ? impVals[idx] : 0; }
+        size_t nodeSampleCount(size_t idx) const { return nodeSampleCounts ? size_t(nodeSampleCounts[idx]) : 0; }
+
+        const GbtDecisionTree* tree;
+        const double* impVals;
+        const int* nodeSampleCounts;
+    };
+
+    auto getTree = [&](size_t iTree) -> GbtTreeView
+    {
+        const size_t i = iFirstTree + iTree;
+        GbtTreeView view = { at(i), getImpVals(i), getNodeSampleCount(i) };
+        return view;
+    };
+    return dtrees::internal::exportTreesToArrays(nTrees, getTree, trees);
+}
+
 void ModelImpl::getMaxLvl(const dtrees::internal::DecisionTreeNode* const arr, const size_t idx, size_t& maxLvl, size_t curLvl)
 {
     curLvl++;
@@ -221,6 +221,58 @@ protected:
     services::Collection<double> GainFeature;
 };
 
+/* Representation of the trees for the QuickScorer prediction algorithm. For every feature the split
+   points of a block of trees are sorted in ascending order. Each split point is stored with the mask
+   of the leaves of its tree that become unreachable when an observation goes to the right of the split.
+   An observation falls into the leftmost leaf not excluded by the split points less than its features */
+class QuickScorerForest
+{
+public:
+    typedef uint64_t MaskType;
+    typedef uint32_t TreeIndexType;
+    static const size_t maxLvl = 6;             //trees with up to 2^maxLvl leaves are supported
+    static const size_t nTreesInBlock = 512;    //masks of a block of trees for several observations fit into the cache
+
+    QuickScorerForest() : _nTrees(0), _nFeatures(0){}
+
+    /* Checks whether all the trees have at most 2^maxLvl leaves */
+    static bool isApplicable(const data_management::DataCollection& trees, size_t nTrees);
+    services::Status init(const data_management::DataCollection& trees, size_t nTrees);
+
+    size_t getNumberOfTrees() const { return _nTrees; }
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+    size_t getNumberOfBlocks() const { return (_nTrees + nTreesInBlock - 1) / nTreesInBlock; }
+    /* Number of the leading blocks which contain only the trees from the first nTrees */
+    size_t getNumberOfBlocks(size_t nTrees) const { return nTrees < _nTrees ? nTrees / nTreesInBlock : getNumberOfBlocks(); }
+    /* Number of the trees in the leading nBlocks blocks */
+    size_t getNumberOfTreesInBlocks(size_t nBlocks) const { return nBlocks*nTreesInBlock < _nTrees ? nBlocks*nTreesInBlock : _nTrees; }
+    size_t getFirstTree(size_t iBlock) const { return iBlock*nTreesInBlock; }
+    size_t getBlockSize(size_t iBlock) const
+    {
+        return (iBlock + 1)*nTreesInBlock <= _nTrees ? nTreesInBlock : _nTrees - iBlock*nTreesInBlock;
+    }
+
+    /* Split points of the given feature in the given block are in the range [getSplitsBegin, getSplitsEnd) */
+    size_t getSplitsBegin(size_t iBlock, size_t iFeature) const { return _featureOffset[iBlock*(_nFeatures + 1) + iFeature]; }
+    size_t getSplitsEnd(size_t iBlock, size_t iFeature) const { return _featureOffset[iBlock*(_nFeatures + 1) + iFeature + 1]; }
+    const gbt::prediction::internal::ModelFPType* getSplitPoints() const { return _splitPoints.data(); }
+    /* Index of the tree of the split point within its block */
+    const TreeIndexType* getTreeIndexes() const { return _treeIndexes.data(); }
+    const MaskType* getMasks() const { return _masks.data(); }
+    /* Leaf values of the tree from left to right */
+    const gbt::prediction::internal::ModelFPType* getLeafValues(size_t iTree) const { return _leafValues.data() + _leafOffset[iTree]; }
+
+private:
+    size_t _nTrees;
+    size_t _nFeatures;
+    services::Collection<size_t> _featureOffset;
+    services::Collection<gbt::prediction::internal::ModelFPType> _splitPoints;
+    services::Collection<TreeIndexType> _treeIndexes;
+    services::Collection<MaskType> _masks;
+    services::Collection<size_t> _leafOffset;
+    services::Collection<gbt::prediction::internal::ModelFPType> _leafValues;
+};
+
 template <typename TNodeType, typename TAllocator = dtrees::internal::ChunkAllocator<TNodeType> >
 class GbtTreeImpl : public dtrees::internal::TreeImpl<TNodeType, TAllocator>
 {
@@ -288,11 +340,13 @@ public:
     using TreeType = gbt::internal::TreeImpRegression<>;
     using super    = dtrees::internal::ModelImpl;
 
+    ModelImpl();
     ~ModelImpl();
     size_t size() const;
     bool reserve(const size_t nTrees);
     bool resize(const size_t nTrees);
     void clear();
+    bool addTreesOf(const ModelImpl& other);
 
     const GbtDecisionTree* at(const size_t idx) const;
 
@@ -309,6 +363,14 @@ public:
     static services::Status treeToTable(TreeType& t, gbt::internal::GbtDecisionTree** pTbl, HomogenNumericTable<double>** pTblImp,
                             HomogenNumericTable<int>** pTblSmplCnt, size_t nFeature);
 
+    /* Returns the QuickScorer representation of the trees. It is built on the first call and cached
+       until the set of trees is changed. Returns empty pointer if some tree has more than
+       2^QuickScorerForest::maxLvl leaves */
+    services::SharedPtr<const QuickScorerForest> getQuickScorerForest() const;
+
+    /* Exports the trees [iFirstTree, iFirstTree + nTrees) to the arrays, dummy leaves of the complete trees are skipped */
+    services::Status exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const;
+
 
 protected:
     static bool nodeIsDummyLeaf(size_t idx, const GbtDecisionTree& gbtTree);
@@ -378,6 +440,7 @@ protected:
     }
 
     void destroy();
+    void resetQuickScorerForest();
 
     template<typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
@@ -395,10 +458,18 @@ protected:
         }
 
         if(onDeserialize)
+        {
             _nTree.set(_serializationData->size());
+            resetQuickScorerForest();
+        }
 
         return services::Status();
     }
+
+protected:
+    mutable services::SharedPtr<QuickScorerForest> _quickScorerForest;
+    mutable size_t _nTreesQuickScorerChecked; //number of trees in the model when QuickScorer applicability was checked last time
+    mutable Mutex _quickScorerMutex;
 };
 
 } // namespace internal
@@ -0,0 +1,135 @@
+/* file: gbt_predict_quick_scorer_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the QuickScorer prediction algorithm for gradient boosted trees
+//--
+*/
+
+#ifndef __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+#define __GBT_PREDICT_QUICK_SCORER_IMPL_I__
+
+#include "gbt_model_impl.h"
+#include "service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+const size_t QUICK_SCORER_BLOCK_SIZE = 16; //number of observations scored together
+const size_t QUICK_SCORER_MIN_TREES = 1024; //smaller ensembles are traversed faster
+const size_t QUICK_SCORER_MIN_ROWS = 64;    //smaller batches of observations are traversed faster
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Number of the leading blocks of the forest to be scored by QuickScorer
+//////////////////////////////////////////////////////////////////////////////////////////
+inline size_t getNumberOfQuickScorerBlocks(const gbt::internal::QuickScorerForest* forest, size_t nTrees)
+{
+    return (forest && nTrees >= QUICK_SCORER_MIN_TREES) ? forest->getNumberOfBlocks(nTrees) : 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Index of the lowest set bit of the non-zero mask
+//////////////////////////////////////////////////////////////////////////////////////////
+inline size_t getLowestBitIndex(gbt::internal::QuickScorerForest::MaskType mask)
+{
+    static const unsigned char deBruijnIdx[64] = {
+        0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+    return deBruijnIdx[((mask & (~mask + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Adds predictions of the trees from the leading nBlocks blocks of the forest to res.
+// Tree iTree contributes to res[iRow*nClasses + iTree%nClasses].
+// aMask is the buffer of QuickScorerForest::nTreesInBlock*QUICK_SCORER_BLOCK_SIZE elements
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+void predictByQuickScorer(const gbt::internal::QuickScorerForest& forest, size_t nBlocks, const algorithmFPType* x,
+    size_t nRows, size_t nCols, size_t nClasses, algorithmFPType* res, gbt::internal::QuickScorerForest::MaskType* aMask)
+{
+    typedef gbt::internal::QuickScorerForest::MaskType MaskType;
+    typedef gbt::internal::QuickScorerForest::TreeIndexType TreeIndexType;
+    const MaskType allLeaves = ~MaskType(0);
+    const size_t nFeatures = forest.getNumberOfFeatures();
+    DAAL_ASSERT(nFeatures <= nCols);
+    const ModelFPType* const splitPoints = forest.getSplitPoints();
+    const TreeIndexType* const treeIndexes = forest.getTreeIndexes();
+    const MaskType* const masks = forest.getMasks();
+
+    for(size_t iStartRow = 0; iStartRow < nRows; iStartRow += QUICK_SCORER_BLOCK_SIZE)
+    {
+        const size_t nRowsInBlock = (iStartRow + QUICK_SCORER_BLOCK_SIZE <= nRows ? QUICK_SCORER_BLOCK_SIZE : nRows - iStartRow);
+        const algorithmFPType* const xBlock = x + iStartRow*nCols;
+        for(size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+        {
+            const size_t nTrees = forest.getBlockSize(iBlock);
+            for(size_t i = 0; i < nTrees*QUICK_SCORER_BLOCK_SIZE; ++i)
+                aMask[i] = allLeaves;
+
+            for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+            {
+                algorithmFPType xFeature[QUICK_SCORER_BLOCK_SIZE];
+                algorithmFPType xMax = -services::internal::MaxVal<algorithmFPType>::get();
+                for(size_t iRow = 0; iRow < nRowsInBlock; ++iRow)
+                {
+                    xFeature[iRow] = xBlock[iRow*nCols + iFeature];
+                    xMax = (xFeature[iRow] > xMax ? xFeature[iRow] : xMax);
+                }
+                /* split points are sorted, the ones not less than all the values do not exclude leaves.
+                   The values are compared with the split points of the model type as the tree traversal does */
+                for(size_t i = forest.getSplitsBegin(iBlock, iFeature), iEnd = forest.getSplitsEnd(iBlock, iFeature);
+                    (i < iEnd) && (xMax > splitPoints[i]); ++i)
+                {
+                    const ModelFPType splitPoint = splitPoints[i];
+                    const MaskType mask = masks[i];
+                    MaskType* const treeMask = aMask + treeIndexes[i]*QUICK_SCORER_BLOCK_SIZE;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for(size_t iRow = 0; iRow < nRowsInBlock; ++iRow)
+                        treeMask[iRow] &= (xFeature[iRow] > splitPoint ? mask : allLeaves);
+                }
+            }
+
+            const size_t iFirstTree = forest.getFirstTree(iBlock);
+            for(size_t iTree = 0; iTree < nTrees; ++iTree)
+            {
+                const ModelFPType* const leafValues = forest.getLeafValues(iFirstTree + iTree);
+                const MaskType* const treeMask = aMask + iTree*QUICK_SCORER_BLOCK_SIZE;
+                algorithmFPType* const resTree = res + iStartRow*nClasses + (iFirstTree + iTree) % nClasses;
+                for(size_t iRow = 0; iRow < nRowsInBlock; ++iRow)
+                    resTree[iRow*nClasses] += leafValues[getLowestBitIndex(treeMask[iRow])];
+            }
+        }
+    }
+}
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -164,6 +164,8 @@ public:
         const algorithmFPType* y, const algorithmFPType* f,
         const IndexType* sampleInd,
         algorithmFPType* gh) = 0;
+    //average value of the loss function on n rows, f contains nRows x nTrees values of the arguments
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f) = 0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -757,6 +759,13 @@ struct GlobalStorages
     size_t nDiffFeatMax;
 
     BinIndexType* newFI;
+
+    //bins of the nonzero values of the sparse input in the order of the values of the CSR table,
+    //the implicit zeros of every feature are not stored
+    const size_t* sparseRowOffsets = nullptr; //0-based
+    const size_t* sparseColIndices = nullptr; //1-based
+    const BinIndexType* sparseBins = nullptr;
+    TVector<size_t, cpu, ScalableAllocator<cpu>> zeroBins;
 };
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
@@ -27,9 +27,11 @@
 
 #include "dtrees_model_impl.h"
 #include "dtrees_train_data_helper.i"
+#include "dtrees_binned_features_impl.h"
 #include "dtrees_predict_dense_default_impl.i"
 #include "gbt_internal.h"
 #include "gbt_train_aux.i"
+#include "gbt_predict_dense_default_impl.i"
 
 namespace daal
 {
@@ -47,6 +49,36 @@ using namespace daal::algorithms::gbt::internal;
 
 typedef int RowIndexType;
 
+//Adds the responses of the trees to the loss function arguments f of the rows of x, f is stored row by row.
+//The i-th tree contributes to the argument of the (i % nTrees)-th tree of the iteration
+template <typename algorithmFPType, CpuType cpu>
+services::Status addTreesResponses(const NumericTable *x, const dtrees::internal::FeatureTypes& featTypes,
+    const gbt::internal::GbtDecisionTree* const* aTbl, size_t nTbl, size_t nTrees, algorithmFPType* pf)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nCols = x->getNumberOfColumns();
+    const size_t nRowsInBlock = 256;
+    const size_t nBlocks = nRows / nRowsInBlock + !!(nRows % nRowsInBlock);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock*nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock + 1 == nBlocks) ? nRows - iStart : nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(x), iStart, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType* px = xBD.get();
+        for(size_t iTbl = 0; iTbl < nTbl; ++iTbl)
+        {
+            const gbt::internal::GbtDecisionTree& t = *aTbl[iTbl];
+            const size_t iTree = iTbl % nTrees;
+            for(size_t i = 0; i < nRowsToProcess; ++i)
+                pf[(iStart + i)*nTrees + iTree] += gbt::prediction::internal::predictForTree<algorithmFPType, gbt::internal::GbtDecisionTree, cpu>
+                    (t, featTypes, px + i*nCols);
+        }
+    });
+    return safeStat.detach();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Base task class. Implements general pipeline of tree building
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -80,11 +112,19 @@ public:
     algorithmFPType accuracy() const { return _accuracy; }
     size_t nTrees() const { return _nTrees; }
 
+    //sets the trees of the model which training is continued, f is initialized with their responses
+    void setInitialTrees(const gbt::internal::GbtDecisionTree* const* aTbl, size_t nTbl)
+    {
+        _aInitTrees = aTbl;
+        _nInitTrees = nTbl;
+    }
+
     services::Status run(gbt::internal::GbtDecisionTree** aTbl, HomogenNumericTable<double>** aTblImp, HomogenNumericTable<int>** aTblSmplCnt, size_t iIteration, GlobalStorages<algorithmFPType, BinIndexType, cpu>& GH_SUMS_BUF);
     virtual services::Status init();
     bool isIndirect() const { return _bIndirect; }
     double computeLeafWeightUpdateF(const int* idx, size_t n, const ImpurityType& imp, size_t iTree);
     void updateOOB(size_t iTree, TreeType& t);
+    void addFIncrements();
     bool terminateCriteria(size_t nSamples, size_t level, const ImpurityType& imp) const
     {
         return ((nSamples < 2 * _par.minObservationsInLeafNode) ||
@@ -179,6 +219,9 @@ protected:
     DataHelperType _dataHelper;
     const FeatureTypes& _featHelper;
     TVector<algorithmFPType, cpu> _aF; //loss function arguments (f)
+    //increments of f by the trees of the current iteration, one row of nRows values per tree.
+    //Used when the trees are built in parallel, so that the trees do not write to the same cache lines of f
+    TVector<algorithmFPType, cpu> _aFInc;
     //bagging, first _nSamples indices are the mapping of sample to row indices, the rest is OOB indices
     TVector<int, cpu> _aSampleToF;
 
@@ -197,6 +240,8 @@ protected:
     size_t _nClasses;
     size_t _nTrees; //per iteration
     LossFunctionType* _loss = nullptr;
+    const gbt::internal::GbtDecisionTree* const* _aInitTrees = nullptr;
+    size_t _nInitTrees = 0;
 
     bool _bThreaded = false;
     bool _bParallelFeatures = false;
@@ -220,6 +265,15 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::init()
     const auto nF = nRows*_nTrees;
     _aF.reset(nF);
     DAAL_CHECK_MALLOC(_aF.get());
+    //a single tree per iteration updates f directly
+    if(isParallelTrees() && (_nTrees > 1))
+    {
+        _aFInc.reset(nF);
+        DAAL_CHECK_MALLOC(_aFInc.get());
+        algorithmFPType* pInc = _aFInc.get();
+        for(size_t i = 0; i < nF; ++i)
+            pInc[i] = algorithmFPType(0);
+    }
 
     _bIndirect = true;
 
@@ -235,10 +289,20 @@ double TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::computeLeafWeight
     if(isZero<algorithmFPType, cpu>(val))
         return res;
 
-    algorithmFPType* pf = f();
     val = -imp.g / val;
     const algorithmFPType inc = val*_par.shrinkage;
 
+    if(_aFInc.get())
+    {
+        algorithmFPType* pInc = _aFInc.get() + iTree*_data->getNumberOfRows();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            pInc[idx[i]] += inc;
+        return res + inc;
+    }
+
+    algorithmFPType* pf = f();
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for(size_t i = 0; i < n; ++i)
@@ -264,6 +328,13 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
     {
         _initialF = 0;
     }
+    else if(_nInitTrees)
+    {
+        _initialF = 0;
+        initializeF(_initialF);
+        services::Status s = addTreesResponses<algorithmFPType, cpu>(_data, _featHelper, _aInitTrees, _nInitTrees, _nTrees, f());
+        DAAL_CHECK_STATUS_VAR(s);
+    }
     else
     {
         if(!getInitialF(_initialF))
@@ -287,7 +358,36 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
     }
     step(this->_dataHelper.y());
     _nParallelNodes.set(0);
-    return buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
+    services::Status s = buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
+    if(s && (_nTrees > 1) && _aFInc.get())
+        addFIncrements();
+    return s;
+}
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::addFIncrements()
+{
+    const size_t nRows = _data->getNumberOfRows();
+    const size_t nTrees = _nTrees;
+    const size_t sizeOfBlock = 1024;
+    const size_t nBlocks = nRows / sizeOfBlock + !!(nRows % sizeOfBlock);
+    algorithmFPType* pf = f();
+    algorithmFPType* pInc = _aFInc.get();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock*sizeOfBlock;
+        const size_t iEnd = (iBlock + 1 == nBlocks) ? nRows : iStart + sizeOfBlock;
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            algorithmFPType* pTreeInc = pInc + iTree*nRows;
+            PRAGMA_IVDEP
+            for(size_t i = iStart; i < iEnd; ++i)
+            {
+                pf[i*nTrees + iTree] += pTreeInc[i];
+                pTreeInc[i] = algorithmFPType(0);
+            }
+        }
+    });
 }
 
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
@@ -295,6 +395,7 @@ void TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::updateOOB(size_t iT
 {
     const auto aSampleToF = _aSampleToF.get();
     auto pf = f();
+    algorithmFPType* pInc = _aFInc.get() ? _aFInc.get() + iTree*_data->getNumberOfRows() : nullptr;
     const size_t n = _aSampleToF.size();
     const size_t nIt = n - _nSamples;
     daal::threader_for(nIt, nIt, [&](size_t i)
@@ -304,7 +405,10 @@ void TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::updateOOB(size_t iT
         auto pNode = dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, x.get());
         DAAL_ASSERT(pNode);
         algorithmFPType inc = TreeType::NodeType::castLeaf(pNode)->response;
-        pf[iRow*_nTrees + iTree] += inc;
+        if(pInc)
+            pInc[iRow] += inc;
+        else
+            pf[iRow*_nTrees + iTree] += inc;
     });
 }
 
@@ -349,10 +453,133 @@ protected:
 };
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Loss function on the validation data set. The values of the loss function arguments
+// are updated with each new tree instead of evaluating the whole ensemble
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class ValidationLoss
+{
+public:
+    ValidationLoss(const NumericTable *x, const dtrees::internal::FeatureTypes& featTypes, size_t nTrees) :
+        _x(x), _featTypes(featTypes), _nTrees(nTrees){}
+
+    services::Status init(const NumericTable *y)
+    {
+        const size_t nRows = _x->getNumberOfRows();
+        _aF.reset(nRows*_nTrees);
+        DAAL_CHECK_MALLOC(_aF.get());
+        algorithmFPType* pf = _aF.get();
+        for(size_t i = 0; i < nRows*_nTrees; ++i)
+            pf[i] = algorithmFPType(0);
+        _aY.reset(nRows);
+        DAAL_CHECK_MALLOC(_aY.get());
+        ReadRows<algorithmFPType, cpu> yRows(const_cast<NumericTable*>(y), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(yRows);
+        const algorithmFPType* py = yRows.get();
+        algorithmFPType* pY = _aY.get();
+        for(size_t i = 0; i < nRows; ++i)
+            pY[i] = py[i];
+        return services::Status();
+    }
+
+    //adds the responses of the trees to the arguments of the loss function
+    services::Status update(const gbt::internal::GbtDecisionTree* const* aTbl, size_t nTbl)
+    {
+        return addTreesResponses<algorithmFPType, cpu>(_x, _featTypes, aTbl, nTbl, _nTrees, _aF.get());
+    }
+
+    algorithmFPType value(LossFunction<algorithmFPType, cpu>* loss) const
+    {
+        return loss->getLoss(_x->getNumberOfRows(), _aY.get(), _aF.get());
+    }
+
+protected:
+    const NumericTable *_x;
+    const dtrees::internal::FeatureTypes& _featTypes;
+    const size_t _nTrees;
+    TVector<algorithmFPType, cpu> _aF; //loss function arguments for the validation data
+    TVector<algorithmFPType, cpu> _aY;
+};
+
+//Returns the bin of the feature value, i.e. the first bin whose right border is not less than the value
+template <typename algorithmFPType, CpuType cpu>
+size_t findBin(const dtrees::internal::IndexedFeatures& indexedFeatures, size_t iCol, algorithmFPType value)
+{
+    const size_t nBins = indexedFeatures.numIndices(iCol);
+    size_t iBin = 0;
+    for(size_t n = nBins; n > 0;)
+    {
+        const size_t step = (n >> 1);
+        if(indexedFeatures.binRightBorder(iCol, iBin + step) < value)
+        {
+            iBin += step + 1;
+            n -= step + 1;
+        }
+        else
+            n = step;
+    }
+    return (iBin < nBins) ? iBin : nBins - 1;
+}
+
+//Computes the bins of the nonzero values of the CSR table from the bin borders of the features, so that histograms are
+//computed over the nonzero values of the rows. The bins are stored in the order of the values of the table,
+//all the implicit zeros of a feature share one bin whose sums are restored from the totals of the node
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu, typename StorageType>
+services::Status initSparseBins(const NumericTable& x, const dtrees::internal::IndexedFeatures& indexedFeatures, StorageType& storage,
+    ReadRowsCSR<algorithmFPType, cpu>& block, TVector<size_t, cpu, ScalableAllocator<cpu>>& rowOffsetsArr,
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu>>& binsArr)
+{
+    CSRNumericTableIface* csr = dynamic_cast<CSRNumericTableIface*>(const_cast<NumericTable*>(&x));
+    DAAL_CHECK(csr, services::ErrorIncorrectTypeOfInputNumericTable);
+
+    const size_t nRows = x.getNumberOfRows();
+    const size_t nCols = x.getNumberOfColumns();
+    const size_t* nUniquesArr = storage.nUniquesArr.get();
+
+    block.set(csr, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(block);
+    const algorithmFPType* values = block.values();
+    const size_t* colIndices = block.cols(); //1-based
+    const size_t* csrRowOffsets = block.rows(); //1-based
+    const size_t nNonZero = csrRowOffsets[nRows] - csrRowOffsets[0];
+
+    storage.zeroBins.reset(nCols);
+    rowOffsetsArr.reset(nRows + 1);
+    binsArr.reset(nNonZero ? nNonZero : 1);
+    DAAL_CHECK_MALLOC(storage.zeroBins.get() && rowOffsetsArr.get() && binsArr.get());
+    size_t* zeroBins = storage.zeroBins.get();
+    size_t* rowOffsets = rowOffsetsArr.get();
+    BinIndexType* bins = binsArr.get();
+
+    for(size_t iCol = 0; iCol < nCols; ++iCol)
+        zeroBins[iCol] = nUniquesArr[iCol] + findBin<algorithmFPType, cpu>(indexedFeatures, iCol, algorithmFPType(0));
+    for(size_t i = 0; i <= nRows; ++i)
+        rowOffsets[i] = csrRowOffsets[i] - csrRowOffsets[0];
+
+    const size_t nThreads = threader_get_threads_number();
+    const size_t nBlocks = ((nThreads < nNonZero) ? nThreads : 1);
+    const size_t sizeOfBlock = nNonZero/nBlocks + !!(nNonZero%nBlocks);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock*sizeOfBlock;
+        const size_t iEnd = (((iBlock+1) * sizeOfBlock > nNonZero) ? nNonZero : iStart + sizeOfBlock);
+        for(size_t i = iStart; i < iEnd; ++i)
+            bins[i] = BinIndexType(findBin<algorithmFPType, cpu>(indexedFeatures, colIndices[i] - 1, values[i]));
+    });
+
+    storage.sparseRowOffsets = rowOffsets;
+    storage.sparseColIndices = colIndices;
+    storage.sparseBins = bins;
+    return services::Status();
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
-services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::internal::ModelImpl& md,
+services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
+    const NumericTable *xValid, const NumericTable *yValid, const gbt::internal::ModelImpl* mdInit, gbt::internal::ModelImpl& md,
     const gbt::training::Parameter& par, engines::internal::BatchBaseImpl& engine, size_t nClasses,
-    dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
+    const dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
     algorithmFPType *ptrWeight, algorithmFPType *ptrCover, algorithmFPType *ptrTotalCover,
     algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain)
 {
@@ -365,7 +592,22 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     DAAL_CHECK_STATUS(s, task.init());
 
     const size_t nTrees = task.nTrees();
-    DAAL_CHECK_MALLOC(md.reserve(par.maxIterations*nTrees));
+
+    //continued training: the trees of the input model are shared with the trained model and their responses
+    //are computed once to initialize the loss function arguments
+    const size_t nInitTrees = mdInit ? mdInit->size() : 0;
+    DAAL_CHECK(nInitTrees % nTrees == 0, services::ErrorGbtIncorrectNumberOfTrees);
+    DAAL_CHECK_MALLOC(md.reserve(nInitTrees + par.maxIterations*nTrees));
+    TVector<const gbt::internal::GbtDecisionTree*, cpu> aInitTrees;
+    if(nInitTrees)
+    {
+        DAAL_CHECK_MALLOC(md.addTreesOf(*mdInit));
+        aInitTrees.reset(nInitTrees);
+        DAAL_CHECK_MALLOC(aInitTrees.get());
+        for(size_t i = 0; i < nInitTrees; ++i)
+            aInitTrees[i] = mdInit->at(i);
+        task.setInitialTrees(aInitTrees.get(), nInitTrees);
+    }
 
     TVector<gbt::internal::GbtDecisionTree*, cpu > aTables;
     TVector<HomogenNumericTable<double>*, cpu > impTables;
@@ -425,8 +667,16 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     }
 
     TVector<BinIndexType, cpu, ScalableAllocator<cpu>> newFIArr;
+    ReadRowsCSR<algorithmFPType, cpu> sparseBlock;
+    TVector<size_t, cpu, ScalableAllocator<cpu>> sparseRowOffsetsArr;
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu>> sparseBinsArr;
 
-    if(inexactWithHistMethod)
+    if(inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+    {
+        DAAL_CHECK_STATUS(s, (initSparseBins<algorithmFPType, BinIndexType, cpu>(*x, indexedFeatures, storage, sparseBlock,
+            sparseRowOffsetsArr, sparseBinsArr)));
+    }
+    else if(inexactWithHistMethod)
     {
         size_t nThreads = threader_get_threads_number();
         size_t nRows = x->getNumberOfRows();
@@ -467,35 +717,21 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
     DAAL_CHECK_MALLOC(allWeightVec.get());
     allWeight = allWeightVec.get();
 
-    for(size_t i = 0; (i < par.maxIterations) && !algorithms::internal::isCancelled(s, pHostApp); ++i)
+    auto addTrees = [&](gbt::internal::GbtDecisionTree** aTreeTbl, HomogenNumericTable<double>** aTreeTblImp, HomogenNumericTable<int>** aTreeTblSmplCnt)
     {
-        s = task.run(aTbl, aTblImp, aTblSmplCnt, i, storage);
-        if(!s)
-        {
-            deleteTables<cpu>(aTbl, aTblImp, aTblSmplCnt, nTrees);
-            break;
-        }
-        size_t iTree = 0;
-        for(; (iTree < nTrees) && (aTbl[iTree]->getNumberOfNodes() < 2); ++iTree);
-        if(iTree == nTrees) //all are one level (constant response) trees
-        {
-            deleteTables<cpu>(aTbl, aTblImp, aTblSmplCnt, nTrees);
-            break;
-        }
-
-        for(iTree = 0; iTree < nTrees; ++iTree)
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
         {
             if ((ptrTotalCover != nullptr) || (ptrCover != nullptr))
             {
-                totalCoverFeature = (aTbl[iTree]->getArrayCoverFeature());
+                totalCoverFeature = (aTreeTbl[iTree]->getArrayCoverFeature());
             }
             if ((ptrWeight != nullptr) || (ptrCover != nullptr) || (ptrGain != nullptr))
             {
-                weightFeature = aTbl[iTree]->getArrayNumSplitFeature();
+                weightFeature = aTreeTbl[iTree]->getArrayNumSplitFeature();
             }
             if ((ptrTotalGain != nullptr) || (ptrGain != nullptr))
             {
-                totalGainFeature = (aTbl[iTree]->getArrayGainFeature());
+                totalGainFeature = (aTreeTbl[iTree]->getArrayGainFeature());
             }
 
             if (ptrWeight != nullptr)
@@ -522,12 +758,84 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
                 for(size_t kFeature = 0; kFeature < nStor; ++kFeature)
                     allWeight[kFeature] += static_cast<algorithmFPType>(weightFeature[kFeature]);
 
-            md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
+            md.add(aTreeTbl[iTree], aTreeTblImp[iTree], aTreeTblSmplCnt[iTree]);
+        }
+    };
+
+    //early stopping: the trees built after the iteration with the smallest validation loss are kept
+    //aside and added to the model only when the loss decreases again
+    const bool bEarlyStopping = xValid && yValid && (par.maxIterationsWithoutImprovement > 0);
+    ValidationLoss<algorithmFPType, cpu> validationLoss(xValid, featTypes, nTrees);
+    const size_t nPendingMax = bEarlyStopping ? par.maxIterationsWithoutImprovement*nTrees : 0;
+    TVector<gbt::internal::GbtDecisionTree*, cpu> aPendingTables(nPendingMax, nullptr);
+    TVector<HomogenNumericTable<double>*, cpu> aPendingImpTables(nPendingMax, nullptr);
+    TVector<HomogenNumericTable<int>*, cpu> aPendingSmplCntTables(nPendingMax, nullptr);
+    size_t nPendingIterations = 0;
+    algorithmFPType bestLoss = daal::services::internal::MaxVal<algorithmFPType>::get();
+    if(bEarlyStopping)
+    {
+        DAAL_CHECK_MALLOC(aPendingTables.get() && aPendingImpTables.get() && aPendingSmplCntTables.get());
+        DAAL_CHECK_STATUS(s, validationLoss.init(yValid));
+        if(nInitTrees)
+            DAAL_CHECK_STATUS(s, validationLoss.update(aInitTrees.get(), nInitTrees));
+    }
+
+    for(size_t i = 0; (i < par.maxIterations) && !algorithms::internal::isCancelled(s, pHostApp); ++i)
+    {
+        s = task.run(aTbl, aTblImp, aTblSmplCnt, i, storage);
+        if(!s)
+        {
+            deleteTables<cpu>(aTbl, aTblImp, aTblSmplCnt, nTrees);
+            break;
+        }
+        size_t iTree = 0;
+        for(; (iTree < nTrees) && (aTbl[iTree]->getNumberOfNodes() < 2); ++iTree);
+        if(iTree == nTrees) //all are one level (constant response) trees
+        {
+            deleteTables<cpu>(aTbl, aTblImp, aTblSmplCnt, nTrees);
+            break;
+        }
+
+        if(!bEarlyStopping)
+        {
+            addTrees(aTbl, aTblImp, aTblSmplCnt);
+        }
+        else
+        {
+            s = validationLoss.update(aTbl, nTrees);
+            const size_t iPending = nPendingIterations*nTrees;
+            for(iTree = 0; iTree < nTrees; ++iTree)
+            {
+                aPendingTables[iPending + iTree] = aTbl[iTree];
+                aPendingImpTables[iPending + iTree] = aTblImp[iTree];
+                aPendingSmplCntTables[iPending + iTree] = aTblSmplCnt[iTree];
+            }
+            ++nPendingIterations;
+            if(!s)
+                break;
+
+            const algorithmFPType loss = validationLoss.value(task.lossFunc());
+            if(loss < bestLoss)
+            {
+                bestLoss = loss;
+                for(size_t iIteration = 0; iIteration < nPendingIterations; ++iIteration)
+                {
+                    addTrees(aPendingTables.get() + iIteration*nTrees, aPendingImpTables.get() + iIteration*nTrees,
+                        aPendingSmplCntTables.get() + iIteration*nTrees);
+                }
+                nPendingIterations = 0;
+            }
+            else if(nPendingIterations == par.maxIterationsWithoutImprovement)
+            {
+                break;
+            }
         }
 
         if((i + 1 < par.maxIterations) && task.done())
             break;
     }
+    if(nPendingIterations)
+        deleteTables<cpu>(aPendingTables.get(), aPendingImpTables.get(), aPendingSmplCntTables.get(), nPendingIterations*nTrees);
 
     if (ptrCover != nullptr)
         for (size_t i = 0; i < nStor; ++i)
@@ -547,14 +855,15 @@ services::Status  computeTypeDisp(HostAppIface* pHostApp, const NumericTable *x,
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
-services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::internal::ModelImpl& md,
+services::Status computeImpl(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
+    const NumericTable *xValid, const NumericTable *yValid, const gbt::internal::ModelImpl* mdInit, gbt::internal::ModelImpl& md,
     const gbt::training::Parameter& par, engines::internal::BatchBaseImpl& engine, size_t nClasses,
-    dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
+    const dtrees::internal::IndexedFeatures& indexedFeatures, dtrees::internal::FeatureTypes& featTypes, ResultType *res,
     algorithmFPType *ptrWeight, algorithmFPType *ptrCover, algorithmFPType *ptrTotalCover,
     algorithmFPType *ptrGain, algorithmFPType *ptrTotalGain)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes, res,
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, xValid, yValid, mdInit, md, par, engine, nClasses, indexedFeatures, featTypes, res,
         ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain); // TODO: remove int
 }
 
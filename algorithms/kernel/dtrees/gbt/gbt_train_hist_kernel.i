@@ -267,6 +267,21 @@ public:
     {
         services::internal::service_memset_seq<algorithmFPType, cpu>((algorithmFPType*)aGHSum, algorithmFPType(0), nUnique*4);
     }
+
+    //restores sums of the bin which was skipped while computing histograms of the sparse input
+    template<typename ImpurityType, typename ResultType>
+    static void addImplicitBin(const size_t iBin, const ImpurityType& nodeImp, const size_t nNode, ResultType& res)
+    {
+        algorithmFPType n = 0;
+        for(size_t i = 0; i < res.nUnique; ++i)
+            n += res.ghSums[i].n;
+
+        res.ghSums[iBin].g += nodeImp.g - res.gTotal;
+        res.ghSums[iBin].h += nodeImp.h - res.hTotal;
+        res.ghSums[iBin].n += algorithmFPType(nNode) - n;
+        res.gTotal = nodeImp.g;
+        res.hTotal = nodeImp.h;
+    }
 };
 
 template<typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
@@ -320,6 +335,30 @@ struct ComputeGHSumByRows
     }
 };
 
+template<typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumByRowsSparse
+{
+    static void run(algorithmFPType* aGHSumFP, const size_t* rowOffsets, const size_t* colIndices, const BinIndexType* bins,
+        const size_t* nUniquesArr, const RowIndexType* aIdx, const algorithmFPType* pgh, size_t iStart, size_t iEnd)
+    {
+        for(size_t i = iStart; i < iEnd; ++i)
+        {
+            const RowIndexType iRow = aIdx[i];
+            const algorithmFPType g = pgh[2*iRow];
+            const algorithmFPType h = pgh[2*iRow+1];
+
+            PRAGMA_IVDEP
+            for(size_t j = rowOffsets[iRow], jEnd = rowOffsets[iRow + 1]; j < jEnd; ++j)
+            {
+                const size_t idx = 4*(nUniquesArr[colIndices[j] - 1] + bins[j]);
+                aGHSumFP[idx + 0] += g;
+                aGHSumFP[idx + 1] += h;
+                aGHSumFP[idx + 2] += algorithmFPType(1);
+            }
+        }
+    }
+};
+
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MergeGHSums
 {
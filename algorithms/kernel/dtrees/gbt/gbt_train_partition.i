@@ -148,11 +148,35 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType& split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature),
+        const auto* storage = _sharedData.GH_SUMS_BUF;
+        if(storage && storage->sparseRowOffsets)
+        {
+            //the bin of the feature is looked up among the nonzero values of the row, rows without it have the bin of zero
+            const size_t* rowOffsets = storage->sparseRowOffsets;
+            const size_t* colIndices = storage->sparseColIndices;
+            const BinIndexType* bins = storage->sparseBins;
+            const size_t iCol = size_t(iFeature) + 1; //column indices are 1-based
+            const RowIndexType zeroBin = RowIndexType(storage->zeroBins[iFeature] - storage->nUniquesArr[iFeature]);
+            auto binOfRow = [=](RowIndexType iRow) -> RowIndexType
+            {
+                for(size_t i = rowOffsets[iRow], iEnd = rowOffsets[iRow + 1]; i < iEnd; ++i)
+                {
+                    if(colIndices[i] == iCol)
+                        return RowIndexType(bins[i]);
+                }
+                return zeroBin;
+            };
+            return doPartitionIdx(n, _sharedData.aIdx + iStart, binOfRow,
+                        split.featureUnordered, idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2*iStart), split.nLeft);
+        }
+        const RowIndexType* indexedFeature = _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature);
+        auto binOfRow = [=](RowIndexType iRow) -> RowIndexType { return indexedFeature[iRow]; };
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, binOfRow,
                     split.featureUnordered, idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2*iStart), split.nLeft);
     }
 
-    DAAL_INT doPartitionIdx(IndexType n, RowIndexType* aIdx, const RowIndexType* indexedFeature, bool featureUnordered,
+    template <typename BinOfRow>
+    DAAL_INT doPartitionIdx(IndexType n, RowIndexType* aIdx, const BinOfRow& binOfRow, bool featureUnordered,
         RowIndexType idxFeatureValueBestSplit, RowIndexType* buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
@@ -189,7 +213,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for(IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if(indexedFeature[aIdx[i]] != idxFeatureValueBestSplit)
+                    if(binOfRow(aIdx[i]) != idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -201,7 +225,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for(IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if(indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    if(binOfRow(aIdx[i]) > idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -237,7 +261,7 @@ protected:
         });
 
         RowIndexType i = 0;
-        while(indexedFeature[aIdx[i]] != idxFeatureValueBestSplit) i++;
+        while(binOfRow(aIdx[i]) != idxFeatureValueBestSplit) i++;
         iRowSplitVal = aIdx[i];
 
         return iRowSplitVal;
@@ -51,6 +51,7 @@ namespace hist
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename GHSumType, CpuType cpu> class GHSumsHelper;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename ImpurityType, typename GHSumType, typename SplitType, typename ResultType, CpuType cpu> class MaxImpurityDecreaseHelper;
 template<typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu> struct ComputeGHSumByRows;
+template<typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu> struct ComputeGHSumByRowsSparse;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu> struct MergeGHSums;
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
@@ -166,6 +167,8 @@ public:
         const size_t iEnd = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if(_data.GH_SUMS_BUF->sparseRowOffsets)
+            GHSums::addImplicitBin(_data.GH_SUMS_BUF->zeroBins[_iFeature] - iStart, _node1.imp, _node1.n, _res1);
 
         daal::threader_for(2, 2, [&](size_t iBlock)
         {
@@ -281,6 +284,8 @@ public:
         const size_t iEnd = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
+        if(_data.GH_SUMS_BUF->sparseRowOffsets)
+            GHSums::addImplicitBin(_data.GH_SUMS_BUF->zeroBins[_iFeature] - iStart, _node1.imp, _node1.n, _res1);
 
         // TODO: check for hasDiffFeatureValues()
 
@@ -350,6 +355,12 @@ public:
         }
 
         algorithmFPType* pgh = (algorithmFPType*)_data.ctx.grad(_data.iTree);
+        if(_data.GH_SUMS_BUF->sparseRowOffsets)
+        {
+            ComputeGHSumByRowsSparse<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, _data.GH_SUMS_BUF->sparseRowOffsets,
+                _data.GH_SUMS_BUF->sparseColIndices, _data.GH_SUMS_BUF->sparseBins, _data.GH_SUMS_BUF->nUniquesArr.get(), aIdx, pgh, iStart, iEnd);
+            return nullptr;
+        }
         ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd, _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
         return nullptr;
     }
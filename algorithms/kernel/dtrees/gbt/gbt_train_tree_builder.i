@@ -34,6 +34,7 @@
 #include "gbt_train_split_sorting.i"
 #include "gbt_train_node_creator.i"
 #include "gbt_train_updater.i"
+#include "service_heap.h"
 
 namespace daal
 {
@@ -169,6 +170,11 @@ public:
         DAAL_CHECK_MALLOC(initMemHelper());
         if(_ctx.isParallelNodes() && !_taskGroup)
             DAAL_CHECK_MALLOC((_taskGroup = new daal::task_group()));
+        if(_ctx.par().maxLeaves)
+        {
+            _aCandidate.reset(_ctx.par().maxLeaves);
+            DAAL_CHECK_MALLOC(_aCandidate.get());
+        }
         return services::Status();
     }
     daal::task_group* taskGroup() { return _taskGroup; }
@@ -239,7 +245,14 @@ protected:
         SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> data(_ctx, bestSplitIdxBuf(), const_cast<int*>(_aSample.get()), _memHelper, this->_iTree, _tree, _mtAlloc);
         data.GH_SUMS_BUF = &GH_SUMS_BUF;
 
-        if(_ctx.par().memorySavingMode)
+        if(_ctx.par().maxLeaves)
+        {
+            if(_ctx.par().memorySavingMode)
+                buildLossGuided<MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu> >(data, job);
+            else
+                buildLossGuided<ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu> >(data, job);
+        }
+        else if(_ctx.par().memorySavingMode)
         {
             using Mode = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
@@ -316,6 +329,8 @@ protected:
         return pNode;
     }
     void buildSplit(GbtTask* task);
+    template <typename BaseSplitMode>
+    void buildLossGuided(SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu>& data, SplitJobType& job);
 
 protected:
     CommonCtx& _ctx;
@@ -325,6 +340,7 @@ protected:
     typedef dtrees::internal::TVector<RowIndexType, cpu> IndexTypeArray;
     mutable IndexTypeArray _aBestSplitIdxBuf;
     mutable IndexTypeArray _aSample;
+    dtrees::internal::TVector<GbtTask*, cpu> _aCandidate; //nodes to be expanded in leaf-wise growth
     MemHelperType* _memHelper = nullptr;
     daal::task_group* _taskGroup = nullptr;
 };
@@ -407,6 +423,67 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     }
 }
 
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+template <typename BaseSplitMode>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildLossGuided(
+    SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu>& data, SplitJobType& job)
+{
+    using Mode = LossGuideSplitMode<algorithmFPType, RowIndexType, BinIndexType, BaseSplitMode, cpu>;
+    using Updater = LossGuideUpdater<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
+
+    auto byLossReduction = [](const GbtTask* a, const GbtTask* b) -> bool
+    {
+        return static_cast<const Updater*>(a)->lossReduction() < static_cast<const Updater*>(b)->lossReduction();
+    };
+    auto release = [](Updater* node)
+    {
+        node->~Updater();
+        service_scalable_free<Updater, cpu>(node);
+    };
+    auto finalize = [&](Updater* node) //turns the node into the leaf
+    {
+        GbtTask* newTasks[2];
+        size_t nTasks = 0;
+        node->makeLeaf();
+        node->getNextTasks(newTasks, nTasks);
+        DAAL_ASSERT(nTasks == 0);
+        release(node);
+    };
+
+    //the candidates for expansion are the current leaves of the tree, kept in the max-heap by loss reduction
+    const size_t maxLeaves = _ctx.par().maxLeaves;
+    GbtTask** candidates = _aCandidate.get();
+    size_t nCandidates = 0;
+    auto addCandidate = [&](Updater* node)
+    {
+        node->evaluate();
+        if(node->isSplittable())
+        {
+            candidates[nCandidates++] = node;
+            daal::algorithms::internal::pushMaxHeap<cpu>(candidates, candidates + nCandidates, byLossReduction);
+        }
+        else
+            finalize(node);
+    };
+
+    addCandidate(new (service_scalable_malloc<Updater, cpu>(1)) Updater(data, job));
+    for(size_t nLeaves = 1; nCandidates && (nLeaves < maxLeaves); ++nLeaves)
+    {
+        daal::algorithms::internal::popMaxHeap<cpu>(candidates, candidates + nCandidates, byLossReduction);
+        Updater* node = static_cast<Updater*>(candidates[--nCandidates]);
+        node->execute();
+
+        GbtTask* newTasks[2];
+        size_t nTasks = 0;
+        node->getNextTasks(newTasks, nTasks); //children that are not leaves yet
+        release(node);
+        for(size_t i = 0; i < nTasks; ++i)
+            addCandidate(static_cast<Updater*>(newTasks[i]));
+    }
+    for(size_t i = 0; i < nCandidates; ++i)
+        finalize(static_cast<Updater*>(candidates[i]));
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>* TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::create(CommonCtx& ctx)
 {
@@ -39,6 +39,7 @@ namespace internal
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class UpdaterByColumns;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class UpdaterByRows;
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class MergedUpdaterByRows;
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu> class LossGuideUpdater;
 
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MemorySafetySplitMode
@@ -86,6 +87,21 @@ public:
     using NodesCreatorType         = MergedNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, MergedUpdaterType, cpu>;
 };
 
+//Leaf-wise growth: split search and partitioning of BaseSplitMode, the children are created as LossGuideUpdater tasks
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename BaseSplitMode, CpuType cpu>
+struct LossGuideSplitMode
+{
+protected:
+    using ThisType         = LossGuideSplitMode<algorithmFPType, RowIndexType, BinIndexType, BaseSplitMode, cpu>;
+    using UpdaterType      = LossGuideUpdater<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+
+public:
+    using TaskType         = typename BaseSplitMode::TaskType;
+    using ResultType       = typename BaseSplitMode::ResultType;
+    using PartitionType    = typename BaseSplitMode::PartitionType;
+    using NodesCreatorType = DefaultNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, cpu>;
+};
+
 template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
 class UpdaterBase: public GbtTask
 {
@@ -380,6 +396,47 @@ protected:
     MergedResult<ResultType, cpu>* _result2;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Updater of the node for leaf-wise growth. The best split of the node is found by evaluate()
+// when the node is created, the split is applied by execute() when the node is chosen
+// for expansion. A node that is never chosen becomes a leaf after makeLeaf()
+//////////////////////////////////////////////////////////////////////////////////////////
+template<typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
+class LossGuideUpdater: public UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>
+{
+    using super = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, SplitMode, cpu>;
+public:
+    LossGuideUpdater(typename super::DataType& data, typename super::NodeInfoType& node): super(data, node), _idxFeatureValueBestSplit(-1) { }
+
+    void evaluate()
+    {
+        this->findBestSplit(this->_bestSplit, this->_iFeature, _idxFeatureValueBestSplit);
+        //children do not reuse the histograms of the parent, so they are not kept while the node waits for expansion
+        if(this->_result)
+        {
+            this->_result->release(this->_data);
+            this->_result = nullptr;
+        }
+    }
+
+    bool isSplittable() const { return this->_iFeature >= 0; }
+    algorithmFPType lossReduction() const { return this->_bestSplit.impurityDecrease; }
+    void makeLeaf() { this->_iFeature = -1; }
+
+    virtual GbtTask* execute() DAAL_C11_OVERRIDE
+    {
+        if(this->_iFeature >= 0)
+        {
+            typename super::PartitionTaskType partition(this->_iFeature, _idxFeatureValueBestSplit, this->_data, this->_node, this->_bestSplit);
+            partition.execute();
+        }
+        return nullptr;
+    }
+
+protected:
+    DAAL_INT _idxFeatureValueBestSplit;
+};
+
 } /* namespace internal */
 } /* namespace training */
 } /* namespace gbt */
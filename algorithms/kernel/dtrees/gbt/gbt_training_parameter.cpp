@@ -39,6 +39,9 @@ namespace training
 {
 using namespace daal::services;
 
+namespace interface1
+{
+
 Parameter::Parameter() : splitMethod(defaultSplit), maxIterations(50), maxTreeDepth(6),
     shrinkage(0.3), minSplitLoss(0.), lambda(1.),
     observationsPerTreeFraction(1.),
@@ -53,7 +56,18 @@ Parameter::Parameter() : splitMethod(defaultSplit), maxIterations(50), maxTreeDe
 {
 }
 
-Status checkImpl(const gbt::training::Parameter& prm)
+} // namespace interface1
+
+namespace interface2
+{
+
+Parameter::Parameter() : maxLeaves(0), maxIterationsWithoutImprovement(0)
+{
+}
+
+} // namespace interface2
+
+Status checkImpl(const gbt::training::interface1::Parameter& prm)
 {
     DAAL_CHECK_EX(prm.maxIterations, ErrorIncorrectParameter, ParameterName, maxIterationsStr());
     DAAL_CHECK_EX((prm.shrinkage > 0) && (prm.shrinkage <= 1), ErrorIncorrectParameter, ParameterName, shrinkageStr());
@@ -70,6 +84,14 @@ Status checkImpl(const gbt::training::Parameter& prm)
     return Status();
 }
 
+Status checkImpl(const gbt::training::interface2::Parameter& prm)
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkImpl(static_cast<const gbt::training::interface1::Parameter&>(prm)));
+    DAAL_CHECK_EX((prm.maxLeaves != 1), ErrorIncorrectParameter, ParameterName, maxLeavesStr());
+    return s;
+}
+
 } // namespace training
 } // namespace gbt
 } // namespace algorithms
@@ -79,6 +79,14 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex, featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+    const size_t* leftChildren, const size_t* rightChildren, const double* values, TreeId& resId)
+{
+    gbt::regression::internal::ModelImpl& modelImplRef = daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl,ModelPtr>(_model);
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, 0, modelImplRef._serializationData->size(), nTrees,
+        treeOffsets, featureIndexes, leftChildren, rightChildren, values, false, resId);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace decision_forest
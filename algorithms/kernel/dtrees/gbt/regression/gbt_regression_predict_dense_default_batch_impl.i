@@ -35,6 +35,7 @@
 #include "service_memory.h"
 #include "dtrees_regression_predict_dense_default_impl.i"
 #include "gbt_predict_dense_default_impl.i"
+#include "gbt_predict_quick_scorer_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -68,6 +69,7 @@ public:
 
 protected:
     services::Status runInternal(services::HostAppIface* pHostApp, NumericTable* result);
+    void initQuickScorer(const gbt::internal::ModelImpl* m);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType* x);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType* x, algorithmFPType* res);
 
@@ -75,6 +77,7 @@ protected:
 protected:
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType*, cpu> _aTree;
+    services::SharedPtr<const gbt::internal::QuickScorerForest> _quickScorer; //if set, it is used for the leading blocks of trees
     const NumericTable* _data;
     NumericTable* _res;
 };
@@ -104,9 +107,17 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for(size_t i = 0; i < nTreesTotal; ++i)
         this->_aTree[i] = m->at(i);
+    initQuickScorer(m);
     return runInternal(pHostApp, this->_res);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTask<algorithmFPType, cpu>::initQuickScorer(const gbt::internal::ModelImpl* m)
+{
+    if(!this->_featHelper.hasUnorderedFeatures())
+        this->_quickScorer = m->getQuickScorerForest();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(services::HostAppIface* pHostApp, NumericTable* result)
 {
@@ -120,6 +131,14 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
     SafeStatus safeStat;
     services::Status s;
     HostAppHelper host(pHostApp, 100);
+
+    /* leading blocks of trees are scored by QuickScorer when all the trees are processed at once */
+    const size_t nQuickScorerBlocks = (dim.nTreeBlocks == 1) ?
+        gbt::prediction::internal::getNumberOfQuickScorerBlocks(this->_quickScorer.get(), nTreesTotal) : 0;
+    const size_t nQuickScorerTrees = nQuickScorerBlocks ? this->_quickScorer->getNumberOfTreesInBlocks(nQuickScorerBlocks) : 0;
+    daal::TlsMem<gbt::internal::QuickScorerForest::MaskType, cpu> tlsMask(nQuickScorerBlocks ?
+        gbt::internal::QuickScorerForest::nTreesInBlock*gbt::prediction::internal::QUICK_SCORER_BLOCK_SIZE : 0);
+
     for(size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
     {
         if(!s || host.isCancelled(s, 1))
@@ -134,14 +153,28 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType* res = resBD.get() + iStartRow;
 
+            size_t iFirstTree = iTree;
+            size_t nTrees = nTreesToUse;
+            if(nQuickScorerBlocks && (nRowsToProcess >= gbt::prediction::internal::QUICK_SCORER_MIN_ROWS))
+            {
+                gbt::internal::QuickScorerForest::MaskType* aMask = tlsMask.local();
+                DAAL_CHECK_MALLOC_THR(aMask);
+                gbt::prediction::internal::predictByQuickScorer<algorithmFPType, cpu>(*this->_quickScorer, nQuickScorerBlocks,
+                    xBD.get(), nRowsToProcess, dim.nCols, 1, res, aMask);
+                iFirstTree += nQuickScorerTrees;
+                nTrees -= nQuickScorerTrees;
+                if(!nTrees)
+                    return;
+            }
+
             size_t iRow;
             for(iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
-                predictByTreesVector(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols, res+iRow);
+                predictByTreesVector(iFirstTree, nTrees, xBD.get() + iRow*dim.nCols, res+iRow);
             }
             for(; iRow < nRowsToProcess; ++iRow)
             {
-                res[iRow] += predictByTrees(iTree, nTreesToUse, xBD.get() + iRow*dim.nCols);
+                res[iRow] += predictByTrees(iFirstTree, nTrees, xBD.get() + iRow*dim.nCols);
             }
         });
 
@@ -27,6 +27,7 @@
 #include "kernel.h"
 #include "gbt_regression_training_types.h"
 #include "gbt_regression_training_batch.h"
+#include "gbt_regression_training_distributed.h"
 #include "gbt_regression_train_kernel.h"
 #include "gbt_regression_model_impl.h"
 #include "service_algo_utils.h"
@@ -74,15 +75,29 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     const NumericTable *x = input->get(data).get();
     const NumericTable *y = input->get(dependentVariable).get();
+    const NumericTable *xValid = input->get(validationData).get();
+    const NumericTable *yValid = input->get(validationDependentVariable).get();
+    const gbt::regression::Model *mInit = input->get(inputModel).get();
+    const tree_utils::BinnedFeatures *xBinned = input->get(binnedFeatures).get();
 
     gbt::regression::Model *m = result->get(model).get();
 
-    const Parameter *par = static_cast<gbt::regression::training::Parameter*>(_par);
     daal::services::Environment::env &env = *_env;
+
+    /* Algorithms built with the headers of the previous version pass interface1::Parameter */
+    const interface2::Parameter *par = dynamic_cast<const interface2::Parameter*>(_par);
+    if(!par)
+    {
+        const interface1::Parameter *par1 = static_cast<interface1::Parameter*>(_par);
+        daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par1->engine.get());
+
+        __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
+            __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, xValid, yValid, mInit, xBinned, *m, *result, *par1, *engine);
+    }
     daal::algorithms::engines::internal::BatchBaseImpl* engine = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl*>(par->engine.get());
 
     __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel,
-        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, daal::services::internal::hostApp(*input), x, y, xValid, yValid, mInit, xBinned, *m, *result, *par, *engine);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -96,6 +111,82 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
     return services::Status();
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep1Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep1LocalInput *input = static_cast<DistributedStep1LocalInput *>(_in);
+    DistributedStep1LocalPartialResult *partialResult = static_cast<DistributedStep1LocalPartialResult *>(_pres);
+
+    const NumericTable *x = input->get(data).get();
+    const NumericTable *y = input->get(dependentVariable).get();
+    const NumericTable *borders = input->get(binBorders).get();
+    const NumericTable *t = input->get(tree).get();
+
+    const gbt::regression::training::Parameter *par = static_cast<gbt::regression::training::Parameter*>(_par);
+
+    __DAAL_CALL_KERNEL(env, internal::RegressionTrainDistrStep1Kernel,
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, borders, t, input->get(internalInput), *partialResult, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput *input = static_cast<DistributedStep2MasterInput *>(_in);
+    DistributedStep2MasterPartialResult *partialResult = static_cast<DistributedStep2MasterPartialResult *>(_pres);
+    data_management::DataCollection *dcInput = input->get(partialResults).get();
+
+    const gbt::regression::training::Parameter *par = static_cast<gbt::regression::training::Parameter*>(_par);
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::RegressionTrainDistrStep2Kernel,
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, dcInput, *partialResult, *par);
+
+    dcInput->clear();
+    return s;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    DistributedStep2MasterPartialResult *partialResult = static_cast<DistributedStep2MasterPartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    gbt::regression::Model *m = result->get(model).get();
+
+    const gbt::regression::training::Parameter *par = static_cast<gbt::regression::training::Parameter*>(_par);
+
+    __DAAL_CALL_KERNEL(env, internal::RegressionTrainDistrStep2Kernel,
+        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute, *partialResult, *m, *par);
+}
+
 }
 }
 }
@@ -78,6 +78,15 @@ public:
             }
         }
     }
+
+    virtual algorithmFPType getLoss(size_t n, const algorithmFPType* y, const algorithmFPType* f) DAAL_C11_OVERRIDE
+    {
+        algorithmFPType sum(0);
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < n; ++i)
+            sum += (y[i] - f[i]) * (y[i] - f[i]);
+        return n ? algorithmFPType(0.5) * sum / algorithmFPType(n) : sum;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -147,22 +156,45 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(
-    HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, gbt::regression::Model& m, Result& res, const Parameter& par,
-    engines::internal::BatchBaseImpl& engine)
+    HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, const NumericTable *xValid, const NumericTable *yValid,
+    const gbt::regression::Model *mInit, const tree_utils::BinnedFeatures *xBinned, gbt::regression::Model& m, Result& res,
+    const interface1::Parameter& par, engines::internal::BatchBaseImpl& engine)
+{
+    Parameter tmpPar;
+    static_cast<gbt::training::interface1::Parameter&>(tmpPar) = par;
+    tmpPar.loss = par.loss;
+    return compute(pHostApp, x, y, xValid, yValid, mInit, xBinned, m, res, tmpPar, engine);
+}
+template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
+services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(
+    HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y, const NumericTable *xValid, const NumericTable *yValid,
+    const gbt::regression::Model *mInit, const tree_utils::BinnedFeatures *xBinned, gbt::regression::Model& m, Result& res,
+    const Parameter& par, engines::internal::BatchBaseImpl& engine)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod = !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
 
     services::Status s;
-    dtrees::internal::IndexedFeatures indexedFeatures;
+    dtrees::internal::IndexedFeatures localIndexedFeatures;
+    const dtrees::internal::IndexedFeatures* pIndexedFeatures = &localIndexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
     if(!par.memorySavingMode)
     {
         BinParams prm(par.maxBins, par.minBinSize);
-        DAAL_CHECK_STATUS(s, (indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, par.splitMethod == gbt::training::inexact ? &prm : nullptr)));
+        if(inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+        {
+            //bins of the sparse input are computed per nonzero value, the index of the rows is not built
+            DAAL_CHECK_STATUS(s, (localIndexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, &prm, false)));
+        }
+        else
+        {
+            DAAL_CHECK_STATUS(s, (dtrees::internal::getIndexedFeatures<algorithmFPType, cpu>(*x, featTypes,
+                par.splitMethod == gbt::training::inexact ? &prm : nullptr, xBinned, localIndexedFeatures, pIndexedFeatures)));
+        }
     }
+    const dtrees::internal::IndexedFeatures& indexedFeatures = *pIndexedFeatures;
 
     WriteOnlyRows<algorithmFPType, cpu> weightsRows, totalCoverRows, coverRows, totalGainRows, gainRows;
 
@@ -193,25 +225,27 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     algorithmFPType* ptrTotalGain  = totalGainRows.get();
     algorithmFPType* ptrGain       = gainRows.get();
 
+    const gbt::internal::ModelImpl* mdInit = mInit ? static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl*>(mInit) : nullptr;
+
     if(inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
+                (pHostApp, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
+                (pHostApp, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu >, Result>
-                (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
+                (pHostApp, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
                 &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu >, Result>
-            (pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
+            (pHostApp, x, y, xValid, yValid, mdInit, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m), par, engine, 1, indexedFeatures, featTypes,
             &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
@@ -0,0 +1,879 @@
+/* file: gbt_regression_train_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression training
+//  in the distributed processing mode (defaultDense method).
+//
+//  Local nodes keep their observations binned by the borders computed on the
+//  master node and send the histograms of gradients of the open nodes of the tree.
+//  The master node merges the histograms, derives the histogram of the larger
+//  child of every split as the difference of the parent and sibling histograms,
+//  chooses the splits and sends the updated tree back to the local nodes.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DISTR_IMPL_I__
+#define __GBT_REGRESSION_TRAIN_DISTR_IMPL_I__
+
+#include "gbt_regression_train_kernel.h"
+#include "gbt_regression_model_impl.h"
+#include "service_numeric_table.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "service_data_utils.h"
+#include "service_sort.h"
+#include "service_array.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+using dtrees::internal::TVector;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Bins of the features defined by their right borders, the last border of every feature
+// is the maximal value of the type
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class DistributedBins
+{
+public:
+    DistributedBins(const algorithmFPType* borders, size_t nFeatures, size_t maxBins) :
+        _borders(borders), _nFeatures(nFeatures), _maxBins(maxBins), _nBins(nFeatures), _offsets(nFeatures + 1){}
+
+    bool init()
+    {
+        if(!_nBins.get() || !_offsets.get())
+            return false;
+        const algorithmFPType maxVal = daal::services::internal::MaxVal<algorithmFPType>::get();
+        _offsets[0] = 0;
+        for(size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+        {
+            const algorithmFPType* b = _borders + iFeature*_maxBins;
+            size_t n = 1;
+            for(; (n < _maxBins) && (b[n - 1] < maxVal); ++n);
+            _nBins[iFeature] = n;
+            _offsets[iFeature + 1] = _offsets[iFeature] + n;
+        }
+        return true;
+    }
+
+    //index of the bin of the value, i.e. the index of the first right border not less than the value
+    size_t bin(size_t iFeature, algorithmFPType val) const
+    {
+        const algorithmFPType* b = _borders + iFeature*_maxBins;
+        size_t lo = 0;
+        size_t hi = _nBins[iFeature] - 1;
+        while(lo < hi)
+        {
+            const size_t mid = (lo + hi)/2;
+            if(b[mid] < val)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    algorithmFPType border(size_t iFeature, size_t iBin) const { return _borders[iFeature*_maxBins + iBin]; }
+    size_t nBins(size_t iFeature) const { return _nBins[iFeature]; }
+    size_t offset(size_t iFeature) const { return _offsets[iFeature]; }
+    size_t totalBins() const { return _offsets[_nFeatures]; }
+    size_t nFeatures() const { return _nFeatures; }
+
+protected:
+    const algorithmFPType* _borders;
+    const size_t _nFeatures;
+    const size_t _maxBins;
+    TVector<size_t, cpu> _nBins;
+    TVector<size_t, cpu> _offsets;
+};
+
+template <typename algorithmFPType>
+inline int nodeStatus(const algorithmFPType* nodes, size_t iNode)
+{
+    return int(nodes[iNode*treeNColumns + treeNodeStatus]);
+}
+
+template <typename algorithmFPType>
+inline size_t nodeValue(const algorithmFPType* nodes, size_t iNode, DistributedTreeColumn col)
+{
+    return size_t(nodes[iNode*treeNColumns + col]);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Local node: quantile sketch of the bins of the features
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeBinSketch(const NumericTable *x, const Parameter& par, DistributedStep1LocalPartialResult& partialResult)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t maxBins = par.maxBins;
+
+    services::Status s;
+    NumericTablePtr sketchTable = HomogenNumericTable<algorithmFPType>::create(2*maxBins, nFeatures, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteOnlyRows<algorithmFPType, cpu> sketchRows(sketchTable.get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(sketchRows);
+    algorithmFPType* sketch = sketchRows.get();
+
+    daal::TlsMem<algorithmFPType, cpu> tlsBuf(nRows);
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature)
+    {
+        algorithmFPType* buf = tlsBuf.local();
+        DAAL_CHECK_MALLOC_THR(buf);
+        {
+            ReadColumns<algorithmFPType, cpu> col(const_cast<NumericTable*>(x), iFeature, 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(col);
+            const algorithmFPType* pCol = col.get();
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nRows; ++i)
+                buf[i] = pCol[i];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nRows, buf);
+
+        //right borders of the equal-frequency bins followed by the numbers of the observations in them
+        algorithmFPType* borders = sketch + iFeature*2*maxBins;
+        algorithmFPType* counts = borders + maxBins;
+        size_t nBorders = 0;
+        size_t nPrev = 0;
+        for(size_t k = 1; (k <= maxBins) && (nPrev < nRows); ++k)
+        {
+            size_t i = (k*nRows + maxBins - 1)/maxBins - 1;
+            if(i < nPrev)
+                continue;
+            for(; (i + 1 < nRows) && (buf[i + 1] == buf[i]); ++i);
+            borders[nBorders] = buf[i];
+            counts[nBorders++] = algorithmFPType(i + 1 - nPrev);
+            nPrev = i + 1;
+        }
+        for(size_t k = nBorders; k < maxBins; ++k)
+        {
+            borders[k] = borders[nBorders - 1];
+            counts[k] = 0;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    partialResult.set(binSketch, sketchTable);
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Local node: data kept between the iterations
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status initLocalData(const NumericTable *x, const DistributedBins<algorithmFPType, cpu>& bins, DataCollection& localData)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+
+    services::Status s;
+    NumericTablePtr binnedTable = HomogenNumericTable<int>::create(nFeatures, nRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr responseTable = HomogenNumericTable<algorithmFPType>::create(1, nRows, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr rowNodeTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const size_t blockSize = 256;
+    const size_t nBlocks = nRows/blockSize + !!(nRows%blockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock*blockSize;
+        const size_t n = (iBlock + 1 == nBlocks) ? nRows - iStart : blockSize;
+        ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable*>(x), iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<int, cpu> binnedRows(binnedTable.get(), iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(binnedRows);
+        const algorithmFPType* px = xRows.get();
+        int* pb = binnedRows.get();
+        for(size_t i = 0; i < n; ++i)
+        {
+            for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+                pb[i*nFeatures + iFeature] = int(bins.offset(iFeature) + bins.bin(iFeature, px[i*nFeatures + iFeature]));
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    localData.clear();
+    localData.push_back(binnedTable);
+    localData.push_back(responseTable);
+    localData.push_back(rowNodeTable);
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// RegressionTrainDistrStep1Kernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep1Kernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, const NumericTable *y,
+    const NumericTable *binBorders, const NumericTable *tree, const DataCollectionPtr& internalInput,
+    DistributedStep1LocalPartialResult& partialResult, const Parameter& par)
+{
+    if(!binBorders)
+    {
+        partialResult.set(histograms, NumericTablePtr());
+        return computeBinSketch<algorithmFPType, cpu>(x, par, partialResult);
+    }
+    partialResult.set(binSketch, NumericTablePtr());
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> bordersRows(const_cast<NumericTable*>(binBorders), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(bordersRows);
+    DistributedBins<algorithmFPType, cpu> bins(bordersRows.get(), nFeatures, par.maxBins);
+    DAAL_CHECK_MALLOC(bins.init());
+
+    services::Status s;
+    DataCollectionPtr localData = internalInput;
+    if(!localData)
+    {
+        localData.reset(new DataCollection());
+        DAAL_CHECK_MALLOC(localData.get());
+    }
+    if(!localData->size())
+        DAAL_CHECK_STATUS(s, (initLocalData<algorithmFPType, cpu>(x, bins, *localData)));
+    partialResult.set(internalResult, localData);
+
+    const size_t nNodes = tree->getNumberOfRows();
+    DAAL_CHECK(nNodes, ErrorIncorrectNumberOfRows);
+    ReadRows<algorithmFPType, cpu> treeRows(const_cast<NumericTable*>(tree), 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(treeRows);
+    const algorithmFPType* nodes = treeRows.get();
+
+    //histograms are computed for the open nodes of the tree in the order of the table,
+    //if the tree has no open nodes it is complete and the root of the next tree is computed
+    TVector<int, cpu> slotOfNode(nNodes, -1);
+    DAAL_CHECK_MALLOC(slotOfNode.get());
+    size_t nSlots = 0;
+    bool bGrowing = false;
+    for(size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        const int status = nodeStatus(nodes, iNode);
+        if(status == openNodeStatus)
+            slotOfNode[iNode] = int(nSlots++);
+        bGrowing = bGrowing || (status == openNodeStatus) || (status == derivedNodeStatus);
+    }
+    const bool bNewTree = !bGrowing;
+    if(bNewTree)
+    {
+        nSlots = 1;
+        slotOfNode[0] = 0;
+    }
+
+    NumericTable* binnedTable = static_cast<NumericTable*>((*localData)[localBinnedData].get());
+    NumericTable* responseTable = static_cast<NumericTable*>((*localData)[localResponse].get());
+    NumericTable* rowNodeTable = static_cast<NumericTable*>((*localData)[localRowNode].get());
+    ReadRows<int, cpu> binnedRows(binnedTable, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(binnedRows);
+    ReadRows<algorithmFPType, cpu> yRows(const_cast<NumericTable*>(y), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yRows);
+    WriteRows<algorithmFPType, cpu> responseRows(responseTable, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(responseRows);
+    WriteRows<int, cpu> rowNodeRows(rowNodeTable, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(rowNodeRows);
+    const int* binned = binnedRows.get();
+    const algorithmFPType* py = yRows.get();
+    algorithmFPType* pf = responseRows.get();
+    int* rowNode = rowNodeRows.get();
+
+    const size_t totalBins = bins.totalBins();
+    const size_t histSize = nSlots*totalBins*3;
+    daal::TlsSum<algorithmFPType, cpu> tlsHist(histSize);
+
+    const size_t blockSize = 512;
+    const size_t nBlocks = nRows/blockSize + !!(nRows%blockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        algorithmFPType* hist = tlsHist.local();
+        DAAL_CHECK_MALLOC_THR(hist);
+        const size_t iStart = iBlock*blockSize;
+        const size_t iEnd = (iBlock + 1 == nBlocks) ? nRows : iStart + blockSize;
+        for(size_t i = iStart; i < iEnd; ++i)
+        {
+            const int* xb = binned + i*nFeatures;
+            size_t iNode = rowNode[i];
+            while(nodeStatus(nodes, iNode) == splitNodeStatus)
+            {
+                const size_t iFeature = nodeValue(nodes, iNode, treeFeatureIndex);
+                const size_t iBin = size_t(xb[iFeature]) - bins.offset(iFeature);
+                iNode = nodeValue(nodes, iNode, treeLeftChild) + (iBin > nodeValue(nodes, iNode, treeSplitBin) ? 1 : 0);
+            }
+            if(bNewTree)
+            {
+                pf[i] += nodes[iNode*treeNColumns + treeNodeValue];
+                iNode = 0;
+            }
+            rowNode[i] = int(iNode);
+            const int slot = slotOfNode[iNode];
+            if(slot < 0)
+                continue;
+
+            //squared loss: gradient f - y, hessian 1
+            const algorithmFPType g = pf[i] - py[i];
+            algorithmFPType* h = hist + slot*totalBins*3;
+            for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+            {
+                algorithmFPType* p = h + size_t(xb[iFeature])*3;
+                p[0] += g;
+                p[1] += 1;
+                p[2] += 1;
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    NumericTablePtr histTable = HomogenNumericTable<algorithmFPType>::create(3, nSlots*totalBins, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        WriteRows<algorithmFPType, cpu> histRows(histTable.get(), 0, nSlots*totalBins);
+        DAAL_CHECK_BLOCK_STATUS(histRows);
+        tlsHist.reduceTo(histRows.get(), histSize);
+    }
+    partialResult.set(histograms, histTable);
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Master node: global bins of the features
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status mergeBinSketches(const DataCollection *partialResults, DistributedStep2MasterPartialResult& partialResult,
+    const Parameter& par)
+{
+    const size_t nBlocks = partialResults->size();
+    const size_t maxBins = par.maxBins;
+    const size_t nFeatures = static_cast<DistributedStep1LocalPartialResult*>((*partialResults)[0].get())->get(binSketch)->getNumberOfRows();
+    const size_t sketchSize = nFeatures*2*maxBins;
+
+    TVector<algorithmFPType, cpu> sketches(nBlocks*sketchSize);
+    DAAL_CHECK_MALLOC(sketches.get());
+    for(size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        NumericTable* sketchTable = static_cast<DistributedStep1LocalPartialResult*>((*partialResults)[iBlock].get())->get(binSketch).get();
+        ReadRows<algorithmFPType, cpu> sketchRows(sketchTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(sketchRows);
+        const algorithmFPType* p = sketchRows.get();
+        algorithmFPType* dst = sketches.get() + iBlock*sketchSize;
+        for(size_t i = 0; i < sketchSize; ++i)
+            dst[i] = p[i];
+    }
+
+    services::Status s;
+    NumericTablePtr bordersTable = HomogenNumericTable<algorithmFPType>::create(maxBins, nFeatures, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        WriteOnlyRows<algorithmFPType, cpu> bordersRows(bordersTable.get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(bordersRows);
+        algorithmFPType* borders = bordersRows.get();
+
+        const algorithmFPType maxVal = daal::services::internal::MaxVal<algorithmFPType>::get();
+        const algorithmFPType minBinSize = algorithmFPType(par.minBinSize);
+        daal::TlsMem<algorithmFPType, cpu> tlsValues(nBlocks*maxBins);
+        daal::TlsMem<algorithmFPType, cpu> tlsCounts(nBlocks*maxBins);
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature)
+        {
+            algorithmFPType* val = tlsValues.local();
+            algorithmFPType* cnt = tlsCounts.local();
+            DAAL_CHECK_MALLOC_THR(val && cnt);
+            size_t n = 0;
+            algorithmFPType total = 0;
+            for(size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+            {
+                const algorithmFPType* sketch = sketches.get() + iBlock*sketchSize + iFeature*2*maxBins;
+                for(size_t k = 0; k < maxBins; ++k)
+                {
+                    if(sketch[maxBins + k] > 0)
+                    {
+                        val[n] = sketch[k];
+                        cnt[n++] = sketch[maxBins + k];
+                        total += sketch[maxBins + k];
+                    }
+                }
+            }
+            daal::algorithms::internal::qSort<algorithmFPType, algorithmFPType, cpu>(n, val, cnt);
+
+            //cut the merged sketch into the bins of approximately equal number of observations
+            algorithmFPType* res = borders + iFeature*maxBins;
+            size_t nBins = 0;
+            algorithmFPType cum = 0;
+            algorithmFPType binCount = 0;
+            for(size_t k = 0; k < n; ++k)
+            {
+                cum += cnt[k];
+                binCount += cnt[k];
+                if((k + 1 < n) && (val[k + 1] == val[k]))
+                    continue;
+                if((nBins + 1 < maxBins) && (binCount >= minBinSize) && (cum*algorithmFPType(maxBins) >= algorithmFPType(nBins + 1)*total))
+                {
+                    res[nBins++] = val[k];
+                    binCount = 0;
+                }
+            }
+            if(nBins && (binCount < minBinSize))
+                res[nBins - 1] = maxVal;
+            else
+                res[nBins++] = maxVal;
+            for(size_t k = nBins; k < maxBins; ++k)
+                res[k] = maxVal;
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+
+    //the tree of the single leaf with zero response starts the training on the local nodes
+    NumericTablePtr treeTable = HomogenNumericTable<algorithmFPType>::create(treeNColumns, 1, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        WriteRows<algorithmFPType, cpu> treeRows(treeTable.get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(treeRows);
+        treeRows.get()[treeNodeStatus] = algorithmFPType(leafNodeStatus);
+    }
+    NumericTablePtr finishedTable = HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr initialResponseTable = HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, 0, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    partialResult.set(globalBinBorders, bordersTable);
+    partialResult.set(currentTree, treeTable);
+    partialResult.set(finished, finishedTable);
+    partialResult.get(trees)->clear();
+    DataCollection& internalData = *partialResult.get(internalMasterResult);
+    internalData[masterParentHistograms] = NumericTablePtr();
+    internalData[masterInitialResponse] = initialResponseTable;
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Master node: growth of the tree by one level
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class DistributedTreeGrower
+{
+public:
+    DistributedTreeGrower(const Parameter& par) : _par(par){}
+    services::Status run(const DataCollection *partialResults, DistributedStep2MasterPartialResult& partialResult);
+
+protected:
+    struct BestSplit
+    {
+        BestSplit() : iFeature(-1), iBin(0), gain(0), gLeft(0), hLeft(0), nLeft(0), g(0), h(0), n(0){}
+        int iFeature;
+        size_t iBin;
+        algorithmFPType gain;
+        algorithmFPType gLeft;
+        algorithmFPType hLeft;
+        algorithmFPType nLeft;
+        algorithmFPType g;
+        algorithmFPType h;
+        algorithmFPType n;
+    };
+
+    void findBestSplit(const algorithmFPType* hist, size_t level, BestSplit& split) const;
+    algorithmFPType impurity(algorithmFPType g, algorithmFPType h) const { return (g/(h + algorithmFPType(_par.lambda)))*g; }
+    algorithmFPType leafValue(algorithmFPType g, algorithmFPType h) const
+    {
+        const algorithmFPType denom = h + algorithmFPType(_par.lambda);
+        const algorithmFPType val = (denom > 0) ? -(g/denom)*algorithmFPType(_par.shrinkage) : algorithmFPType(0);
+        return _bFirstTree ? val + _initialF : val;
+    }
+
+protected:
+    const Parameter& _par;
+    const DistributedBins<algorithmFPType, cpu>* _bins = nullptr;
+    bool _bFirstTree = false;
+    algorithmFPType _initialF = 0;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+void DistributedTreeGrower<algorithmFPType, cpu>::findBestSplit(const algorithmFPType* hist, size_t level, BestSplit& split) const
+{
+    //totals of the node are the same for every feature
+    for(size_t iBin = 0; iBin < _bins->nBins(0); ++iBin)
+    {
+        const algorithmFPType* p = hist + iBin*3;
+        split.g += p[0];
+        split.h += p[1];
+        split.n += p[2];
+    }
+    const algorithmFPType minObs = algorithmFPType(_par.minObservationsInLeafNode);
+    if((split.n < 2*minObs) || ((_par.maxTreeDepth > 0) && (level >= _par.maxTreeDepth)))
+        return;
+
+    const algorithmFPType imp = impurity(split.g, split.h);
+    split.gain = algorithmFPType(_par.minSplitLoss);
+    for(size_t iFeature = 0; iFeature < _bins->nFeatures(); ++iFeature)
+    {
+        const algorithmFPType* h = hist + _bins->offset(iFeature)*3;
+        algorithmFPType gLeft = 0;
+        algorithmFPType hLeft = 0;
+        algorithmFPType nLeft = 0;
+        for(size_t iBin = 0; iBin + 1 < _bins->nBins(iFeature); ++iBin)
+        {
+            gLeft += h[iBin*3];
+            hLeft += h[iBin*3 + 1];
+            nLeft += h[iBin*3 + 2];
+            if(nLeft < minObs)
+                continue;
+            if(split.n - nLeft < minObs)
+                break;
+            const algorithmFPType gain = impurity(gLeft, hLeft) + impurity(split.g - gLeft, split.h - hLeft) - imp;
+            if(gain > split.gain)
+            {
+                split.iFeature = int(iFeature);
+                split.iBin = iBin;
+                split.gain = gain;
+                split.gLeft = gLeft;
+                split.hLeft = hLeft;
+                split.nLeft = nLeft;
+            }
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedTreeGrower<algorithmFPType, cpu>::run(const DataCollection *partialResults,
+    DistributedStep2MasterPartialResult& partialResult)
+{
+    NumericTablePtr bordersTable = partialResult.get(globalBinBorders);
+    DataCollectionPtr treesCollection = partialResult.get(trees);
+    DataCollectionPtr internalDataPtr = partialResult.get(internalMasterResult);
+    DAAL_CHECK(bordersTable && partialResult.get(currentTree) && treesCollection && internalDataPtr &&
+        (internalDataPtr->size() == lastMasterDataId + 1), ErrorNullPartialResult);
+    DataCollection& internalData = *internalDataPtr;
+
+    const size_t nFeatures = bordersTable->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> bordersRows(bordersTable.get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(bordersRows);
+    DistributedBins<algorithmFPType, cpu> bins(bordersRows.get(), nFeatures, bordersTable->getNumberOfColumns());
+    DAAL_CHECK_MALLOC(bins.init());
+    _bins = &bins;
+    const size_t totalBins = bins.totalBins();
+    const size_t histSize = totalBins*3;
+
+    //copy of the current tree with the room for the children of its open and derived nodes
+    TVector<algorithmFPType, cpu> nodesVec;
+    size_t nNodes = 0;
+    {
+        NumericTable* treeTable = partialResult.get(currentTree).get();
+        const size_t nRows = treeTable->getNumberOfRows();
+        ReadRows<algorithmFPType, cpu> treeRows(treeTable, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(treeRows);
+        const algorithmFPType* pTree = treeRows.get();
+        size_t nGrowing = 0;
+        for(size_t iNode = 0; iNode < nRows; ++iNode)
+        {
+            const int status = nodeStatus(pTree, iNode);
+            nGrowing += ((status == openNodeStatus) || (status == derivedNodeStatus)) ? 1 : 0;
+        }
+        if(nGrowing)
+        {
+            nNodes = nRows;
+            nodesVec.reset((nNodes + 2*nGrowing)*treeNColumns);
+            DAAL_CHECK_MALLOC(nodesVec.get());
+            for(size_t i = 0; i < nNodes*treeNColumns; ++i)
+                nodesVec[i] = pTree[i];
+        }
+        else
+        {
+            //the tree is complete, the histograms are computed for the root of the next tree
+            nNodes = 1;
+            nodesVec.reset(3*treeNColumns);
+            DAAL_CHECK_MALLOC(nodesVec.get());
+            nodesVec.setAll(0);
+            nodesVec[treeNodeStatus] = algorithmFPType(openNodeStatus);
+        }
+    }
+    algorithmFPType* nodes = nodesVec.get();
+
+    TVector<int, cpu> histSlot(nNodes, -1);
+    DAAL_CHECK_MALLOC(histSlot.get());
+    size_t nCompute = 0;
+    for(size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        if(nodeStatus(nodes, iNode) == openNodeStatus)
+            histSlot[iNode] = int(nCompute++);
+    }
+    size_t nDerived = 0;
+    for(size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        if(nodeStatus(nodes, iNode) == derivedNodeStatus)
+            histSlot[iNode] = int(nCompute + nDerived++);
+    }
+
+    //merge the histograms computed on the local nodes
+    TVector<algorithmFPType, cpu> hist((nCompute + nDerived)*histSize, algorithmFPType(0));
+    DAAL_CHECK_MALLOC(hist.get());
+    for(size_t iBlock = 0; iBlock < partialResults->size(); ++iBlock)
+    {
+        NumericTable* histTable = static_cast<DistributedStep1LocalPartialResult*>((*partialResults)[iBlock].get())->get(histograms).get();
+        DAAL_CHECK(histTable->getNumberOfRows() == nCompute*totalBins, ErrorIncorrectNumberOfRows);
+        ReadRows<algorithmFPType, cpu> histRows(histTable, 0, nCompute*totalBins);
+        DAAL_CHECK_BLOCK_STATUS(histRows);
+        const algorithmFPType* p = histRows.get();
+        algorithmFPType* pHist = hist.get();
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nCompute*histSize; ++i)
+            pHist[i] += p[i];
+    }
+
+    //local nodes do not account the initial response while the first tree is built
+    services::Status s;
+    _bFirstTree = (treesCollection->size() == 0);
+    NumericTable* initialResponseTable = static_cast<NumericTable*>(internalData[masterInitialResponse].get());
+    DAAL_CHECK(initialResponseTable, ErrorNullPartialResult);
+    {
+        WriteRows<algorithmFPType, cpu> initialResponseRows(initialResponseTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(initialResponseRows);
+        if(_bFirstTree && (nNodes == 1))
+        {
+            algorithmFPType g = 0;
+            algorithmFPType n = 0;
+            for(size_t iBin = 0; iBin < bins.nBins(0); ++iBin)
+            {
+                g += hist[iBin*3];
+                n += hist[iBin*3 + 2];
+            }
+            initialResponseRows.get()[0] = (n > 0) ? -g/n : algorithmFPType(0);
+        }
+        _initialF = initialResponseRows.get()[0];
+    }
+    if(_bFirstTree)
+    {
+        for(size_t i = 0; i < nCompute*totalBins; ++i)
+            hist[i*3] += _initialF*hist[i*3 + 2];
+    }
+
+    //histograms of the derived nodes are the differences of the parent and sibling histograms
+    if(nDerived)
+    {
+        NumericTable* parentTable = static_cast<NumericTable*>(internalData[masterParentHistograms].get());
+        DAAL_CHECK(parentTable && (parentTable->getNumberOfRows() == nDerived*totalBins), ErrorNullPartialResult);
+        ReadRows<algorithmFPType, cpu> parentRows(parentTable, 0, nDerived*totalBins);
+        DAAL_CHECK_BLOCK_STATUS(parentRows);
+        const algorithmFPType* parent = parentRows.get();
+        for(size_t iNode = 0; iNode < nNodes; ++iNode)
+        {
+            if(nodeStatus(nodes, iNode) != derivedNodeStatus)
+                continue;
+            const size_t iSibling = (iNode % 2) ? iNode + 1 : iNode - 1;
+            DAAL_ASSERT(histSlot[iSibling] >= 0 && histSlot[iSibling] < nCompute);
+            const algorithmFPType* pParent = parent + (histSlot[iNode] - nCompute)*histSize;
+            const algorithmFPType* pSibling = hist.get() + histSlot[iSibling]*histSize;
+            algorithmFPType* pNode = hist.get() + histSlot[iNode]*histSize;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < histSize; ++i)
+                pNode[i] = pParent[i] - pSibling[i];
+        }
+    }
+
+    //splits of the nodes are found in parallel
+    TVector<size_t, cpu> growing(nCompute + nDerived);
+    TVector<BestSplit, cpu> splits(nCompute + nDerived, BestSplit());
+    DAAL_CHECK_MALLOC(growing.get() && splits.get());
+    for(size_t iNode = 0, i = 0; iNode < nNodes; ++iNode)
+    {
+        if(histSlot[iNode] >= 0)
+            growing[i++] = iNode;
+    }
+    daal::threader_for(nCompute + nDerived, nCompute + nDerived, [&](size_t i)
+    {
+        const size_t iNode = growing[i];
+        findBestSplit(hist.get() + histSlot[iNode]*histSize, nodeValue(nodes, iNode, treeNodeLevel), splits[i]);
+    });
+
+    //the children are appended to the tree, the histogram of the smaller child is computed on the local nodes
+    TVector<const algorithmFPType*, cpu> newParents(nCompute + nDerived);
+    DAAL_CHECK_MALLOC(newParents.get());
+    size_t nNewParents = 0;
+    const size_t nNodesBefore = nNodes;
+    for(size_t i = 0; i < nCompute + nDerived; ++i)
+    {
+        const size_t iNode = growing[i];
+        const BestSplit& split = splits[i];
+        algorithmFPType* node = nodes + iNode*treeNColumns;
+        node[treeNodeCount] = split.n;
+        node[treeNodeImpurity] = impurity(split.g, split.h);
+        if(split.iFeature < 0)
+        {
+            node[treeNodeStatus] = algorithmFPType(leafNodeStatus);
+            node[treeNodeValue] = leafValue(split.g, split.h);
+            continue;
+        }
+        node[treeNodeStatus] = algorithmFPType(splitNodeStatus);
+        node[treeFeatureIndex] = algorithmFPType(split.iFeature);
+        node[treeSplitBin] = algorithmFPType(split.iBin);
+        node[treeLeftChild] = algorithmFPType(nNodes);
+        const bool bLeftSmaller = (split.nLeft <= split.n - split.nLeft);
+        for(size_t iKid = 0; iKid < 2; ++iKid)
+        {
+            algorithmFPType* kid = nodes + (nNodes++)*treeNColumns;
+            for(size_t j = 0; j < treeNColumns; ++j)
+                kid[j] = 0;
+            kid[treeNodeLevel] = node[treeNodeLevel] + 1;
+            kid[treeNodeStatus] = algorithmFPType(((iKid == 0) == bLeftSmaller) ? openNodeStatus : derivedNodeStatus);
+        }
+        newParents[nNewParents++] = hist.get() + histSlot[iNode]*histSize;
+    }
+
+    NumericTablePtr treeTable = HomogenNumericTable<algorithmFPType>::create(treeNColumns, nNodes, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        WriteOnlyRows<algorithmFPType, cpu> treeRows(treeTable.get(), 0, nNodes);
+        DAAL_CHECK_BLOCK_STATUS(treeRows);
+        algorithmFPType* p = treeRows.get();
+        for(size_t i = 0; i < nNodes*treeNColumns; ++i)
+            p[i] = nodes[i];
+    }
+    partialResult.set(currentTree, treeTable);
+
+    NumericTablePtr parentTable;
+    if(nNewParents)
+    {
+        parentTable = HomogenNumericTable<algorithmFPType>::create(3, nNewParents*totalBins, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        WriteOnlyRows<algorithmFPType, cpu> parentRows(parentTable.get(), 0, nNewParents*totalBins);
+        DAAL_CHECK_BLOCK_STATUS(parentRows);
+        algorithmFPType* p = parentRows.get();
+        for(size_t i = 0; i < nNewParents; ++i)
+        {
+            for(size_t j = 0; j < histSize; ++j)
+                p[i*histSize + j] = newParents[i][j];
+        }
+    }
+    internalData[masterParentHistograms] = parentTable;
+
+    if(nNodes == nNodesBefore)
+    {
+        //no children were added, the tree is complete
+        treesCollection->push_back(treeTable);
+        if(treesCollection->size() >= _par.maxIterations)
+        {
+            WriteOnlyRows<int, cpu> finishedRows(partialResult.get(finished).get(), 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(finishedRows);
+            finishedRows.get()[0] = 1;
+        }
+    }
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// RegressionTrainDistrStep2Kernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::compute(const DataCollection *partialResults,
+    DistributedStep2MasterPartialResult& partialResult, const Parameter& par)
+{
+    const DistributedStep1LocalPartialResult* firstPartialResult =
+        static_cast<const DistributedStep1LocalPartialResult*>((*partialResults)[0].get());
+    if(firstPartialResult->get(binSketch))
+        return mergeBinSketches<algorithmFPType, cpu>(partialResults, partialResult, par);
+
+    DistributedTreeGrower<algorithmFPType, cpu> grower(par);
+    return grower.run(partialResults, partialResult);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+gbt::internal::TreeImpRegression<>::NodeType::Base* buildTreeNode(gbt::internal::TreeImpRegression<>& tree,
+    const algorithmFPType* nodes, size_t iNode, const DistributedBins<algorithmFPType, cpu>& bins)
+{
+    typedef gbt::internal::TreeImpRegression<>::NodeType NodeType;
+    const algorithmFPType* node = nodes + iNode*treeNColumns;
+    if(nodeStatus(nodes, iNode) == splitNodeStatus)
+    {
+        typename NodeType::Split* pNode = tree.allocator().allocSplit();
+        const size_t iFeature = nodeValue(nodes, iNode, treeFeatureIndex);
+        const size_t iLeft = nodeValue(nodes, iNode, treeLeftChild);
+        pNode->set(int(iFeature), bins.border(iFeature, nodeValue(nodes, iNode, treeSplitBin)), false);
+        pNode->kid[0] = buildTreeNode<algorithmFPType, cpu>(tree, nodes, iLeft, bins);
+        pNode->kid[1] = buildTreeNode<algorithmFPType, cpu>(tree, nodes, iLeft + 1, bins);
+        pNode->count = nodeValue(nodes, iNode, treeNodeCount);
+        pNode->impurity = node[treeNodeImpurity];
+        return pNode;
+    }
+    typename NodeType::Leaf* pNode = tree.allocator().allocLeaf();
+    pNode->response = node[treeNodeValue];
+    pNode->count = nodeValue(nodes, iNode, treeNodeCount);
+    pNode->impurity = node[treeNodeImpurity];
+    return pNode;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(
+    const DistributedStep2MasterPartialResult& partialResult, gbt::regression::Model& m, const Parameter& par)
+{
+    gbt::internal::ModelImpl& md = *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl*>(&m);
+    md.clear();
+
+    NumericTablePtr bordersTable = partialResult.get(globalBinBorders);
+    DataCollectionPtr treesCollection = partialResult.get(trees);
+    const size_t nFeatures = bordersTable->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> bordersRows(bordersTable.get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(bordersRows);
+    DistributedBins<algorithmFPType, cpu> bins(bordersRows.get(), nFeatures, bordersTable->getNumberOfColumns());
+    DAAL_CHECK_MALLOC(bins.init());
+
+    const size_t nTrees = treesCollection->size();
+    DAAL_CHECK_MALLOC(md.reserve(nTrees));
+    services::Status s;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        NumericTable* treeTable = static_cast<NumericTable*>((*treesCollection)[iTree].get());
+        ReadRows<algorithmFPType, cpu> treeRows(treeTable, 0, treeTable->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(treeRows);
+
+        gbt::internal::TreeImpRegression<> tree;
+        tree.reset(buildTreeNode<algorithmFPType, cpu>(tree, treeRows.get(), 0, bins), false);
+
+        gbt::internal::GbtDecisionTree* pTbl = nullptr;
+        HomogenNumericTable<double>* pTblImp = nullptr;
+        HomogenNumericTable<int>* pTblSmplCnt = nullptr;
+        DAAL_CHECK_STATUS(s, gbt::internal::ModelImpl::treeToTable(tree, &pTbl, &pTblImp, &pTblSmplCnt, nFeatures));
+        md.add(pTbl, pTblImp, pTblSmplCnt);
+    }
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace regression */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -51,8 +51,74 @@ class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
-        gbt::regression::Model& m, Result& res, const Parameter& par,
+        const NumericTable *xValid, const NumericTable *yValid, const gbt::regression::Model *mInit,
+        const tree_utils::BinnedFeatures *xBinned,
+        gbt::regression::Model& m, Result& res, const interface1::Parameter& par,
         engines::internal::BatchBaseImpl& engine);
+    services::Status compute(HostAppIface* pHostApp, const NumericTable *x, const NumericTable *y,
+        const NumericTable *xValid, const NumericTable *yValid, const gbt::regression::Model *mInit,
+        const tree_utils::BinnedFeatures *xBinned,
+        gbt::regression::Model& m, Result& res, const interface2::Parameter& par,
+        engines::internal::BatchBaseImpl& engine);
+};
+
+/* Columns of the table describing the tree exchanged between the nodes in the distributed processing mode.
+   One row per node, the children of a split node are stored in the consecutive rows */
+enum DistributedTreeColumn
+{
+    treeFeatureIndex = 0, /* Index of the split feature */
+    treeSplitBin,         /* Index of the last bin of the split feature going to the left child */
+    treeLeftChild,        /* Row of the left child, the right child follows it */
+    treeNodeStatus,       /* DistributedNodeStatus */
+    treeNodeValue,        /* Response of the leaf */
+    treeNodeLevel,        /* Level of the node, 0 for the root */
+    treeNodeCount,        /* Number of observations in the node */
+    treeNodeImpurity,     /* Impurity of the node */
+    treeNColumns
+};
+
+enum DistributedNodeStatus
+{
+    splitNodeStatus = 0, /* Split node */
+    leafNodeStatus,      /* Leaf */
+    openNodeStatus,      /* Node which histogram is computed on the local nodes */
+    derivedNodeStatus    /* Node which histogram is derived on the master node as the difference of the parent and sibling histograms */
+};
+
+/* Elements of the data collection kept on the local node between the iterations */
+enum DistributedLocalDataId
+{
+    localBinnedData = 0, /* Indices of the bins of the features of the local observations */
+    localResponse,       /* Current response of the ensemble for the local observations */
+    localRowNode,        /* Node of the current tree containing the observation */
+    lastLocalDataId = localRowNode
+};
+
+/* Elements of the data collection kept on the master node between the iterations */
+enum DistributedMasterDataId
+{
+    masterParentHistograms = 0, /* Histograms of the parents of the derived nodes */
+    masterInitialResponse,      /* Initial response of the ensemble */
+    lastMasterDataId = masterInitialResponse
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep1Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable *x, const NumericTable *y, const NumericTable *binBorders,
+        const NumericTable *tree, const DataCollectionPtr& internalInput, DistributedStep1LocalPartialResult& partialResult,
+        const Parameter& par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const DataCollection *partialResults, DistributedStep2MasterPartialResult& partialResult,
+        const Parameter& par);
+    services::Status finalizeCompute(const DistributedStep2MasterPartialResult& partialResult, gbt::regression::Model& m,
+        const Parameter& par);
 };
 
 } // namespace internal
@@ -0,0 +1,242 @@
+/* file: gbt_regression_training_distr_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression training classes
+//  in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "gbt_regression_train_kernel.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedStep1LocalPartialResult, SERIALIZATION_GBT_REGRESSION_TRAINING_DISTRIBUTED_STEP1_PARTIAL_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedStep2MasterPartialResult, SERIALIZATION_GBT_REGRESSION_TRAINING_DISTRIBUTED_STEP2_PARTIAL_RESULT_ID);
+
+using internal::treeNColumns;
+
+/** Default constructor */
+DistributedStep1LocalInput::DistributedStep1LocalInput() : Input(lastDistributedLocalInputDataId + 1) {}
+
+NumericTablePtr DistributedStep1LocalInput::get(DistributedStep1LocalInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalInput::set(DistributedStep1LocalInputId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+DataCollectionPtr DistributedStep1LocalInput::get(DistributedLocalInputDataId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalInput::set(DistributedLocalInputDataId id, const DataCollectionPtr &value)
+{
+    Argument::set(id, value);
+}
+
+Status DistributedStep1LocalInput::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, Input::check(par, method));
+    const gbt::regression::training::Parameter* parameter = static_cast<const gbt::regression::training::Parameter*>(par);
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    const size_t nRows = get(data)->getNumberOfRows();
+    DAAL_CHECK_EX(get(dependentVariable)->getNumberOfRows() == nRows,
+        ErrorIncorrectNumberOfRows, ArgumentName, dependentVariableStr());
+
+    NumericTablePtr binBordersTable = get(binBorders);
+    if(!binBordersTable)
+        return s;
+
+    DAAL_CHECK_STATUS(s, checkNumericTable(binBordersTable.get(), binBordersStr(), 0, 0, parameter->maxBins, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(tree).get(), treeStr(), 0, 0, treeNColumns));
+
+    DataCollectionPtr internalData = get(internalInput);
+    if(internalData && internalData->size())
+    {
+        DAAL_CHECK_EX(internalData->size() == internal::lastLocalDataId + 1,
+            ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, internalInputStr());
+        NumericTable *binnedData = dynamic_cast<NumericTable *>((*internalData)[internal::localBinnedData].get());
+        DAAL_CHECK_STATUS(s, checkNumericTable(binnedData, internalInputStr(), 0, 0, nFeatures, nRows));
+        NumericTable *response = dynamic_cast<NumericTable *>((*internalData)[internal::localResponse].get());
+        DAAL_CHECK_STATUS(s, checkNumericTable(response, internalInputStr(), 0, 0, 1, nRows));
+        NumericTable *rowNode = dynamic_cast<NumericTable *>((*internalData)[internal::localRowNode].get());
+        DAAL_CHECK_STATUS(s, checkNumericTable(rowNode, internalInputStr(), 0, 0, 1, nRows));
+    }
+    return s;
+}
+
+DistributedStep1LocalPartialResult::DistributedStep1LocalPartialResult() :
+    daal::algorithms::PartialResult(lastDistributedStep1LocalPartialResultDataId + 1) {}
+
+NumericTablePtr DistributedStep1LocalPartialResult::get(DistributedStep1LocalPartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalPartialResult::set(DistributedStep1LocalPartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+DataCollectionPtr DistributedStep1LocalPartialResult::get(DistributedStep1LocalPartialResultDataId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalPartialResult::set(DistributedStep1LocalPartialResultDataId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+Status DistributedStep1LocalPartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    /* Sizes of the partial results depend on the tree and are checked on computation */
+    return Status();
+}
+
+DistributedStep2MasterInput::DistributedStep2MasterInput() : daal::algorithms::Input(lastDistributedStep2MasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+DataCollectionPtr DistributedStep2MasterInput::get(DistributedStep2MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep2MasterInput::set(DistributedStep2MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void DistributedStep2MasterInput::add(DistributedStep2MasterInputId id, const DistributedStep1LocalPartialResultPtr &value)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(value);
+}
+
+Status DistributedStep2MasterInput::check(const daal::algorithms::Parameter *par, int method) const
+{
+    const gbt::regression::training::Parameter* parameter = static_cast<const gbt::regression::training::Parameter*>(par);
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    DistributedStep1LocalPartialResult *firstPres = dynamic_cast<DistributedStep1LocalPartialResult *>((*collection)[0].get());
+    DAAL_CHECK(firstPres, ErrorIncorrectElementInPartialResultCollection);
+
+    /* All the local nodes compute either the sketches of the bins or the histograms of the same nodes of the tree */
+    const bool isSketch = firstPres->get(binSketch).get() != nullptr;
+    NumericTable *firstTable = isSketch ? firstPres->get(binSketch).get() : firstPres->get(histograms).get();
+    const char *description = isSketch ? binSketchStr() : histogramsStr();
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(firstTable, description, 0, 0, isSketch ? 2 * parameter->maxBins : 3));
+    const size_t nRows = firstTable->getNumberOfRows();
+
+    for(size_t i = 1; i < nBlocks; i++)
+    {
+        DistributedStep1LocalPartialResult *pres = dynamic_cast<DistributedStep1LocalPartialResult *>((*collection)[i].get());
+        DAAL_CHECK(pres, ErrorIncorrectElementInPartialResultCollection);
+        NumericTable *table = isSketch ? pres->get(binSketch).get() : pres->get(histograms).get();
+        DAAL_CHECK_STATUS(s, checkNumericTable(table, description, 0, 0, firstTable->getNumberOfColumns(), nRows));
+    }
+    return s;
+}
+
+DistributedStep2MasterPartialResult::DistributedStep2MasterPartialResult() :
+    daal::algorithms::PartialResult(lastDistributedStep2MasterPartialResultDataId + 1) {}
+
+NumericTablePtr DistributedStep2MasterPartialResult::get(DistributedStep2MasterPartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep2MasterPartialResult::set(DistributedStep2MasterPartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+DataCollectionPtr DistributedStep2MasterPartialResult::get(DistributedStep2MasterPartialResultDataId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep2MasterPartialResult::set(DistributedStep2MasterPartialResultDataId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+bool DistributedStep2MasterPartialResult::isFinished() const
+{
+    NumericTablePtr finishedTable = get(finished);
+    if(!finishedTable)
+        return false;
+    BlockDescriptor<int> block;
+    finishedTable->getBlockOfRows(0, 1, readOnly, block);
+    const bool bFinished = block.getBlockPtr() && (block.getBlockPtr()[0] != 0);
+    finishedTable->releaseBlockOfRows(block);
+    return bFinished;
+}
+
+Status DistributedStep2MasterPartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    DAAL_CHECK(get(trees), ErrorNullPartialResultDataCollection);
+    DAAL_CHECK(get(internalMasterResult), ErrorNullPartialResultDataCollection);
+    return Status();
+}
+
+Status DistributedStep2MasterPartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(globalBinBorders).get(), globalBinBordersStr()));
+    DataCollectionPtr treesCollection = get(trees);
+    DAAL_CHECK(treesCollection, ErrorNullPartialResultDataCollection);
+    DAAL_CHECK_EX(treesCollection->size() > 0, ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, currentTreeStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -33,7 +33,11 @@ namespace algorithms
 {
 namespace gbt
 {
-namespace training { Status checkImpl(const gbt::training::Parameter& prm); }
+namespace training
+{
+Status checkImpl(const gbt::training::interface1::Parameter& prm);
+Status checkImpl(const gbt::training::interface2::Parameter& prm);
+}
 
 namespace regression
 {
@@ -48,8 +52,26 @@ Status Parameter::check() const
     return gbt::training::checkImpl(*this);
 }
 
+} // namespace interface1
+
+namespace interface2
+{
+
+Parameter::Parameter() : loss(squared){}
+Status Parameter::check() const
+{
+    return gbt::training::checkImpl(*this);
+}
+
+} // namespace interface2
+
+namespace interface1
+{
+
 /** Default constructor */
-Input::Input() : algorithms::regression::training::Input(lastInputId + 1) {}
+Input::Input() : algorithms::regression::training::Input(lastInputBinnedFeaturesId + 1) {}
+
+Input::Input(size_t nElements) : algorithms::regression::training::Input(nElements) {}
 
 /**
  * Returns an input object for gradient boosted trees model-based training
@@ -71,6 +93,46 @@ void Input::set(InputId id, const NumericTablePtr &value)
     algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
 }
 
+/**
+ * Returns an input model for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input model
+ * \return          %Input model that corresponds to the given identifier
+ */
+gbt::regression::ModelPtr Input::get(InputModelId id) const
+{
+    return staticPointerCast<gbt::regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input model for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input model
+ * \param[in] value   Pointer to the model
+ */
+void Input::set(InputModelId id, const gbt::regression::ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Returns the input binned features for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input binned features
+ * \return          %Input binned features that correspond to the given identifier
+ */
+tree_utils::BinnedFeaturesPtr Input::get(InputBinnedFeaturesId id) const
+{
+    return staticPointerCast<tree_utils::BinnedFeatures, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input binned features for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input binned features
+ * \param[in] value   Pointer to the binned features
+ */
+void Input::set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value)
+{
+    Argument::set(id, value);
+}
+
 /**
 * Checks an input object for the gradient boosted trees algorithm
 * \param[in] par     Algorithm parameter
@@ -88,13 +150,40 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     DAAL_CHECK_EX(dependentVariableTable->getNumberOfColumns() == 1,
         ErrorIncorrectNumberOfColumns, ArgumentName, dependentVariableStr());
 
-    const Parameter* parameter = static_cast<const Parameter*>(par);
+    /* The parameter of both interfaces derives from gbt::training::interface1::Parameter */
+    const gbt::training::interface1::Parameter* parameter = dynamic_cast<const gbt::training::interface1::Parameter*>(par);
+    DAAL_CHECK(parameter, ErrorNullParameterNotSupported);
     const size_t nSamplesPerTree(parameter->observationsPerTreeFraction*dataTable->getNumberOfRows());
     DAAL_CHECK_EX(nSamplesPerTree > 0,
         ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures,
         ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+
+    const NumericTablePtr validationDataTable = get(validationData);
+    if(validationDataTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(validationDataTable.get(), validationDataStr(), 0, 0, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(validationDependentVariable).get(), validationDependentVariableStr(), 0, 0, 1,
+            validationDataTable->getNumberOfRows()));
+    }
+    else
+    {
+        DAAL_CHECK_EX(get(validationDependentVariable).get() == nullptr, ErrorIncorrectOptionalInput, ArgumentName, validationDependentVariableStr());
+    }
+
+    const gbt::regression::ModelPtr m = get(inputModel);
+    if(m)
+    {
+        DAAL_CHECK_EX(m->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+    }
+
+    const tree_utils::BinnedFeaturesPtr bf = get(binnedFeatures);
+    if(bf)
+    {
+        DAAL_CHECK_EX(bf->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, binnedFeaturesStr());
+        DAAL_CHECK_EX(bf->getNumberOfRows() == dataTable->getNumberOfRows(), ErrorIncorrectNumberOfObservations, ArgumentName, binnedFeaturesStr());
+    }
     return s;
 }
 
@@ -39,13 +39,21 @@ using namespace daal::data_management;
 
 template<typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const Parameter *parameter, const int method)
+{
+    return allocate<algorithmFPType>(input, static_cast<const daal::algorithms::Parameter *>(parameter), method);
+}
+
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     services::Status s;
     const Input* inp = static_cast<const Input*>(input);
     const size_t nFeatures = inp->get(data)->getNumberOfColumns();
     set(model, daal::algorithms::gbt::regression::Model::create(nFeatures, &s));
 
-    const Parameter *par = static_cast<const Parameter *>(parameter);
+    /* The parameter of both interfaces derives from gbt::training::interface1::Parameter */
+    const gbt::training::interface1::Parameter *par = dynamic_cast<const gbt::training::interface1::Parameter *>(parameter);
+    DAAL_CHECK(par, services::ErrorNullParameterNotSupported);
     if(par->resultsToCompute & gbt::training::computeWeight)
     {
         set(variableImportanceWeight, data_management::HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, data_management::NumericTable::doAllocate, 0, &s));
@@ -71,6 +79,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 }
 
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const Parameter *parameter, const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
 } // namespace training
 } // namespace regression
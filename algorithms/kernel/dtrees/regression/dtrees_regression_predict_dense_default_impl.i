@@ -80,17 +80,24 @@ protected:
         return val;
     }
     services::Status run(services::HostAppIface* pHostApp, algorithmFPType factor);
+    services::Status runFlat(services::HostAppIface* pHostApp, algorithmFPType factor);
 
 protected:
+    typedef dtrees::internal::FlatForest<algorithmFPType> FlatForestType;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const dtrees::internal::DecisionTreeTable*, cpu> _aTree;
+    services::SharedPtr<const FlatForestType> _flatForest; //if set, it is used instead of _aTree, set only for the data without unordered features
     const NumericTable* _data;
     NumericTable* _res;
+    static const size_t s_cRowsInFlatBlock = 64; //number of rows advanced through a tree together
 };
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface* pHostApp, algorithmFPType factor)
 {
+    if(_flatForest.get())
+        return runFlat(pHostApp, factor);
+
     const auto nTreesTotal = _aTree.size();
     const auto treeSize = _aTree[0]->getNumberOfRows()*sizeof(dtrees::internal::DecisionTreeNode);
 
@@ -132,6 +139,70 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
     return s;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::runFlat(services::HostAppIface* pHostApp, algorithmFPType factor)
+{
+    typedef typename FlatForestType::IndexType IndexType;
+    typedef dtrees::prediction::internal::FlatTreeTraversal<algorithmFPType, cpu> Traversal;
+    const FlatForestType& forest = *_flatForest;
+    const size_t nTreesTotal = forest.getNumberOfTrees();
+    const size_t treeSize = forest.getAverageTreeSize()*FlatForestType::getNodeSize();
+
+    dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
+    const size_t nThreads = daal::threader_get_threads_number();
+    SafeStatus safeStat;
+    services::Status s;
+    HostAppHelper host(pHostApp, 100);
+    for(size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
+    {
+        if(!s || host.isCancelled(s, 1))
+            return s;
+        const size_t nTreesToUse = ((iTree + dim.nTreesInBlock) < nTreesTotal ? dim.nTreesInBlock : (nTreesTotal - iTree));
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock)
+        {
+            const size_t iStartRow = iBlock*dim.nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            algorithmFPType* res = resBD.get() + iStartRow;
+            const size_t nFlatBlocks = nRowsToProcess / s_cRowsInFlatBlock + !!(nRowsToProcess % s_cRowsInFlatBlock);
+            auto predictFlatBlock = [&](size_t iFlatBlock)
+            {
+                IndexType leaf[s_cRowsInFlatBlock];
+                algorithmFPType val[s_cRowsInFlatBlock];
+                const size_t iFirstRow = iFlatBlock*s_cRowsInFlatBlock;
+                const size_t nRows = (iFlatBlock == nFlatBlocks - 1) ? nRowsToProcess - iFirstRow : s_cRowsInFlatBlock;
+                const algorithmFPType* x = xBD.get() + iFirstRow*dim.nCols;
+                for(size_t i = 0; i < nRows; ++i)
+                    val[i] = 0;
+                for(size_t j = iTree; j < iTree + nTreesToUse; ++j)
+                {
+                    const algorithmFPType* fv = forest.featureValue(j);
+                    Traversal::findLeaves(x, nRows, dim.nCols, forest.featureIndex(j), forest.leftIndexOrClass(j), fv, leaf);
+                    for(size_t i = 0; i < nRows; ++i)
+                        val[i] += fv[leaf[i]];
+                }
+                for(size_t i = 0; i < nRows; ++i)
+                    res[iFirstRow + i] += factor*val[i];
+            };
+            if(nFlatBlocks < 2 || dim.nDataBlocks >= nThreads || cpu == __avx512_mic__)
+            {
+                for(size_t iFlatBlock = 0; iFlatBlock < nFlatBlocks; ++iFlatBlock)
+                    predictFlatBlock(iFlatBlock);
+            }
+            else
+            {
+                daal::threader_for(nFlatBlocks, nFlatBlocks, predictFlatBlock);
+            }
+        });
+        s = safeStat.detach();
+    }
+    return s;
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -0,0 +1,444 @@
+/* file: hnsw_knn_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the approximate k-nearest neighbors search in the hierarchical navigable small world graph
+//--
+*/
+
+#ifndef __HNSW_KNN_IMPL_I__
+#define __HNSW_KNN_IMPL_I__
+
+#include "daal_defines.h"
+#include "service_defines.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace internal
+{
+
+#define __HNSW_KNN_DEFAULT_VECTOR_SIZE 64
+#define __HNSW_KNN_DEFAULT_VISITED_SET_SIZE 1024
+
+/** Graph node paired with its squared distance to the point being searched */
+template <typename algorithmFPType>
+struct Candidate
+{
+    algorithmFPType distance;
+    int index;
+};
+
+/** Growable array of objects without constructors */
+template <typename T, CpuType cpu>
+class Vector
+{
+public:
+    DAAL_NEW_DELETE();
+
+    Vector() : _data(nullptr), _size(0), _capacity(0) {}
+
+    ~Vector() { daal::services::daal_free(_data); }
+
+    Vector(const Vector &) = delete;
+    Vector &operator= (const Vector &) = delete;
+
+    bool pushBack(const T &value)
+    {
+        if (_size >= _capacity && !grow(_size + 1)) { return false; }
+        _data[_size++] = value;
+        return true;
+    }
+
+    bool reserve(size_t capacity)
+    {
+        return capacity <= _capacity || grow(capacity);
+    }
+
+    void popBack() { --_size; }
+    void clear() { _size = 0; }
+    size_t size() const { return _size; }
+    T *data() { return _data; }
+    const T *data() const { return _data; }
+    T &operator[] (size_t i) { return _data[i]; }
+    const T &operator[] (size_t i) const { return _data[i]; }
+
+private:
+    bool grow(size_t minCapacity)
+    {
+        size_t capacity = (_capacity ? _capacity * 2 : __HNSW_KNN_DEFAULT_VECTOR_SIZE);
+        if (capacity < minCapacity) { capacity = minCapacity; }
+
+        T *data = static_cast<T *>(daal::services::daal_malloc(capacity * sizeof(T)));
+        if (!data) { return false; }
+        if (_data)
+        {
+            daal::services::daal_memcpy_s(data, capacity * sizeof(T), _data, _size * sizeof(T));
+            daal::services::daal_free(_data);
+        }
+        _data = data;
+        _capacity = capacity;
+        return true;
+    }
+
+    T *_data;
+    size_t _size;
+    size_t _capacity;
+};
+
+/**
+ * Set of graph nodes visited by one search. The set is an open addressing hash table whose slots are
+ * tagged with the number of the search, so starting a new search does not touch the memory of the table
+ * and its size is proportional to the number of visited nodes rather than to the size of the graph.
+ */
+template <CpuType cpu>
+class VisitedSet
+{
+public:
+    DAAL_NEW_DELETE();
+
+    VisitedSet() : _keys(nullptr), _tags(nullptr), _capacity(0), _size(0), _tag(0) {}
+
+    ~VisitedSet() { release(); }
+
+    VisitedSet(const VisitedSet &) = delete;
+    VisitedSet &operator= (const VisitedSet &) = delete;
+
+    /** Starts a new search. Returns false if the memory cannot be allocated */
+    bool reset()
+    {
+        _size = 0;
+        if (!_capacity) { return rehash(__HNSW_KNN_DEFAULT_VISITED_SET_SIZE); }
+        if (++_tag == 0)
+        {
+            /* Tags wrapped around, so the slots tagged long ago are cleared explicitly */
+            for (size_t i = 0; i < _capacity; ++i) { _tags[i] = 0; }
+            _tag = 1;
+        }
+        return true;
+    }
+
+    /**
+     * Adds a node to the set
+     * \return 1 if the node is added, 0 if it is already in the set, -1 if the memory cannot be allocated
+     */
+    int insert(int key)
+    {
+        if (2 * (_size + 1) > _capacity && !rehash(2 * _capacity)) { return -1; }
+        if (!find(key)) { return 0; }
+        ++_size;
+        return 1;
+    }
+
+private:
+    /** Returns true if the key has been added to the table and false if it is already there */
+    bool find(int key)
+    {
+        const size_t mask = _capacity - 1;
+        size_t i = (size_t)((unsigned int)key * 2654435761u) & mask;
+        while (_tags[i] == _tag)
+        {
+            if (_keys[i] == key) { return false; }
+            i = (i + 1) & mask;
+        }
+        _tags[i] = _tag;
+        _keys[i] = key;
+        return true;
+    }
+
+    bool rehash(size_t capacity)
+    {
+        int *keys = services::internal::service_malloc<int, cpu>(capacity);
+        unsigned int *tags = services::internal::service_calloc<unsigned int, cpu>(capacity);
+        if (!keys || !tags)
+        {
+            services::internal::service_free<int, cpu>(keys);
+            services::internal::service_free<unsigned int, cpu>(tags);
+            return false;
+        }
+
+        int *oldKeys = _keys;
+        unsigned int *oldTags = _tags;
+        const size_t oldCapacity = _capacity;
+        const unsigned int oldTag = _tag;
+
+        _keys = keys;
+        _tags = tags;
+        _capacity = capacity;
+        _tag = 1;
+        for (size_t i = 0; i < oldCapacity; ++i)
+        {
+            if (oldTags[i] == oldTag) { find(oldKeys[i]); }
+        }
+
+        services::internal::service_free<int, cpu>(oldKeys);
+        services::internal::service_free<unsigned int, cpu>(oldTags);
+        return true;
+    }
+
+    void release()
+    {
+        services::internal::service_free<int, cpu>(_keys);
+        services::internal::service_free<unsigned int, cpu>(_tags);
+        _keys = nullptr;
+        _tags = nullptr;
+    }
+
+    int *_keys;
+    unsigned int *_tags;
+    size_t _capacity;
+    size_t _size;
+    unsigned int _tag;
+};
+
+/** Raw view of the graph stored in the model tables */
+template <typename algorithmFPType, CpuType cpu>
+struct Graph
+{
+    const algorithmFPType *data;  /* Row-major training data */
+    size_t nFeatures;
+    int *baseLinks;               /* Links on the bottom layer, 2 * maxNeighbors + 1 per node */
+    int *upperLinks;              /* Links on the upper layers, maxNeighbors + 1 per node and layer */
+    const int *upperOffsets;
+    size_t maxNeighbors;
+
+    /** Returns the list of links of the node on the layer. The first element is the number of links */
+    int *links(size_t node, size_t level) const
+    {
+        return (level == 0 ? baseLinks + node * (2 * maxNeighbors + 1) :
+                             upperLinks + (upperOffsets[node] + level - 1) * (maxNeighbors + 1));
+    }
+
+    size_t capacity(size_t level) const { return (level == 0 ? 2 * maxNeighbors : maxNeighbors); }
+
+    algorithmFPType distance(const algorithmFPType *point, size_t node) const
+    {
+        return squaredDistance(point, data + node * nFeatures);
+    }
+
+    algorithmFPType squaredDistance(const algorithmFPType *a, const algorithmFPType *b) const
+    {
+        algorithmFPType sum = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            const algorithmFPType d = a[j] - b[j];
+            sum += d * d;
+        }
+        return sum;
+    }
+};
+
+/** Restores the heap property after an element is appended to the heap. The element for which less() is false is on top */
+template <typename T, typename Less>
+DAAL_FORCEINLINE void heapPush(T *heap, size_t size, Less less)
+{
+    size_t i = size - 1;
+    const T value = heap[i];
+    while (i > 0)
+    {
+        const size_t parent = (i - 1) / 2;
+        if (!less(heap[parent], value)) { break; }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = value;
+}
+
+/** Moves the top of the heap of the given size to its last position and restores the heap property of the rest */
+template <typename T, typename Less>
+DAAL_FORCEINLINE void heapPop(T *heap, size_t size, Less less)
+{
+    const size_t last = size - 1;
+    const T value = heap[last];
+    heap[last] = heap[0];
+    size_t i = 0;
+    for (size_t child = 1; child < last; child = 2 * i + 1)
+    {
+        if (child + 1 < last && less(heap[child], heap[child + 1])) { ++child; }
+        if (!less(value, heap[child])) { break; }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = value;
+}
+
+template <typename algorithmFPType>
+struct CloserFirst
+{
+    bool operator() (const Candidate<algorithmFPType> &a, const Candidate<algorithmFPType> &b) const { return a.distance > b.distance; }
+};
+
+template <typename algorithmFPType>
+struct FartherFirst
+{
+    bool operator() (const Candidate<algorithmFPType> &a, const Candidate<algorithmFPType> &b) const { return a.distance < b.distance; }
+};
+
+/** Per-thread buffers of the graph search */
+template <typename algorithmFPType, CpuType cpu>
+struct SearchBuffers
+{
+    DAAL_NEW_DELETE();
+
+    VisitedSet<cpu> visited;
+    Vector<Candidate<algorithmFPType>, cpu> candidates;  /* Min-heap of the nodes to expand */
+    Vector<Candidate<algorithmFPType>, cpu> results;     /* Max-heap of the nearest found nodes */
+    Vector<Candidate<algorithmFPType>, cpu> selected;
+
+    static SearchBuffers *create() { return new SearchBuffers(); }
+};
+
+/**
+ * Moves greedily from the entry node to its neighbor closest to the point on the given layer
+ * until no neighbor is closer than the current node
+ */
+template <typename algorithmFPType, CpuType cpu>
+Candidate<algorithmFPType> greedySearch(const Graph<algorithmFPType, cpu> &graph, const algorithmFPType *point,
+                                        Candidate<algorithmFPType> entry, size_t level)
+{
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        const int *list = graph.links(entry.index, level);
+        const int nLinks = list[0];
+        for (int i = 1; i <= nLinks; ++i)
+        {
+            const algorithmFPType d = graph.distance(point, list[i]);
+            if (d < entry.distance)
+            {
+                entry.distance = d;
+                entry.index = list[i];
+                changed = true;
+            }
+        }
+    }
+    return entry;
+}
+
+/**
+ * Searches the ef nodes closest to the point on the given layer starting from the nodes already stored in results.
+ * On exit results is a max-heap of at most ef nodes
+ * \return false if the memory cannot be allocated
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool searchLayer(const Graph<algorithmFPType, cpu> &graph, const algorithmFPType *point, size_t ef, size_t level,
+                 SearchBuffers<algorithmFPType, cpu> &buf)
+{
+    typedef Candidate<algorithmFPType> CandidateType;
+    const CloserFirst<algorithmFPType> closerFirst;
+    const FartherFirst<algorithmFPType> fartherFirst;
+
+    Vector<CandidateType, cpu> &candidates = buf.candidates;
+    Vector<CandidateType, cpu> &results = buf.results;
+    if (!buf.visited.reset()) { return false; }
+    candidates.clear();
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (buf.visited.insert(results[i].index) < 0 || !candidates.pushBack(results[i])) { return false; }
+        heapPush(candidates.data(), candidates.size(), closerFirst);
+    }
+    for (size_t i = 1; i <= results.size(); ++i) { heapPush(results.data(), i, fartherFirst); }
+    while (results.size() > ef)
+    {
+        heapPop(results.data(), results.size(), fartherFirst);
+        results.popBack();
+    }
+
+    while (candidates.size())
+    {
+        heapPop(candidates.data(), candidates.size(), closerFirst);
+        const CandidateType current = candidates[candidates.size() - 1];
+        candidates.popBack();
+        if (results.size() >= ef && current.distance > results[0].distance) { break; }
+
+        const int *list = graph.links(current.index, level);
+        const int nLinks = list[0];
+        for (int i = 1; i <= nLinks; ++i)
+        {
+            const int isNew = buf.visited.insert(list[i]);
+            if (isNew < 0) { return false; }
+            if (!isNew) { continue; }
+
+            CandidateType next;
+            next.distance = graph.distance(point, list[i]);
+            next.index = list[i];
+            if (results.size() < ef || next.distance < results[0].distance)
+            {
+                if (!candidates.pushBack(next) || !results.pushBack(next)) { return false; }
+                heapPush(candidates.data(), candidates.size(), closerFirst);
+                heapPush(results.data(), results.size(), fartherFirst);
+                if (results.size() > ef)
+                {
+                    heapPop(results.data(), results.size(), fartherFirst);
+                    results.popBack();
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Sorts the max-heap of candidates by the increasing distance
+ */
+template <typename algorithmFPType, CpuType cpu>
+void sortHeap(Vector<Candidate<algorithmFPType>, cpu> &heap)
+{
+    const FartherFirst<algorithmFPType> fartherFirst;
+    for (size_t size = heap.size(); size > 1; --size) { heapPop(heap.data(), size, fartherFirst); }
+}
+
+/**
+ * Selects at most maxCount neighbors from the candidates sorted by the increasing distance. A candidate is kept
+ * if it is closer to the base point than to every neighbor selected before it, so the links of the node point
+ * in diverse directions and the graph stays connected across clusters
+ * \return Number of the selected neighbors stored in the beginning of candidates
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t selectNeighbors(const Graph<algorithmFPType, cpu> &graph, Candidate<algorithmFPType> *candidates, size_t nCandidates, size_t maxCount)
+{
+    size_t nSelected = 0;
+    for (size_t i = 0; i < nCandidates && nSelected < maxCount; ++i)
+    {
+        const Candidate<algorithmFPType> c = candidates[i];
+        const algorithmFPType *point = graph.data + c.index * graph.nFeatures;
+        bool keep = true;
+        for (size_t j = 0; j < nSelected && keep; ++j)
+        {
+            keep = (graph.distance(point, candidates[j].index) >= c.distance);
+        }
+        if (keep) { candidates[nSelected++] = c; }
+    }
+    return nSelected;
+}
+
+} // namespace internal
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
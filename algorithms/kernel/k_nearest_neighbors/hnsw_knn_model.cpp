@@ -0,0 +1,93 @@
+/* file: hnsw_knn_model.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the approximate k-nearest neighbors search model
+//--
+*/
+
+#include "hnsw_knn_model_impl.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Model, SERIALIZATION_HNSW_KNN_MODEL_ID);
+
+Model::Model() : daal::algorithms::Model(), _impl(new ModelImpl()) {}
+
+Model::~Model()
+{
+    delete _impl;
+}
+
+Model::Model(size_t nFeatures, services::Status &st) : _impl(new ModelImpl(nFeatures))
+{
+    DAAL_CHECK_COND_ERROR(_impl, st, services::ErrorMemoryAllocationFailed);
+}
+
+services::SharedPtr<Model> Model::create(size_t nFeatures, services::Status *stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(Model, nFeatures);
+}
+
+services::Status Model::serializeImpl(data_management::InputDataArchive *arch)
+{
+    daal::algorithms::Model::serialImpl<data_management::InputDataArchive, false>(arch);
+    return _impl->serialImpl<data_management::InputDataArchive, false>(arch);
+}
+
+services::Status Model::deserializeImpl(const data_management::OutputDataArchive *arch)
+{
+    daal::algorithms::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
+    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+}
+
+size_t Model::getNumberOfFeatures() const
+{
+    return _impl->getNumberOfFeatures();
+}
+
+size_t Model::getNumberOfPoints() const
+{
+    return _impl->getNumberOfPoints();
+}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(k >= 1, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+    DAAL_CHECK_EX(maxNeighbors >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxNeighborsStr());
+    DAAL_CHECK_EX(efConstruction >= 1, services::ErrorIncorrectParameter, services::ParameterName, efConstructionStr());
+    DAAL_CHECK_EX(efSearch >= 1, services::ErrorIncorrectParameter, services::ParameterName, efSearchStr());
+    DAAL_CHECK_EX(engine.get() != NULL, services::ErrorIncorrectParameter, services::ParameterName, engineStr());
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,148 @@
+/* file: hnsw_knn_model_impl.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the approximate k-nearest neighbors search model
+//--
+*/
+
+#ifndef __HNSW_KNN_MODEL_IMPL_
+#define __HNSW_KNN_MODEL_IMPL_
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace interface1
+{
+
+/**
+ * The graph is stored layer by layer in integer tables:
+ *  - levels:       nPoints x 1, the top layer of each point;
+ *  - baseLinks:    nPoints x (2 * maxNeighbors + 1), the number of links followed by the links on the bottom layer;
+ *  - upperOffsets: nPoints x 1, the row of the point's first upper layer in upperLinks;
+ *  - upperLinks:   sum(levels) x (maxNeighbors + 1), the number of links followed by the links on the layers 1, 2, ...
+ *                  of the point. The links of point i on layer l > 0 are in the row upperOffsets[i] + l - 1.
+ */
+class Model::ModelImpl
+{
+public:
+    /**
+     * Empty constructor for deserialization
+     */
+    ModelImpl(size_t nFeatures = 0) : _nFeatures(nFeatures), _maxNeighbors(0), _entryPoint(0), _maxLevel(0) {}
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    /**
+     *  Retrieves the number of points in the graph
+     *  \return Number of points in the graph
+     */
+    size_t getNumberOfPoints() const { return _data ? _data->getNumberOfRows() : 0; }
+
+    size_t getMaxNeighbors() const { return _maxNeighbors; }
+    size_t getEntryPoint() const { return _entryPoint; }
+    size_t getMaxLevel() const { return _maxLevel; }
+
+    void setMaxNeighbors(size_t value) { _maxNeighbors = value; }
+    void setEntryPoint(size_t value) { _entryPoint = value; }
+    void setMaxLevel(size_t value) { _maxLevel = value; }
+
+    data_management::NumericTablePtr getData() const { return _data; }
+    data_management::NumericTablePtr getLevels() const { return _levels; }
+    data_management::NumericTablePtr getBaseLinks() const { return _baseLinks; }
+    data_management::NumericTablePtr getUpperOffsets() const { return _upperOffsets; }
+    data_management::NumericTablePtr getUpperLinks() const { return _upperLinks; }
+
+    void setLevels(const data_management::NumericTablePtr &value) { _levels = value; }
+    void setBaseLinks(const data_management::NumericTablePtr &value) { _baseLinks = value; }
+    void setUpperOffsets(const data_management::NumericTablePtr &value) { _upperOffsets = value; }
+    void setUpperLinks(const data_management::NumericTablePtr &value) { _upperLinks = value; }
+
+    /**
+     * Sets the training data. The data is always copied to the row-major layout
+     * expected by the distance computations of the graph search
+     * \param[in]  value  Training data
+     * \return Status of the operation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT DAAL_FORCEINLINE services::Status setData(const data_management::NumericTablePtr &value)
+    {
+        services::Status st;
+        const size_t nRows = value->getNumberOfRows();
+        const size_t nCols = value->getNumberOfColumns();
+        data_management::NumericTablePtr tbl = data_management::HomogenNumericTable<algorithmFPType>::create(nCols, nRows,
+                                                                                                            data_management::NumericTable::doAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        data_management::BlockDescriptor<algorithmFPType> destBD, srcBD;
+        DAAL_CHECK_STATUS(st, tbl->getBlockOfRows(0, nRows, data_management::writeOnly, destBD));
+        st = value->getBlockOfRows(0, nRows, data_management::readOnly, srcBD);
+        if (st)
+        {
+            services::daal_memcpy_s(destBD.getBlockPtr(), nCols * nRows * sizeof(algorithmFPType),
+                                    srcBD.getBlockPtr(), nCols * nRows * sizeof(algorithmFPType));
+            value->releaseBlockOfRows(srcBD);
+        }
+        tbl->releaseBlockOfRows(destBD);
+        DAAL_CHECK_STATUS_VAR(st);
+        _data = tbl;
+        return st;
+    }
+
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        arch->set(_nFeatures);
+        arch->set(_maxNeighbors);
+        arch->set(_entryPoint);
+        arch->set(_maxLevel);
+        arch->setSharedPtrObj(_data);
+        arch->setSharedPtrObj(_levels);
+        arch->setSharedPtrObj(_baseLinks);
+        arch->setSharedPtrObj(_upperOffsets);
+        arch->setSharedPtrObj(_upperLinks);
+
+        return services::Status();
+    }
+
+private:
+    size_t _nFeatures;
+    size_t _maxNeighbors;
+    size_t _entryPoint;
+    size_t _maxLevel;
+    data_management::NumericTablePtr _data;
+    data_management::NumericTablePtr _levels;
+    data_management::NumericTablePtr _baseLinks;
+    data_management::NumericTablePtr _upperOffsets;
+    data_management::NumericTablePtr _upperLinks;
+};
+
+} // namespace interface1
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,161 @@
+/* file: hnsw_knn_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search.
+//
+//  A query descends greedily from the entry point through the upper layers of the graph and then searches
+//  efSearch candidates on the bottom layer. Blocks of queries are processed in parallel.
+//--
+*/
+
+#ifndef __HNSW_KNN_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __HNSW_KNN_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "service_error_handling.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "hnsw_knn_model_impl.h"
+#include "hnsw_knn_predict_kernel.h"
+#include "hnsw_knn_impl.i"
+
+/* Number of queries processed by one task */
+#define __HNSW_KNN_QUERY_BLOCK_SIZE 64
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace daal::algorithms::hnsw_knn::internal;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status HNSWPredictBatchKernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, const Model *model, NumericTable *indices,
+                                                                              NumericTable *distances, const Parameter *par)
+{
+    typedef Math<algorithmFPType, cpu> MathType;
+
+    const Model::ModelImpl *impl = model->impl();
+    const size_t nPoints = impl->getNumberOfPoints();
+    const size_t nFeatures = impl->getNumberOfFeatures();
+    const size_t maxNeighbors = impl->getMaxNeighbors();
+    const size_t maxLevel = impl->getMaxLevel();
+    const size_t entryPoint = impl->getEntryPoint();
+    const size_t nQueries = x->getNumberOfRows();
+    const size_t k = par->k;
+    const size_t ef = (par->efSearch > k ? par->efSearch : k);
+
+    /* The upper layers are absent if the graph has a single layer */
+    NumericTable *upperLinksTable = (maxLevel ? impl->getUpperLinks().get() : nullptr);
+    ReadRows<algorithmFPType, cpu> dataRows(impl->getData().get(), 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+    ReadRows<int, cpu> baseLinksRows(impl->getBaseLinks().get(), 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(baseLinksRows);
+    ReadRows<int, cpu> upperOffsetsRows(impl->getUpperOffsets().get(), 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(upperOffsetsRows);
+    ReadRows<int, cpu> upperLinksRows(upperLinksTable, 0, (upperLinksTable ? upperLinksTable->getNumberOfRows() : 0));
+    DAAL_CHECK_BLOCK_STATUS(upperLinksRows);
+
+    Graph<algorithmFPType, cpu> graph;
+    graph.data = dataRows.get();
+    graph.nFeatures = nFeatures;
+    graph.baseLinks = const_cast<int *>(baseLinksRows.get());
+    graph.upperLinks = const_cast<int *>(upperLinksRows.get());
+    graph.upperOffsets = upperOffsetsRows.get();
+    graph.maxNeighbors = maxNeighbors;
+
+    daal::tls<SearchBuffers<algorithmFPType, cpu> *> tlsBuffers([=]() -> SearchBuffers<algorithmFPType, cpu> *
+    {
+        return SearchBuffers<algorithmFPType, cpu>::create();
+    });
+
+    const size_t nBlocks = (nQueries + __HNSW_KNN_QUERY_BLOCK_SIZE - 1) / __HNSW_KNN_QUERY_BLOCK_SIZE;
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        SearchBuffers<algorithmFPType, cpu> *buf = tlsBuffers.local();
+        DAAL_CHECK_MALLOC_THR(buf);
+
+        const size_t first = iBlock * __HNSW_KNN_QUERY_BLOCK_SIZE;
+        const size_t nRows = (first + __HNSW_KNN_QUERY_BLOCK_SIZE < nQueries ? __HNSW_KNN_QUERY_BLOCK_SIZE : nQueries - first);
+
+        ReadRows<algorithmFPType, cpu> queryRows(const_cast<NumericTable *>(x), first, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+        WriteOnlyRows<int, cpu> indicesRows(indices, first, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+        WriteOnlyRows<algorithmFPType, cpu> distancesRows(distances, first, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const algorithmFPType *query = queryRows.get() + i * nFeatures;
+
+            Candidate<algorithmFPType> entry;
+            entry.index = (int)entryPoint;
+            entry.distance = graph.distance(query, entryPoint);
+            for (size_t l = maxLevel; l > 0; --l)
+            {
+                entry = greedySearch(graph, query, entry, l);
+            }
+
+            buf->results.clear();
+            DAAL_CHECK_MALLOC_THR(buf->results.pushBack(entry));
+            DAAL_CHECK_MALLOC_THR(searchLayer(graph, query, ef, 0, *buf));
+            sortHeap(buf->results);
+
+            int *outIndices = indicesRows.get() + i * k;
+            algorithmFPType *outDistances = distancesRows.get() + i * k;
+            const size_t nFound = (buf->results.size() < k ? buf->results.size() : k);
+            for (size_t j = 0; j < nFound; ++j)
+            {
+                outIndices[j] = buf->results[j].index;
+                outDistances[j] = buf->results[j].distance;
+            }
+            MathType::vSqrt(nFound, outDistances, outDistances);
+            for (size_t j = nFound; j < k; ++j)
+            {
+                outIndices[j] = -1;
+                outDistances[j] = MaxVal<algorithmFPType>::get();
+            }
+        }
+    });
+
+    tlsBuffers.reduce([](SearchBuffers<algorithmFPType, cpu> *buf)
+    {
+        delete buf;
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,58 @@
+/* file: hnsw_knn_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the kernel of the approximate k-nearest neighbors search.
+//--
+*/
+
+#ifndef __HNSW_KNN_PREDICT_KERNEL_H__
+#define __HNSW_KNN_PREDICT_KERNEL_H__
+
+#include "numeric_table.h"
+#include "algorithm_base_common.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class HNSWPredictBatchKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable *x, const Model *model, NumericTable *indices, NumericTable *distances,
+                             const Parameter *par);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
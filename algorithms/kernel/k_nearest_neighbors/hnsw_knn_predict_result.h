@@ -0,0 +1,62 @@
+/* file: hnsw_knn_predict_result.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search prediction result.
+//--
+*/
+
+#ifndef __HNSW_KNN_PREDICT_RESULT_
+#define __HNSW_KNN_PREDICT_RESULT_
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace prediction
+{
+
+/**
+ * Allocates memory to store the result of the approximate k-nearest neighbors search
+ * \param[in] input     Pointer to an object containing the input data
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    const size_t nRows = algInput->get(data)->getNumberOfRows();
+
+    services::Status status;
+    set(indices, data_management::HomogenNumericTable<int>::create(par->k, nRows, data_management::NumericTable::doAllocate, &status));
+    set(distances, data_management::HomogenNumericTable<algorithmFPType>::create(par->k, nRows, data_management::NumericTable::doAllocate, &status));
+    return status;
+}
+
+} // namespace prediction
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,164 @@
+/* file: hnsw_knn_predict_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search prediction classes.
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_predict_types.h"
+#include "hnsw_knn_model_impl.h"
+#include "serialization_utils.h"
+#include "daal_defines.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_HNSW_KNN_PREDICTION_RESULT_ID);
+
+Input::Input() : daal::algorithms::Input(lastModelInputId + 1) {}
+
+/**
+ * Returns an input numeric table of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(NumericTableInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns an input model of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(NumericTableInputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets an input model of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(ModelInputId id, const ModelPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks input objects of the approximate k-nearest neighbors search algorithm
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const ModelPtr m = get(model);
+    DAAL_CHECK(m, ErrorNullModel);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), 0, 0, m->getNumberOfFeatures()));
+
+    const Model::ModelImpl *impl = m->impl();
+    const size_t nPoints = impl->getNumberOfPoints();
+    DAAL_CHECK(nPoints > 0, ErrorModelNotFullInitialized);
+    DAAL_CHECK(impl->getMaxNeighbors() >= 2, ErrorModelNotFullInitialized);
+    DAAL_CHECK(impl->getEntryPoint() < nPoints, ErrorModelNotFullInitialized);
+
+    const size_t maxNeighbors = impl->getMaxNeighbors();
+    s |= checkNumericTable(impl->getLevels().get(), modelStr(), 0, 0, 1, nPoints);
+    s |= checkNumericTable(impl->getUpperOffsets().get(), modelStr(), 0, 0, 1, nPoints);
+    s |= checkNumericTable(impl->getBaseLinks().get(), modelStr(), 0, 0, 2 * maxNeighbors + 1, nPoints);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    if (impl->getMaxLevel() > 0)
+    {
+        s |= checkNumericTable(impl->getUpperLinks().get(), modelStr(), 0, 0, maxNeighbors + 1);
+        DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the approximate k-nearest neighbors search algorithm
+ * \param[in] id    Identifier of the result
+ * \param[in] value Pointer to the object
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of the approximate k-nearest neighbors search algorithm
+ * \param[in] input     %Input object of the algorithm
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    const size_t nRows = algInput->get(data)->getNumberOfRows();
+    const int unexpectedLayouts = (int)packed_mask;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(indices).get(), indicesStr(), unexpectedLayouts, 0, par->k, nRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(distances).get(), distancesStr(), unexpectedLayouts, 0, par->k, nRows));
+    return s;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
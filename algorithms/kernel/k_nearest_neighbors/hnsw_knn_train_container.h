@@ -0,0 +1,78 @@
+/* file: hnsw_knn_train_container.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search training container.
+//--
+*/
+
+#ifndef __HNSW_KNN_TRAIN_CONTAINER_H__
+#define __HNSW_KNN_TRAIN_CONTAINER_H__
+
+#include "kernel.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_batch.h"
+#include "hnsw_knn_train_kernel.h"
+#include "hnsw_knn_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace training
+{
+namespace interface1
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::HNSWTrainBatchKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    const Input *input = static_cast<const Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    const Parameter *par = static_cast<const Parameter *>(_par);
+
+    const data_management::NumericTablePtr x = input->get(data);
+    const ModelPtr m = result->get(model);
+
+    services::Status s = m->impl()->setData<algorithmFPType>(x);
+    if (!s) { return s; }
+
+    __DAAL_CALL_KERNEL(env, internal::HNSWTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+                       compute, m->impl()->getData().get(), m.get(), par, *par->engine);
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,326 @@
+/* file: hnsw_knn_train_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search training.
+//
+//  Every node gets a random top layer drawn from the exponentially decaying distribution and is linked on each
+//  of its layers to the neighbors found by the greedy search in the graph built so far. The node with the highest
+//  layer is inserted first and stays the entry point of the graph. The rest of the nodes are inserted in batches
+//  whose size is proportional to the size of the graph built so far. The nodes of a batch are searched and linked
+//  to the graph in parallel, then the reverse links are added under per-node locks.
+//--
+*/
+
+#ifndef __HNSW_KNN_TRAIN_DENSE_DEFAULT_IMPL_I__
+#define __HNSW_KNN_TRAIN_DENSE_DEFAULT_IMPL_I__
+
+#include "threading.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "service_numeric_table.h"
+#include "service_math.h"
+#include "service_rng.h"
+#include "engine_batch_impl.h"
+#include "hnsw_knn_model_impl.h"
+#include "hnsw_knn_train_kernel.h"
+#include "hnsw_knn_impl.i"
+
+/* Maximal layer of a node of the graph */
+#define __HNSW_KNN_MAX_LEVEL 32
+/* The nodes inserted in parallel make up at most 1 / __HNSW_KNN_BATCH_FRACTION of the nodes already in the graph,
+   so that the nodes of a batch, which cannot link to each other, are rarely close neighbors */
+#define __HNSW_KNN_BATCH_FRACTION 8
+/* Number of locks protecting the links of the nodes. Must be a power of 2 */
+#define __HNSW_KNN_LOCK_POOL_SIZE 4096
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace training
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace daal::algorithms::hnsw_knn::internal;
+
+struct NodeLock
+{
+    DAAL_NEW_DELETE();
+    Mutex mutex;
+};
+
+/** Striped pool of locks, each lock protects the links of the nodes with the same lower bits of the index */
+class LockPool
+{
+public:
+    LockPool(size_t size) : _locks(new NodeLock[size]), _mask(size - 1) {}
+    ~LockPool() { delete[] _locks; }
+
+    bool ok() const { return _locks != nullptr; }
+    Mutex &get(size_t node) { return _locks[node & _mask].mutex; }
+
+private:
+    LockPool(const LockPool &);
+    LockPool &operator= (const LockPool &);
+
+    NodeLock *_locks;
+    size_t _mask;
+};
+
+/**
+ * Searches the neighbors of the node in the graph and writes them to the links of the node on all its layers.
+ * Only the nodes inserted before the current batch are reachable, so the search reads the links that are not modified
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool connectNode(const Graph<algorithmFPType, cpu> &graph, size_t node, size_t level, size_t entryPoint, size_t maxLevel,
+                 size_t efConstruction, SearchBuffers<algorithmFPType, cpu> &buf)
+{
+    const algorithmFPType *point = graph.data + node * graph.nFeatures;
+
+    Candidate<algorithmFPType> entry;
+    entry.index = (int)entryPoint;
+    entry.distance = graph.distance(point, entryPoint);
+    for (size_t l = maxLevel; l > level; --l)
+    {
+        entry = greedySearch(graph, point, entry, l);
+    }
+
+    buf.results.clear();
+    if (!buf.results.pushBack(entry)) { return false; }
+
+    for (size_t l = level + 1; l-- > 0;)
+    {
+        if (!searchLayer(graph, point, efConstruction, l, buf)) { return false; }
+
+        /* The results stay the entry points of the search on the next layer */
+        Vector<Candidate<algorithmFPType>, cpu> &selected = buf.selected;
+        selected.clear();
+        if (!selected.reserve(buf.results.size())) { return false; }
+        for (size_t i = 0; i < buf.results.size(); ++i) { selected.pushBack(buf.results[i]); }
+        sortHeap(selected);
+
+        const size_t nSelected = selectNeighbors(graph, selected.data(), selected.size(), graph.maxNeighbors);
+        int *list = graph.links(node, l);
+        list[0] = (int)nSelected;
+        for (size_t i = 0; i < nSelected; ++i) { list[i + 1] = selected[i].index; }
+    }
+    return true;
+}
+
+/**
+ * Adds the link to the new node to the links of the target node on the layer.
+ * If the links of the target node are full, the closest diverse links are kept
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool addReverseLink(const Graph<algorithmFPType, cpu> &graph, size_t target, size_t node, size_t level, LockPool &locks,
+                    SearchBuffers<algorithmFPType, cpu> &buf)
+{
+    AutoLock lock(locks.get(target));
+
+    int *list = graph.links(target, level);
+    const size_t capacity = graph.capacity(level);
+    const size_t nLinks = (size_t)list[0];
+    if (nLinks < capacity)
+    {
+        list[nLinks + 1] = (int)node;
+        list[0] = (int)(nLinks + 1);
+        return true;
+    }
+
+    const FartherFirst<algorithmFPType> fartherFirst;
+    const algorithmFPType *point = graph.data + target * graph.nFeatures;
+    Vector<Candidate<algorithmFPType>, cpu> &selected = buf.selected;
+    selected.clear();
+    if (!selected.reserve(nLinks + 1)) { return false; }
+    for (size_t i = 0; i <= nLinks; ++i)
+    {
+        Candidate<algorithmFPType> c;
+        c.index = (i < nLinks ? list[i + 1] : (int)node);
+        c.distance = graph.distance(point, c.index);
+        selected.pushBack(c);
+        heapPush(selected.data(), selected.size(), fartherFirst);
+    }
+    sortHeap(selected);
+
+    const size_t nSelected = selectNeighbors(graph, selected.data(), selected.size(), capacity);
+    list[0] = (int)nSelected;
+    for (size_t i = 0; i < nSelected; ++i) { list[i + 1] = selected[i].index; }
+    return true;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status HNSWTrainBatchKernel<algorithmFPType, method, cpu>::compute(const NumericTable *x, Model *model, const Parameter *par,
+                                                                            engines::BatchBase &engine)
+{
+    typedef Math<algorithmFPType, cpu> MathType;
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t maxNeighbors = par->maxNeighbors;
+
+    ReadRows<algorithmFPType, cpu> dataRows(const_cast<NumericTable *>(x), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+
+    services::Status s;
+    NumericTablePtr levelsTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr offsetsTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteOnlyRows<int, cpu> levelsRows(levelsTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(levelsRows);
+    WriteOnlyRows<int, cpu> offsetsRows(offsetsTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(offsetsRows);
+    int *levels = levelsRows.get();
+    int *offsets = offsetsRows.get();
+
+    /* Draw the top layers of the nodes: floor(-ln(u) / ln(maxNeighbors)), u ~ U(0, 1) */
+    {
+        auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+        DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+        TArray<algorithmFPType, cpu> uniformArray(nRows);
+        algorithmFPType *uniform = uniformArray.get();
+        DAAL_CHECK_MALLOC(uniform);
+        RNGs<algorithmFPType, cpu> rng;
+        DAAL_CHECK(!rng.uniform(nRows, uniform, engineImpl->getState(), (algorithmFPType)0, (algorithmFPType)1), ErrorIncorrectErrorcodeFromGenerator);
+
+        const algorithmFPType minUniform = (algorithmFPType)1e-30;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            if (uniform[i] < minUniform) { uniform[i] = minUniform; }
+        }
+        MathType::vLog(nRows, uniform, uniform);
+
+        const algorithmFPType levelMultiplier = (algorithmFPType)1 / MathType::sLog((algorithmFPType)maxNeighbors);
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const algorithmFPType level = -uniform[i] * levelMultiplier;
+            levels[i] = (level < (algorithmFPType)__HNSW_KNN_MAX_LEVEL ? (int)level : __HNSW_KNN_MAX_LEVEL);
+        }
+    }
+
+    size_t entryPoint = 0;
+    size_t nUpperRows = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        if (levels[i] > levels[entryPoint]) { entryPoint = i; }
+        offsets[i] = (int)nUpperRows;
+        nUpperRows += levels[i];
+    }
+    DAAL_CHECK(nUpperRows <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfRows);
+    const size_t maxLevel = levels[entryPoint];
+
+    NumericTablePtr baseLinksTable = HomogenNumericTable<int>::create(2 * maxNeighbors + 1, nRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    NumericTablePtr upperLinksTable = HomogenNumericTable<int>::create(maxNeighbors + 1, (nUpperRows ? nUpperRows : 1), NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    WriteOnlyRows<int, cpu> baseLinksRows(baseLinksTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(baseLinksRows);
+    WriteOnlyRows<int, cpu> upperLinksRows(upperLinksTable.get(), 0, upperLinksTable->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(upperLinksRows);
+
+    Graph<algorithmFPType, cpu> graph;
+    graph.data = dataRows.get();
+    graph.nFeatures = nFeatures;
+    graph.baseLinks = baseLinksRows.get();
+    graph.upperLinks = upperLinksRows.get();
+    graph.upperOffsets = offsets;
+    graph.maxNeighbors = maxNeighbors;
+
+    for (size_t i = 0; i < nRows; ++i) { graph.baseLinks[i * (2 * maxNeighbors + 1)] = 0; }
+    for (size_t i = 0; i < nUpperRows; ++i) { graph.upperLinks[i * (maxNeighbors + 1)] = 0; }
+
+    LockPool locks(__HNSW_KNN_LOCK_POOL_SIZE);
+    DAAL_CHECK_MALLOC(locks.ok());
+
+    daal::tls<SearchBuffers<algorithmFPType, cpu> *> tlsBuffers([=]() -> SearchBuffers<algorithmFPType, cpu> *
+    {
+        return SearchBuffers<algorithmFPType, cpu>::create();
+    });
+
+    /* The entry point is in the graph from the start, the rest of the nodes are taken in the index order */
+    const size_t nToInsert = nRows - 1;
+    SafeStatus safeStat;
+    for (size_t nInserted = 0; nInserted < nToInsert && safeStat.ok();)
+    {
+        size_t batchSize = (nInserted + 1) / __HNSW_KNN_BATCH_FRACTION;
+        if (batchSize < 1) { batchSize = 1; }
+        if (batchSize > nToInsert - nInserted) { batchSize = nToInsert - nInserted; }
+        const size_t first = nInserted;
+
+        threader_for(batchSize, batchSize, [&](size_t i)
+        {
+            SearchBuffers<algorithmFPType, cpu> *buf = tlsBuffers.local();
+            DAAL_CHECK_MALLOC_THR(buf);
+            const size_t order = first + i;
+            const size_t node = (order < entryPoint ? order : order + 1);
+            DAAL_CHECK_MALLOC_THR(connectNode(graph, node, levels[node], entryPoint, maxLevel, par->efConstruction, *buf));
+        });
+        if (!safeStat.ok()) { break; }
+
+        threader_for(batchSize, batchSize, [&](size_t i)
+        {
+            SearchBuffers<algorithmFPType, cpu> *buf = tlsBuffers.local();
+            DAAL_CHECK_MALLOC_THR(buf);
+            const size_t order = first + i;
+            const size_t node = (order < entryPoint ? order : order + 1);
+            for (size_t l = 0; l <= (size_t)levels[node]; ++l)
+            {
+                const int *list = graph.links(node, l);
+                const int nLinks = list[0];
+                for (int j = 1; j <= nLinks; ++j)
+                {
+                    DAAL_CHECK_MALLOC_THR(addReverseLink(graph, list[j], node, l, locks, *buf));
+                }
+            }
+        });
+
+        nInserted += batchSize;
+    }
+
+    tlsBuffers.reduce([](SearchBuffers<algorithmFPType, cpu> *buf)
+    {
+        delete buf;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    Model::ModelImpl *impl = model->impl();
+    impl->setMaxNeighbors(maxNeighbors);
+    impl->setEntryPoint(entryPoint);
+    impl->setMaxLevel(maxLevel);
+    impl->setLevels(levelsTable);
+    impl->setUpperOffsets(offsetsTable);
+    impl->setBaseLinks(baseLinksTable);
+    impl->setUpperLinks(upperLinksTable);
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
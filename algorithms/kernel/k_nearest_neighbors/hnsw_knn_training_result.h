@@ -0,0 +1,58 @@
+/* file: hnsw_knn_training_result.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search training result.
+//--
+*/
+
+#ifndef __HNSW_KNN_TRAINING_RESULT_
+#define __HNSW_KNN_TRAINING_RESULT_
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace training
+{
+
+/**
+ * Allocates memory to store the result of the approximate k-nearest neighbors search training
+ * \param[in] input     Pointer to an object containing the input data
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status status;
+    const Input *algInput = static_cast<const Input *>(input);
+    set(model, Model::create(algInput->get(data)->getNumberOfColumns(), &status));
+    return status;
+}
+
+} // namespace training
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
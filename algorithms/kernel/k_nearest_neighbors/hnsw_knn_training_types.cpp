@@ -0,0 +1,124 @@
+/* file: hnsw_knn_training_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate k-nearest neighbors search training classes.
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_types.h"
+#include "service_data_utils.h"
+#include "serialization_utils.h"
+#include "daal_defines.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_HNSW_KNN_TRAINING_RESULT_ID);
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+
+/**
+ * Returns an input object of the approximate k-nearest neighbors search training
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object of the approximate k-nearest neighbors search training
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks input objects of the approximate k-nearest neighbors search training
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr()));
+    /* Graph links are stored as 32-bit integers */
+    DAAL_CHECK_EX(get(data)->getNumberOfRows() <= static_cast<size_t>(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRows,
+                  ArgumentName, dataStr());
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the approximate k-nearest neighbors search training
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+ModelPtr Result::get(ResultId id) const
+{
+    return staticPointerCast<Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the approximate k-nearest neighbors search training
+ * \param[in] id    Identifier of the result
+ * \param[in] value Pointer to the object
+ */
+void Result::set(ResultId id, const ModelPtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of the approximate k-nearest neighbors search training
+ * \param[in] input     %Input object of the algorithm
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const ModelPtr m = get(model);
+    DAAL_CHECK(m, ErrorNullModel);
+    const Input *algInput = static_cast<const Input *>(input);
+    DAAL_CHECK_EX(m->getNumberOfFeatures() == algInput->get(data)->getNumberOfColumns(), ErrorIncorrectNumberOfFeatures,
+                  ArgumentName, modelStr());
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
@@ -66,7 +66,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive  * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    _impl->serialImpl<const data_management::OutputDataArchive, true>(arch,
+        COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
 
     return services::Status();
 }
@@ -76,6 +77,35 @@ size_t Model::getNumberOfFeatures() const
     return _impl->getNumberOfFeatures();
 }
 
+services::Status Model::insertPoints(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels)
+{
+    return _impl->insertPoints(data, labels);
+}
+
+services::Status Model::removePoints(const data_management::NumericTablePtr & indices)
+{
+    return _impl->removePoints(indices);
+}
+
+double Model::getUpdateRatio() const
+{
+    return _impl->getUpdateRatio();
+}
+
+bool Model::isRebuildRecommended() const
+{
+    return _impl->isRebuildRecommended();
+}
+
+services::SharedPtr<Model> Model::rebuild(services::Status * stat) const
+{
+    services::SharedPtr<Model> model;
+    const services::Status s = _impl->rebuild(model);
+    if (stat) { *stat = s; }
+    if (!s) { model.reset(); }
+    return model;
+}
+
 services::Status Parameter::check() const
 {
     // Inherited.
@@ -98,6 +128,23 @@ services::Status Parameter::check() const
     return s;
 }
 }
+
+namespace interface3
+{
+services::Status Parameter::check() const
+{
+    // Inherited.
+    services::Status s = interface2::Parameter::check();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    DAAL_CHECK_EX(voteWeights == voteUniform || voteWeights == voteDistance, services::ErrorIncorrectParameter, services::ParameterName,
+                  voteWeightsStr());
+    DAAL_CHECK_EX(predictionMode == classVoting || predictionMode == responseAveraging, services::ErrorIncorrectParameter,
+                  services::ParameterName, predictionModeStr());
+    DAAL_CHECK_EX(rebuildThreshold > 0, services::ErrorIncorrectParameter, services::ParameterName, rebuildThresholdStr());
+    return s;
+}
+}
 } // namespace kdtree_knn_classification
 } // namespace algorithms
 } // namespace daal
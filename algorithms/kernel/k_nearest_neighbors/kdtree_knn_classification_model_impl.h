@@ -25,6 +25,7 @@
 #define __KDTREE_KNN_CLASSIFICATION_MODEL_IMPL_
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
+#include "service_defines.h"
 
 namespace daal
 {
@@ -59,13 +60,17 @@ public:
 typedef services::SharedPtr<KDTreeTable> KDTreeTablePtr;
 typedef services::SharedPtr<const KDTreeTable> KDTreeTableConstPtr;
 
+template <typename algorithmFPType>
+class ModelUpdater;
+
 class Model::ModelImpl
 {
 public:
     /**
      * Empty constructor for deserialization
      */
-    ModelImpl(size_t nFeatures = 0) : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _nFeatures(nFeatures) {}
+    ModelImpl(size_t nFeatures = 0) : _nFeatures(nFeatures), _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _indices(),
+        _squaredNorms(), _nextIndex(0), _nBuiltPoints(0), _nUpdatedPoints(0), _nUnusedRows(0), _rebuildThreshold(0.25), _capacity(0) {}
 
     /**
      * Returns the KD-tree table
@@ -122,7 +127,7 @@ public:
     data_management::NumericTablePtr getData() { return _data; }
 
     template<typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->set(_rootNodeIndex);
@@ -131,6 +136,25 @@ public:
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2020, 0, 0))
+        {
+            arch->setSharedPtrObj(_indices);
+            arch->set(_nextIndex);
+            arch->set(_nBuiltPoints);
+            arch->set(_nUpdatedPoints);
+            arch->set(_nUnusedRows);
+            arch->set(_rebuildThreshold);
+            arch->setSharedPtrObj(_squaredNorms);
+        }
+        else if (onDeserialize)
+        {
+            resetUpdates(_data ? _data->getNumberOfRows() : 0);
+        }
+        if (onDeserialize)
+        {
+            _capacity = 0;
+        }
+
         return services::Status();
     }
 
@@ -166,6 +190,42 @@ public:
         }
     }
 
+    /**
+     * Sets a training data stored in the row-major layout, as expected by the brute-force method
+     * \param[in]  value  Training data
+     * \param[in]  copy   Flag indicating necessary of data deep copying to avoid direct usage and modification of input data.
+     * \return Status of the operation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT DAAL_FORCEINLINE services::Status setRowMajorData(const data_management::NumericTablePtr & value, bool copy)
+    {
+        if (!copy)
+        {
+            _data = value;
+            return services::Status();
+        }
+
+        services::Status st;
+        const size_t nRows = value->getNumberOfRows();
+        const size_t nCols = value->getNumberOfColumns();
+        data_management::NumericTablePtr tbl = data_management::HomogenNumericTable<algorithmFPType>::create(nCols, nRows,
+                                                                                                            data_management::NumericTable::doAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        data_management::BlockDescriptor<algorithmFPType> destBD, srcBD;
+        DAAL_CHECK_STATUS(st, tbl->getBlockOfRows(0, nRows, data_management::writeOnly, destBD));
+        st = value->getBlockOfRows(0, nRows, data_management::readOnly, srcBD);
+        if (st)
+        {
+            services::daal_memcpy_s(destBD.getBlockPtr(), nCols * nRows * sizeof(algorithmFPType),
+                                    srcBD.getBlockPtr(), nCols * nRows * sizeof(algorithmFPType));
+            value->releaseBlockOfRows(srcBD);
+        }
+        tbl->releaseBlockOfRows(destBD);
+        DAAL_CHECK_STATUS_VAR(st);
+        _data = tbl;
+        return st;
+    }
+
     /**
      * Returns training labels
      * \return Training labels
@@ -211,18 +271,97 @@ public:
         }
     }
 
+    /**
+     * Returns the indices of the training points in the input dataset. The KD-tree training reorders the points,
+     * the i-th point of the model data is the point indices[i] of the input dataset
+     * \return Indices of the training points, empty for the models that keep the input order of the points
+     */
+    data_management::NumericTableConstPtr getIndices() const { return _indices; }
+
+    /**
+     * Sets the indices of the training points in the input dataset
+     * \param[in]  value  Indices of the training points
+     */
+    void setIndices(const data_management::NumericTablePtr & value) { _indices = value; }
+
+    /**
+     * Returns the squared Euclidean norms of the training points computed by the brute-force training
+     * \return Squared norms of the training points, empty if they are not computed or the model is updated after the training
+     */
+    data_management::NumericTableConstPtr getSquaredNorms() const { return _squaredNorms; }
+
+    /**
+     * Sets the squared Euclidean norms of the training points
+     * \param[in]  value  Squared norms of the training points
+     */
+    void setSquaredNorms(const data_management::NumericTablePtr & value) { _squaredNorms = value; }
+
     /**
      *  Retrieves the number of features in the dataset was used on the training stage
      *  \return Number of features in the dataset was used on the training stage
      */
     size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    /**
+     * Marks the model as built on the given number of points without the updates
+     * \param[in]  nPoints  Number of points the model is built on
+     */
+    void resetUpdates(size_t nPoints)
+    {
+        _squaredNorms.reset();
+        _nextIndex      = nPoints;
+        _nBuiltPoints   = nPoints;
+        _nUpdatedPoints = 0;
+        _nUnusedRows    = 0;
+        _capacity       = 0;
+    }
+
+    /**
+     * Sets the ratio of the updates starting from which the full rebuild of the model is recommended
+     * \param[in]  value  Rebuild threshold
+     */
+    void setRebuildThreshold(double value) { _rebuildThreshold = value; }
+
+    /**
+     * Returns the ratio of the updates of the model, \ref Model::getUpdateRatio
+     * \return Ratio of the updates of the model
+     */
+    double getUpdateRatio() const
+    {
+        return _nBuiltPoints ? double(_nUpdatedPoints + _nUnusedRows) / double(_nBuiltPoints) : double(_nUpdatedPoints + _nUnusedRows);
+    }
+
+    /**
+     * Checks if the full rebuild of the model is recommended, \ref Model::isRebuildRecommended
+     * \return True if the full rebuild of the model is recommended
+     */
+    bool isRebuildRecommended() const { return getUpdateRatio() > _rebuildThreshold; }
+
+    services::Status insertPoints(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels);
+
+    services::Status removePoints(const data_management::NumericTablePtr & indices);
+
+    services::Status rebuild(services::SharedPtr<Model> & model) const;
+
 private:
+    template <typename algorithmFPType>
+    friend class ModelUpdater;
+
     size_t _nFeatures;
     KDTreeTablePtr _kdTreeTable;
     size_t _rootNodeIndex;
     size_t _lastNodeIndex;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    data_management::NumericTablePtr _indices;
+    data_management::NumericTablePtr _squaredNorms; /* Squared norms of the rows of the data, kept by the brute-force method */
+    size_t _nextIndex;         /* Index of the next inserted point */
+    size_t _nBuiltPoints;      /* Number of points the model was trained on */
+    size_t _nUpdatedPoints;    /* Number of points inserted and removed after the training */
+    size_t _nUnusedRows;       /* Number of the rows of the data left unused by the updates */
+    double _rebuildThreshold;
+    size_t _capacity;          /* Number of rows the data of the updated model can grow to without reallocation,
+                                  zero if the tables of the model are not owned by the updates yet */
 };
 
 } // namespace interface1
@@ -0,0 +1,661 @@
+/* file: kdtree_knn_classification_model_update.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the incremental updates of the K-Nearest Neighbors (kNN) model
+//--
+*/
+
+#include "kdtree_knn_classification_model_impl.h"
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
+#include "service_numeric_table.h"
+#include "service_sort.h"
+#include "kdtree_knn_impl.i"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace interface1
+{
+
+using kdtree_knn_classification::internal::Stack;
+
+struct LeafOfPoint
+{
+    size_t leaf;
+    size_t point;
+};
+
+struct NodeRange
+{
+    size_t node;
+    size_t start;
+    size_t end;
+};
+
+template <typename algorithmFPType>
+struct ValueOfRow
+{
+    algorithmFPType value;
+    size_t row;
+};
+
+/*
+ * Updates the model in place. On the first update the points, labels and indices of the model are copied into
+ * the row-major tables with spare rows for the inserted points. The leaves of the KD-tree keep the ranges of rows,
+ * the rows that do not belong to any leaf are marked with the negative index and are reclaimed by the rebuild.
+ */
+template <typename algorithmFPType>
+class ModelUpdater
+{
+public:
+    typedef Model::ModelImpl ModelImpl;
+
+    ModelUpdater(ModelImpl & model) : _model(model), _nCols(model._data->getNumberOfColumns()) {}
+
+    Status insert(NumericTable & data, NumericTable & labels);
+
+    Status remove(NumericTable & indices);
+
+    static Status rebuild(const ModelImpl & model, ModelPtr & result);
+
+private:
+    bool hasTree() const { return _model._kdTreeTable.get() && _model._lastNodeIndex > 0; }
+
+    Status reserve(size_t nRows);
+
+    Status reserveNodes(size_t nNodes);
+
+    Status setNumberOfRows(size_t nRows);
+
+    Status buildSubtree(size_t nodeIndex, size_t start, size_t end);
+
+    void copyRow(size_t from, size_t to)
+    {
+        for (size_t j = 0; j < _nCols; ++j)
+        {
+            _data[to * _nCols + j] = _data[from * _nCols + j];
+        }
+        _labels[to]  = _labels[from];
+        _indices[to] = _indices[from];
+    }
+
+    template <training::Method method>
+    static Status train(const NumericTablePtr & data, const NumericTablePtr & labels, double rebuildThreshold, ModelPtr & result);
+
+    ModelImpl & _model;
+    const size_t _nCols;
+    algorithmFPType * _data;
+    algorithmFPType * _labels;
+    int * _indices;
+};
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::reserve(size_t nRows)
+{
+    ModelImpl & m = _model;
+    const size_t nUsed = m._data->getNumberOfRows();
+    if (m._capacity && nRows <= m._capacity)
+    {
+        return setNumberOfRows(nUsed);
+    }
+
+    const size_t current  = m._capacity ? m._capacity : nUsed;
+    const size_t capacity = (nRows <= current) ? current : (nRows < 2 * current ? 2 * current : nRows);
+
+    SharedPtr<algorithmFPType> data(static_cast<algorithmFPType *>(daal_malloc(capacity * _nCols * sizeof(algorithmFPType))), ServiceDeleter());
+    SharedPtr<algorithmFPType> labels(static_cast<algorithmFPType *>(daal_malloc(capacity * sizeof(algorithmFPType))), ServiceDeleter());
+    SharedPtr<int> indices(static_cast<int *>(daal_malloc(capacity * sizeof(int))), ServiceDeleter());
+    DAAL_CHECK_MALLOC(data.get() && labels.get() && indices.get());
+
+    if (nUsed)
+    {
+        ReadRows<algorithmFPType, sse2> dataRows(m._data.get(), 0, nUsed);
+        DAAL_CHECK_BLOCK_STATUS(dataRows);
+        daal_memcpy_s(data.get(), capacity * _nCols * sizeof(algorithmFPType), dataRows.get(), nUsed * _nCols * sizeof(algorithmFPType));
+
+        ReadColumns<algorithmFPType, sse2> labelsColumn(m._labels.get(), 0, 0, nUsed);
+        DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+        daal_memcpy_s(labels.get(), capacity * sizeof(algorithmFPType), labelsColumn.get(), nUsed * sizeof(algorithmFPType));
+
+        /* The models that keep the input order of the points have no indices */
+        ReadColumns<int, sse2> indicesColumn(m._indices.get(), 0, 0, nUsed);
+        DAAL_CHECK_BLOCK_STATUS(indicesColumn);
+        if (indicesColumn.get())
+        {
+            daal_memcpy_s(indices.get(), capacity * sizeof(int), indicesColumn.get(), nUsed * sizeof(int));
+        }
+        else
+        {
+            for (size_t i = 0; i < nUsed; ++i)
+            {
+                indices.get()[i] = static_cast<int>(i);
+            }
+        }
+    }
+
+    Status s;
+    m._data = HomogenNumericTable<algorithmFPType>::create(data, _nCols, nUsed, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    m._labels = HomogenNumericTable<algorithmFPType>::create(labels, 1, nUsed, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    m._indices = HomogenNumericTable<int>::create(indices, 1, nUsed, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    m._capacity = capacity;
+
+    _data    = data.get();
+    _labels  = labels.get();
+    _indices = indices.get();
+    return s;
+}
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::setNumberOfRows(size_t nRows)
+{
+    ModelImpl & m = _model;
+    const SharedPtr<algorithmFPType> data   = static_cast<HomogenNumericTable<algorithmFPType> *>(m._data.get())->getArraySharedPtr();
+    const SharedPtr<algorithmFPType> labels = static_cast<HomogenNumericTable<algorithmFPType> *>(m._labels.get())->getArraySharedPtr();
+    const SharedPtr<int> indices            = static_cast<HomogenNumericTable<int> *>(m._indices.get())->getArraySharedPtr();
+
+    Status s;
+    if (m._data->getNumberOfRows() != nRows)
+    {
+        m._data = HomogenNumericTable<algorithmFPType>::create(data, _nCols, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        m._labels = HomogenNumericTable<algorithmFPType>::create(labels, 1, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        m._indices = HomogenNumericTable<int>::create(indices, 1, nRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    _data    = data.get();
+    _labels  = labels.get();
+    _indices = indices.get();
+    return s;
+}
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::reserveNodes(size_t nNodes)
+{
+    ModelImpl & m = _model;
+    const size_t capacity = m._kdTreeTable->getNumberOfRows();
+    if (nNodes <= capacity)
+    {
+        return Status();
+    }
+
+    Status s;
+    KDTreeTablePtr table(new KDTreeTable(nNodes < 2 * capacity ? 2 * capacity : nNodes, s));
+    DAAL_CHECK_MALLOC(table.get());
+    DAAL_CHECK_STATUS_VAR(s);
+    daal_memcpy_s(table->getArray(), table->getNumberOfRows() * sizeof(KDTreeNode), m._kdTreeTable->getArray(),
+                  m._lastNodeIndex * sizeof(KDTreeNode));
+    m._kdTreeTable = table;
+    return s;
+}
+
+/* Splits the rows [start, end) at the median of the dimension with the largest spread until the leaves fit into the bucket.
+   The rows of the left child are not greater than the cut point and the rows of the right child are not less than it,
+   as in the KD-tree built by the training */
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::buildSubtree(size_t nodeIndex, size_t start, size_t end)
+{
+    ModelImpl & m = _model;
+    KDTreeNode * const nodes = static_cast<KDTreeNode *>(m._kdTreeTable->getArray());
+    const size_t nRows = end - start;
+
+    TArray<ValueOfRow<algorithmFPType>, sse2> order(nRows);
+    TArray<algorithmFPType, sse2> rows(nRows * _nCols);
+    TArray<algorithmFPType, sse2> labels(nRows);
+    TArray<int, sse2> indices(nRows);
+    DAAL_CHECK_MALLOC(order.get() && rows.get() && labels.get() && indices.get());
+
+    Stack<NodeRange, sse2> stack;
+    DAAL_CHECK_MALLOC(stack.init(64));
+    Status s;
+    NodeRange range = { nodeIndex, start, end };
+    DAAL_CHECK_STATUS(s, stack.push(range));
+    while (!stack.empty())
+    {
+        range = stack.pop();
+        KDTreeNode & node = nodes[range.node];
+        const size_t n = range.end - range.start;
+        if (n <= __KDTREE_LEAF_BUCKET_SIZE)
+        {
+            node.dimension  = __KDTREE_NULLDIMENSION;
+            node.leftIndex  = range.start;
+            node.rightIndex = range.end;
+            node.cutPoint   = 0;
+            continue;
+        }
+
+        size_t dimension      = 0;
+        algorithmFPType spread = -1;
+        for (size_t j = 0; j < _nCols; ++j)
+        {
+            algorithmFPType lower = _data[range.start * _nCols + j];
+            algorithmFPType upper = lower;
+            for (size_t i = range.start + 1; i < range.end; ++i)
+            {
+                const algorithmFPType value = _data[i * _nCols + j];
+                lower = (value < lower) ? value : lower;
+                upper = (value > upper) ? value : upper;
+            }
+            if (upper - lower > spread)
+            {
+                spread    = upper - lower;
+                dimension = j;
+            }
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            order[i].value = _data[(range.start + i) * _nCols + dimension];
+            order[i].row   = range.start + i;
+        }
+        daal::algorithms::internal::introSort<sse2>(order.get(), order.get() + n,
+                                                    [](const ValueOfRow<algorithmFPType> & a, const ValueOfRow<algorithmFPType> & b) -> bool
+        {
+            return (a.value < b.value) || (a.value == b.value && a.row < b.row);
+        } );
+        for (size_t i = 0; i < n; ++i)
+        {
+            const size_t row = order[i].row;
+            for (size_t j = 0; j < _nCols; ++j)
+            {
+                rows[i * _nCols + j] = _data[row * _nCols + j];
+            }
+            labels[i]  = _labels[row];
+            indices[i] = _indices[row];
+        }
+        daal_memcpy_s(_data + range.start * _nCols, n * _nCols * sizeof(algorithmFPType), rows.get(), n * _nCols * sizeof(algorithmFPType));
+        daal_memcpy_s(_labels + range.start, n * sizeof(algorithmFPType), labels.get(), n * sizeof(algorithmFPType));
+        daal_memcpy_s(_indices + range.start, n * sizeof(int), indices.get(), n * sizeof(int));
+
+        const size_t middle = range.start + n / 2;
+        node.dimension  = dimension;
+        node.cutPoint   = _data[middle * _nCols + dimension];
+        node.leftIndex  = m._lastNodeIndex++;
+        node.rightIndex = m._lastNodeIndex++;
+
+        const NodeRange left  = { node.leftIndex, range.start, middle };
+        const NodeRange right = { node.rightIndex, middle, range.end };
+        DAAL_CHECK_STATUS(s, stack.push(left));
+        DAAL_CHECK_STATUS(s, stack.push(right));
+    }
+    return s;
+}
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::insert(NumericTable & data, NumericTable & labels)
+{
+    ModelImpl & m = _model;
+    const size_t nNew  = data.getNumberOfRows();
+    const size_t nUsed = m._data->getNumberOfRows();
+
+    ReadRows<algorithmFPType, sse2> newRows(&data, 0, nNew);
+    DAAL_CHECK_BLOCK_STATUS(newRows);
+    ReadColumns<algorithmFPType, sse2> newLabelsColumn(&labels, 0, 0, nNew);
+    DAAL_CHECK_BLOCK_STATUS(newLabelsColumn);
+    const algorithmFPType * const x         = newRows.get();
+    const algorithmFPType * const newLabels = newLabelsColumn.get();
+
+    Status s;
+    if (!hasTree())
+    {
+        /* The brute-force search scans all the rows, so the points are appended */
+        DAAL_CHECK_STATUS(s, reserve(nUsed + nNew));
+        daal_memcpy_s(_data + nUsed * _nCols, nNew * _nCols * sizeof(algorithmFPType), x, nNew * _nCols * sizeof(algorithmFPType));
+        for (size_t i = 0; i < nNew; ++i)
+        {
+            _labels[nUsed + i]  = newLabels[i];
+            _indices[nUsed + i] = static_cast<int>(m._nextIndex + i);
+        }
+        DAAL_CHECK_STATUS(s, setNumberOfRows(nUsed + nNew));
+        m._nextIndex += nNew;
+        m._nUpdatedPoints += nNew;
+        return s;
+    }
+
+    /* The points are routed to the leaves the same way as the queries are */
+    TArray<LeafOfPoint, sse2> leafOfPoint(nNew);
+    DAAL_CHECK_MALLOC(leafOfPoint.get());
+    {
+        const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(m._kdTreeTable->getArray());
+        for (size_t i = 0; i < nNew; ++i)
+        {
+            const algorithmFPType * const point = x + i * _nCols;
+            size_t nodeIndex = m._rootNodeIndex;
+            while (nodes[nodeIndex].dimension != __KDTREE_NULLDIMENSION)
+            {
+                const KDTreeNode & node = nodes[nodeIndex];
+                nodeIndex = (point[node.dimension] < node.cutPoint) ? node.leftIndex : node.rightIndex;
+            }
+            leafOfPoint[i].leaf  = nodeIndex;
+            leafOfPoint[i].point = i;
+        }
+    }
+    daal::algorithms::internal::introSort<sse2>(leafOfPoint.get(), leafOfPoint.get() + nNew, [](const LeafOfPoint & a, const LeafOfPoint & b) -> bool
+    {
+        return (a.leaf < b.leaf) || (a.leaf == b.leaf && a.point < b.point);
+    } );
+
+    /* Every affected leaf is moved to the end of the data together with its new points. The leaves that overflow the bucket
+       become the roots of the subtrees, all the leaves of a subtree keep at least a half of the bucket. The nodes above
+       the leaves are not rebalanced, the full rebuild of the model restores the balanced tree */
+    size_t nRows  = nUsed;
+    size_t nNodes = m._lastNodeIndex;
+    {
+        const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(m._kdTreeTable->getArray());
+        for (size_t first = 0, last = 0; first < nNew; first = last)
+        {
+            for (last = first + 1; last < nNew && leafOfPoint[last].leaf == leafOfPoint[first].leaf; ++last) {}
+            const KDTreeNode & leaf = nodes[leafOfPoint[first].leaf];
+            const size_t count      = leaf.rightIndex - leaf.leftIndex + (last - first);
+            nRows += count;
+            nNodes += 2 * (count / ((__KDTREE_LEAF_BUCKET_SIZE + 1) / 2));
+        }
+    }
+    DAAL_CHECK_STATUS(s, reserve(nRows));
+    DAAL_CHECK_STATUS(s, reserveNodes(nNodes));
+
+    size_t end = nUsed;
+    for (size_t first = 0, last = 0; first < nNew; first = last)
+    {
+        for (last = first + 1; last < nNew && leafOfPoint[last].leaf == leafOfPoint[first].leaf; ++last) {}
+        const size_t leafIndex = leafOfPoint[first].leaf;
+        const KDTreeNode leaf  = static_cast<const KDTreeNode *>(m._kdTreeTable->getArray())[leafIndex];
+
+        const size_t start = end;
+        for (size_t i = leaf.leftIndex; i < leaf.rightIndex; ++i, ++end)
+        {
+            copyRow(i, end);
+            _indices[i] = -1;
+        }
+        m._nUnusedRows += leaf.rightIndex - leaf.leftIndex;
+
+        for (size_t i = first; i < last; ++i, ++end)
+        {
+            const size_t point = leafOfPoint[i].point;
+            for (size_t j = 0; j < _nCols; ++j)
+            {
+                _data[end * _nCols + j] = x[point * _nCols + j];
+            }
+            _labels[end]  = newLabels[point];
+            _indices[end] = static_cast<int>(m._nextIndex + point);
+        }
+        DAAL_CHECK_STATUS(s, buildSubtree(leafIndex, start, end));
+    }
+
+    DAAL_CHECK_STATUS(s, setNumberOfRows(end));
+    m._nextIndex += nNew;
+    m._nUpdatedPoints += nNew;
+    return s;
+}
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::remove(NumericTable & indices)
+{
+    ModelImpl & m = _model;
+    const size_t nIndices = indices.getNumberOfRows();
+    const size_t nUsed    = m._data->getNumberOfRows();
+
+    ReadColumns<int, sse2> indicesColumn(&indices, 0, 0, nIndices);
+    DAAL_CHECK_BLOCK_STATUS(indicesColumn);
+    const int * const toRemove = indicesColumn.get();
+
+    TArray<bool, sse2> removedArray(m._nextIndex);
+    bool * const removed = removedArray.get();
+    DAAL_CHECK_MALLOC(removed || !m._nextIndex);
+    for (size_t i = 0; i < m._nextIndex; ++i)
+    {
+        removed[i] = false;
+    }
+    for (size_t i = 0; i < nIndices; ++i)
+    {
+        if (toRemove[i] >= 0 && static_cast<size_t>(toRemove[i]) < m._nextIndex)
+        {
+            removed[toRemove[i]] = true;
+        }
+    }
+
+    Status s;
+    DAAL_CHECK_STATUS(s, reserve(nUsed));
+
+    size_t nRemoved = 0;
+    if (!hasTree())
+    {
+        /* The brute-force search does not depend on the order of the rows, so the last row takes the place of the removed one */
+        size_t nRows = nUsed;
+        for (size_t i = 0; i < nRows;)
+        {
+            if (removed[_indices[i]])
+            {
+                --nRows;
+                copyRow(nRows, i);
+                ++nRemoved;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        DAAL_CHECK_STATUS(s, setNumberOfRows(nRows));
+    }
+    else
+    {
+        /* The remaining points of a leaf are moved to the beginning of its range, the rest of the range becomes unused */
+        KDTreeNode * const nodes = static_cast<KDTreeNode *>(m._kdTreeTable->getArray());
+        for (size_t iNode = 0; iNode < m._lastNodeIndex; ++iNode)
+        {
+            KDTreeNode & node = nodes[iNode];
+            if (node.dimension != __KDTREE_NULLDIMENSION)
+            {
+                continue;
+            }
+            size_t end = node.leftIndex;
+            for (size_t i = node.leftIndex; i < node.rightIndex; ++i)
+            {
+                if (removed[_indices[i]])
+                {
+                    continue;
+                }
+                if (i != end)
+                {
+                    copyRow(i, end);
+                }
+                ++end;
+            }
+            for (size_t i = end; i < node.rightIndex; ++i)
+            {
+                _indices[i] = -1;
+            }
+            nRemoved += node.rightIndex - end;
+            node.rightIndex = end;
+        }
+        m._nUnusedRows += nRemoved;
+    }
+
+    m._nUpdatedPoints += nRemoved;
+    return s;
+}
+
+template <typename algorithmFPType>
+template <training::Method method>
+Status ModelUpdater<algorithmFPType>::train(const NumericTablePtr & data, const NumericTablePtr & labels, double rebuildThreshold, ModelPtr & result)
+{
+    training::Batch<algorithmFPType, method> algorithm;
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+    algorithm.parameter.dataUseInModel   = doUse;
+    algorithm.parameter.rebuildThreshold = rebuildThreshold;
+
+    Status s;
+    DAAL_CHECK_STATUS(s, algorithm.computeNoThrow());
+    result = algorithm.getResult()->get(classifier::training::model);
+    DAAL_CHECK(result, ErrorNullModel);
+    return s;
+}
+
+template <typename algorithmFPType>
+Status ModelUpdater<algorithmFPType>::rebuild(const ModelImpl & m, ModelPtr & result)
+{
+    const size_t nUsed = m._data->getNumberOfRows();
+    const size_t nCols = m._data->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, sse2> dataRows(const_cast<NumericTable *>(m._data.get()), 0, nUsed);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+    ReadColumns<algorithmFPType, sse2> labelsColumn(const_cast<NumericTable *>(m._labels.get()), 0, 0, nUsed);
+    DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+    ReadColumns<int, sse2> indicesColumn(const_cast<NumericTable *>(m._indices.get()), 0, 0, nUsed);
+    DAAL_CHECK_BLOCK_STATUS(indicesColumn);
+    const algorithmFPType * const x      = dataRows.get();
+    const algorithmFPType * const labels = labelsColumn.get();
+    const int * const indices            = indicesColumn.get();
+
+    size_t nPoints = nUsed;
+    if (indices)
+    {
+        nPoints = 0;
+        for (size_t i = 0; i < nUsed; ++i)
+        {
+            nPoints += (indices[i] >= 0);
+        }
+    }
+    DAAL_CHECK(nPoints > 0, ErrorEmptyInputNumericTable);
+
+    Status s;
+    SharedPtr<HomogenNumericTable<algorithmFPType> > points = HomogenNumericTable<algorithmFPType>::create(nCols, nPoints,
+                                                                                                         NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    SharedPtr<HomogenNumericTable<algorithmFPType> > pointLabels = HomogenNumericTable<algorithmFPType>::create(1, nPoints,
+                                                                                                              NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    TArray<int, sse2> pointIndices(nPoints);
+    DAAL_CHECK_MALLOC(pointIndices.get());
+
+    algorithmFPType * const dstData   = points->getArray();
+    algorithmFPType * const dstLabels = pointLabels->getArray();
+    for (size_t i = 0, iPoint = 0; i < nUsed; ++i)
+    {
+        if (indices && indices[i] < 0)
+        {
+            continue;
+        }
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            dstData[iPoint * nCols + j] = x[i * nCols + j];
+        }
+        dstLabels[iPoint]    = labels[i];
+        pointIndices[iPoint] = indices ? indices[i] : static_cast<int>(i);
+        ++iPoint;
+    }
+
+    if (m._kdTreeTable.get() && m._lastNodeIndex > 0)
+    {
+        DAAL_CHECK_STATUS(s, train<training::defaultDense>(points, pointLabels, m._rebuildThreshold, result));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, train<training::bruteForceDense>(points, pointLabels, m._rebuildThreshold, result));
+    }
+
+    /* The new model indexes the rows of the table of points, they are mapped back to the indices of the points */
+    ModelImpl & r = *result->impl();
+    if (r._indices)
+    {
+        WriteColumns<int, sse2> newIndicesColumn(r._indices.get(), 0, 0, nPoints);
+        DAAL_CHECK_BLOCK_STATUS(newIndicesColumn);
+        int * const newIndices = newIndicesColumn.get();
+        for (size_t i = 0; i < nPoints; ++i)
+        {
+            newIndices[i] = pointIndices[newIndices[i]];
+        }
+    }
+    else
+    {
+        SharedPtr<HomogenNumericTable<int> > newIndices = HomogenNumericTable<int>::create(1, nPoints, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        daal_memcpy_s(newIndices->getArray(), nPoints * sizeof(int), pointIndices.get(), nPoints * sizeof(int));
+        r._indices = newIndices;
+    }
+    r._nextIndex = m._nextIndex;
+    return s;
+}
+
+namespace
+{
+bool isDoublePrecision(const NumericTable & data)
+{
+    const NumericTableDictionaryPtr dictionary = data.getDictionarySharedPtr();
+    return dictionary && dictionary->getNumberOfFeatures() && dictionary->getFeature(0).indexType == features::DAAL_FLOAT64;
+}
+} // namespace
+
+Status Model::ModelImpl::insertPoints(const NumericTablePtr & data, const NumericTablePtr & labels)
+{
+    Status s;
+    DAAL_CHECK(_data && _labels, ErrorModelNotFullInitialized);
+    DAAL_CHECK_STATUS(s, checkNumericTable(data.get(), dataStr(), 0, 0, _data->getNumberOfColumns()));
+    DAAL_CHECK_STATUS(s, checkNumericTable(labels.get(), labelsStr(), 0, 0, 1, data->getNumberOfRows()));
+    _squaredNorms.reset();
+
+    if (isDoublePrecision(*_data))
+    {
+        return ModelUpdater<double>(*this).insert(*data, *labels);
+    }
+    return ModelUpdater<float>(*this).insert(*data, *labels);
+}
+
+Status Model::ModelImpl::removePoints(const NumericTablePtr & indices)
+{
+    Status s;
+    DAAL_CHECK(_data && _labels, ErrorModelNotFullInitialized);
+    DAAL_CHECK_STATUS(s, checkNumericTable(indices.get(), indicesStr(), 0, 0, 1));
+    _squaredNorms.reset();
+
+    if (isDoublePrecision(*_data))
+    {
+        return ModelUpdater<double>(*this).remove(*indices);
+    }
+    return ModelUpdater<float>(*this).remove(*indices);
+}
+
+Status Model::ModelImpl::rebuild(ModelPtr & model) const
+{
+    DAAL_CHECK(_data && _labels, ErrorModelNotFullInitialized);
+
+    if (isDoublePrecision(*_data))
+    {
+        return ModelUpdater<double>::rebuild(*this, model);
+    }
+    return ModelUpdater<float>::rebuild(*this, model);
+}
+
+} // namespace interface1
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -23,6 +23,8 @@
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
 #include "kdtree_knn_classification_model_impl.h"
+#include "serialization_utils.h"
+#include "daal_defines.h"
 #include "daal_strings.h"
 
 using namespace daal::data_management;
@@ -38,6 +40,7 @@ namespace prediction
 {
 namespace interface1
 {
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID);
 
 /** Default constructor */
 Input::Input() : classifier::prediction::Input() {}
@@ -89,6 +92,18 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     DAAL_CHECK(s, ErrorModelNotFullInitialized);
     s |= checkNumericTable(m->impl()->getLabels().get(), labelsStr());
     DAAL_CHECK(s, ErrorModelNotFullInitialized);
+
+    const kdtree_knn_classification::interface3::Parameter * const par = dynamic_cast<const kdtree_knn_classification::interface3::Parameter *>(parameter);
+    if (par && (par->resultsToCompute & computeIndicesOfNeighbors) && (m->impl()->getKDTreeTable() || m->impl()->getIndices()))
+    {
+        /* The KD-tree training and the updates of the model reorder the points, so the indices of neighbors are mapped back */
+        s |= checkNumericTable(m->impl()->getIndices().get(), indicesStr(), 0, 0, 1, m->impl()->getData()->getNumberOfRows());
+        DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    }
+    if (method == bruteForceDense)
+    {
+        return s;
+    }
     s |= checkNumericTable(m->impl()->getKDTreeTable().get(), kdTreeTableStr(), 0, NumericTableIface::aos, 4);
     DAAL_CHECK(s, ErrorModelNotFullInitialized);
 
@@ -98,6 +113,56 @@ services::Status Input::check(const daal::algorithms::Parameter *parameter, int
     return s;
 }
 
+Result::Result() : classifier::prediction::Result(lastResultId + 1) {}
+
+/**
+ * Returns the optional result of KD-tree based kNN model-based prediction
+ * \param[in] id   Identifier of the result, \ref ResultId
+ * \return         Result that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Result::get(ResultId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the optional result of KD-tree based kNN model-based prediction
+ * \param[in] id      Identifier of the result, \ref ResultId
+ * \param[in] value   Pointer to the result
+ */
+void Result::set(ResultId id, const data_management::NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of KD-tree based kNN model-based prediction
+ * \param[in] input     %Input object for the algorithm
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    services::Status s = classifier::prediction::Result::check(input, parameter, method);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The optional results are requested only through the parameter of version 3.0 */
+    const kdtree_knn_classification::interface3::Parameter * const par = dynamic_cast<const kdtree_knn_classification::interface3::Parameter *>(parameter);
+    if (!par) { return s; }
+
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+    const int unexpectedLayouts = (int)packed_mask;
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(indices).get(), indicesStr(), unexpectedLayouts, 0, par->k, nRows));
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(distances).get(), distancesStr(), unexpectedLayouts, 0, par->k, nRows));
+    }
+    return s;
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace kdtree_knn_classification
@@ -0,0 +1,71 @@
+/* file: kdtree_knn_classification_predict_dense_brute_force_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes K-Nearest Neighbors prediction results with the brute-force method.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_H__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_H__
+
+#include "kdtree_knn_classification_predict_dense_default_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+
+template <typename algorithmFpType, CpuType cpu> struct BruteForceTask;
+struct PredictionOptions;
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                             NumericTable * distances, const daal::algorithms::Parameter * par);
+
+protected:
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+
+    void searchBlock(const algorithmFpType * query, size_t nQuery, const algorithmFpType * train, const algorithmFpType * trainNorms,
+                     size_t iFirstTrain, size_t nTrain, size_t nCols, size_t k, BruteForceTask<algorithmFpType, cpu> & task);
+
+    void insertCandidates(const algorithmFpType * distances, size_t iFirstTrain, size_t nTrain, Neighbors * neighbors, size_t & count, size_t k);
+
+    services::Status writeResults(const algorithmFpType * query, size_t iFirstQuery, size_t nQuery, size_t nCols, Neighbors * neighbors, const size_t * counts,
+                                  size_t k, bool needQueryNorms, const PredictionOptions & options, const algorithmFpType * trainLabels, const int * trainIndices,
+                                  NumericTable * y, size_t yColumnCount, NumericTable * indices, NumericTable * distances);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
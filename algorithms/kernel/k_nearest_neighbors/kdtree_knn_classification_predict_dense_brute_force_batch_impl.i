@@ -0,0 +1,370 @@
+/* file: kdtree_knn_classification_predict_dense_brute_force_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors prediction with the brute-force method.
+//
+//  Squared Euclidean distances between query and training points are computed block by block as
+//  ||t||^2 - 2 * <q, t>, where the dot products of a block of queries with a block of training points
+//  are obtained by one matrix multiplication and ||q||^2 is omitted as it does not change the order of
+//  neighbors of the query. Each query keeps its k nearest candidates in a max-heap.
+//  The squared norms of the training points are taken from the model when the brute-force training has computed them.
+//  The training points are read block by block, so the data stored in the column-major layout is converted
+//  one block at a time instead of as a whole.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "service_defines.h"
+#include "service_blas.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_sort.h"
+#include "kdtree_knn_classification_predict_dense_brute_force_batch.h"
+#include "kdtree_knn_classification_predict_dense_default_batch_impl.i"
+
+/* Number of query points multiplied by a block of training points in one matrix multiplication */
+#define __KNN_BRUTE_FORCE_QUERY_BLOCK_SIZE 64
+/* Number of training points in a block. The block of distances (query block x training block) fits L2 cache */
+#define __KNN_BRUTE_FORCE_TRAIN_BLOCK_SIZE 512
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+
+template <typename algorithmFpType, CpuType cpu>
+struct BruteForceTask
+{
+    DAAL_NEW_DELETE();
+
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+
+    BruteForceTask(size_t k) : distances(__KNN_BRUTE_FORCE_QUERY_BLOCK_SIZE * __KNN_BRUTE_FORCE_TRAIN_BLOCK_SIZE),
+        neighbors(__KNN_BRUTE_FORCE_QUERY_BLOCK_SIZE * k), counts(__KNN_BRUTE_FORCE_QUERY_BLOCK_SIZE) {}
+
+    static BruteForceTask * create(size_t k)
+    {
+        BruteForceTask * const result = new BruteForceTask(k);
+        if (!result) { return nullptr; }
+        if (!result->distances.get() || !result->neighbors.get() || !result->counts.get())
+        {
+            delete result;
+            return nullptr;
+        }
+        return result;
+    }
+
+    TArrayScalable<algorithmFpType, cpu> distances; /* Block of distances between query and training points */
+    TArrayScalable<Neighbors, cpu> neighbors;       /* k nearest candidates of every query in the block */
+    TArrayScalable<size_t, cpu> counts;             /* Number of candidates found for every query in the block */
+};
+
+template<typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                         NumericTable * distances, const daal::algorithms::Parameter * par)
+{
+    typedef BruteForceTask<algorithmFpType, cpu> Task;
+
+    PredictionOptions options;
+    Status status = getPredictionOptions<cpu>(par, options);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const Model * const model = static_cast<const Model *>(m);
+    NumericTable & data = const_cast<NumericTable &>(*(model->impl()->getData()));
+    NumericTable & labels = const_cast<NumericTable &>(*(model->impl()->getLabels()));
+
+    const size_t nTrain = data.getNumberOfRows();
+    const size_t nCols = data.getNumberOfColumns();
+    const size_t nQuery = x->getNumberOfRows();
+    const size_t yColumnCount = y ? y->getNumberOfColumns() : 0;
+    DAAL_CHECK(nTrain > 0, ErrorModelNotFullInitialized);
+    const size_t k = min<cpu>(options.k, nTrain);
+
+    /* The distances to the neighbors are computed without the squared norm of the query,
+       it is added back only when the distances themselves are needed */
+    const bool needQueryNorms = distances || (options.voteWeights == voteDistance);
+
+    ReadColumns<algorithmFpType, cpu> labelColumn(labels, 0, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(labelColumn);
+    const algorithmFpType * const trainLabels = labelColumn.get();
+
+    /* A model trained by the KD-tree method keeps the positions of the reordered points in the input dataset */
+    ReadColumns<int, cpu> trainIndicesColumn(indices ? const_cast<NumericTable *>(model->impl()->getIndices().get()) : nullptr, 0, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(trainIndicesColumn);
+    const int * const trainIndices = trainIndicesColumn.get();
+
+    const NumericTableConstPtr modelNorms = model->impl()->getSquaredNorms();
+    const bool hasModelNorms = modelNorms && modelNorms->getNumberOfRows() == nTrain;
+    ReadColumns<algorithmFpType, cpu> modelNormsColumn(hasModelNorms ? const_cast<NumericTable *>(modelNorms.get()) : nullptr, 0, 0, nTrain);
+    DAAL_CHECK_BLOCK_STATUS(modelNormsColumn);
+    TArray<algorithmFpType, cpu> trainNormsArray(hasModelNorms ? 0 : nTrain);
+    const algorithmFpType * trainNorms = modelNormsColumn.get();
+    if (!hasModelNorms)
+    {
+        DAAL_CHECK_MALLOC(trainNormsArray.get());
+        DAAL_CHECK_STATUS(status, (kdtree_knn_classification::internal::computeSquaredNorms<algorithmFpType, cpu>(data, trainNormsArray.get())));
+        trainNorms = trainNormsArray.get();
+    }
+
+    /* When there are too few query blocks to load all threads, the training set is split into chunks
+       searched in parallel, and the candidates found in the chunks are merged afterwards */
+    const size_t queryBlockSize = __KNN_BRUTE_FORCE_QUERY_BLOCK_SIZE;
+    const size_t trainBlockSize = __KNN_BRUTE_FORCE_TRAIN_BLOCK_SIZE;
+    const size_t nQueryBlocks = (nQuery + queryBlockSize - 1) / queryBlockSize;
+    const size_t nTrainBlocks = (nTrain + trainBlockSize - 1) / trainBlockSize;
+    const size_t nThreads = threader_get_threads_number();
+    size_t nChunks = 1;
+    if (nQueryBlocks < nThreads)
+    {
+        nChunks = min<cpu>(nTrainBlocks, (nThreads + nQueryBlocks - 1) / nQueryBlocks);
+    }
+    const size_t trainBlocksPerChunk = (nTrainBlocks + nChunks - 1) / nChunks;
+    nChunks = (nTrainBlocks + trainBlocksPerChunk - 1) / trainBlocksPerChunk;
+
+    TArray<Neighbors, cpu> candidatesArray(nChunks > 1 ? nChunks * nQuery * k : 0);
+    TArray<size_t, cpu> candidateCountsArray(nChunks > 1 ? nChunks * nQuery : 0);
+    if (nChunks > 1)
+    {
+        DAAL_CHECK_MALLOC(candidatesArray.get() && candidateCountsArray.get());
+    }
+    Neighbors * const candidates = candidatesArray.get();
+    size_t * const candidateCounts = candidateCountsArray.get();
+
+    daal::tls<Task *> tlsTask([=]()-> Task *
+    {
+        return Task::create(k);
+    } );
+
+    SafeStatus safeStat;
+    daal::threader_for(nQueryBlocks * nChunks, nQueryBlocks * nChunks, [&](size_t iTask)
+    {
+        Task * const task = tlsTask.local();
+        DAAL_CHECK_THR(task, ErrorMemoryAllocationFailed);
+
+        const size_t iQueryBlock = iTask / nChunks;
+        const size_t iChunk = iTask % nChunks;
+        const size_t iFirstQuery = iQueryBlock * queryBlockSize;
+        const size_t nBlockQuery = min<cpu>(queryBlockSize, nQuery - iFirstQuery);
+
+        ReadRows<algorithmFpType, cpu> queryRows(const_cast<NumericTable *>(x), iFirstQuery, nBlockQuery);
+        DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+        const algorithmFpType * const query = queryRows.get();
+
+        size_t * const counts = task->counts.get();
+        for (size_t i = 0; i < nBlockQuery; ++i) { counts[i] = 0; }
+
+        const size_t iLastTrainBlock = min<cpu>(nTrainBlocks, (iChunk + 1) * trainBlocksPerChunk);
+        for (size_t iTrainBlock = iChunk * trainBlocksPerChunk; iTrainBlock < iLastTrainBlock; ++iTrainBlock)
+        {
+            const size_t iFirstTrain = iTrainBlock * trainBlockSize;
+            const size_t nBlockTrain = min<cpu>(trainBlockSize, nTrain - iFirstTrain);
+            ReadRows<algorithmFpType, cpu> trainRows(&data, iFirstTrain, nBlockTrain);
+            DAAL_CHECK_BLOCK_STATUS_THR(trainRows);
+            searchBlock(query, nBlockQuery, trainRows.get(), trainNorms, iFirstTrain, nBlockTrain, nCols, k, *task);
+        }
+
+        Neighbors * const neighbors = task->neighbors.get();
+        if (nChunks == 1)
+        {
+            safeStat |= writeResults(query, iFirstQuery, nBlockQuery, nCols, neighbors, counts, k, needQueryNorms, options, trainLabels, trainIndices,
+                                     y, yColumnCount, indices, distances);
+        }
+        else
+        {
+            for (size_t i = 0; i < nBlockQuery; ++i)
+            {
+                const size_t iCandidates = iChunk * nQuery + iFirstQuery + i;
+                candidateCounts[iCandidates] = counts[i];
+                for (size_t j = 0; j < counts[i]; ++j) { candidates[iCandidates * k + j] = neighbors[i * k + j]; }
+            }
+        }
+    } );
+    status = safeStat.detach();
+
+    if (status && nChunks > 1)
+    {
+        daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t iQueryBlock)
+        {
+            Task * const task = tlsTask.local();
+            DAAL_CHECK_THR(task, ErrorMemoryAllocationFailed);
+
+            const size_t iFirstQuery = iQueryBlock * queryBlockSize;
+            const size_t nBlockQuery = min<cpu>(queryBlockSize, nQuery - iFirstQuery);
+
+            ReadRows<algorithmFpType, cpu> queryRows(needQueryNorms ? const_cast<NumericTable *>(x) : nullptr, iFirstQuery, nBlockQuery);
+            DAAL_CHECK_BLOCK_STATUS_THR(queryRows);
+
+            Neighbors * const neighbors = task->neighbors.get();
+            size_t * const counts = task->counts.get();
+            for (size_t i = 0; i < nBlockQuery; ++i)
+            {
+                Neighbors * const queryNeighbors = neighbors + i * k;
+                size_t & count = counts[i];
+                count = 0;
+                for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
+                {
+                    const size_t iCandidates = iChunk * nQuery + iFirstQuery + i;
+                    const Neighbors * const chunkCandidates = candidates + iCandidates * k;
+                    for (size_t j = 0; j < candidateCounts[iCandidates]; ++j)
+                    {
+                        if (count < k)
+                        {
+                            queryNeighbors[count++] = chunkCandidates[j];
+                            if (count == k) { makeMaxHeap<cpu>(queryNeighbors, queryNeighbors + k); }
+                        }
+                        else if (chunkCandidates[j] < queryNeighbors[0])
+                        {
+                            queryNeighbors[0] = chunkCandidates[j];
+                            internalAdjustMaxHeap<cpu>(queryNeighbors, queryNeighbors + k, k, size_t(0));
+                        }
+                    }
+                }
+            }
+            safeStat |= writeResults(queryRows.get(), iFirstQuery, nBlockQuery, nCols, neighbors, counts, k, needQueryNorms, options, trainLabels,
+                                     trainIndices, y, yColumnCount, indices, distances);
+        } );
+        status = safeStat.detach();
+    }
+
+    tlsTask.reduce([](Task * task) -> void
+    {
+        delete task;
+    } );
+    return status;
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+    searchBlock(const algorithmFpType * query, size_t nQuery, const algorithmFpType * train, const algorithmFpType * trainNorms,
+                size_t iFirstTrain, size_t nTrain, size_t nCols, size_t k, BruteForceTask<algorithmFpType, cpu> & task)
+{
+    algorithmFpType * const distances = task.distances.get();
+
+    /* distances(nQuery x nTrain, row-major) = query(nQuery x nCols) * train(nTrain x nCols)^T */
+    const char transa = 't';
+    const char transb = 'n';
+    const DAAL_INT m = (DAAL_INT)nTrain;
+    const DAAL_INT n = (DAAL_INT)nQuery;
+    const DAAL_INT kk = (DAAL_INT)nCols;
+    const algorithmFpType alpha = 1.0;
+    const algorithmFpType beta = 0.0;
+    Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &m, &n, &kk, &alpha, train, &kk, query, &kk, &beta,
+                                       distances, &m);
+
+    const algorithmFpType * const norms = trainNorms + iFirstTrain;
+    const algorithmFpType two = 2.0;
+    for (size_t i = 0; i < nQuery; ++i)
+    {
+        algorithmFpType * const row = distances + i * nTrain;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nTrain; ++j) { row[j] = norms[j] - two * row[j]; }
+
+        insertCandidates(row, iFirstTrain, nTrain, task.neighbors.get() + i * k, task.counts.get()[i], k);
+    }
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+    insertCandidates(const algorithmFpType * distances, size_t iFirstTrain, size_t nTrain, Neighbors * neighbors, size_t & count, size_t k)
+{
+    size_t j = 0;
+    for (; (count < k) && (j < nTrain); ++j)
+    {
+        neighbors[count].distance = distances[j];
+        neighbors[count].index = iFirstTrain + j;
+        if (++count == k) { makeMaxHeap<cpu>(neighbors, neighbors + k); }
+    }
+    if (j == nTrain) { return; }
+
+    /* Once the heap is full, only few distances pass the threshold, so they are counted by a vectorizable
+       loop first and the whole block is skipped when none of them does */
+    const algorithmFpType threshold = neighbors[0].distance;
+    size_t nPassed = 0;
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = j; i < nTrain; ++i) { nPassed += (distances[i] < threshold); }
+    if (!nPassed) { return; }
+
+    for (; j < nTrain; ++j)
+    {
+        if (distances[j] < neighbors[0].distance)
+        {
+            neighbors[0].distance = distances[j];
+            neighbors[0].index = iFirstTrain + j;
+            internalAdjustMaxHeap<cpu>(neighbors, neighbors + k, k, size_t(0));
+        }
+    }
+}
+
+template<typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+    writeResults(const algorithmFpType * query, size_t iFirstQuery, size_t nQuery, size_t nCols, Neighbors * neighbors, const size_t * counts,
+                 size_t k, bool needQueryNorms, const PredictionOptions & options, const algorithmFpType * trainLabels, const int * trainIndices,
+                 NumericTable * y, size_t yColumnCount, NumericTable * indices, NumericTable * distances)
+{
+    WriteOnlyRows<algorithmFpType, cpu> yRows(y, iFirstQuery, nQuery);
+    DAAL_CHECK_BLOCK_STATUS(yRows);
+    WriteOnlyRows<int, cpu> indicesRows(indices, iFirstQuery, nQuery);
+    DAAL_CHECK_BLOCK_STATUS(indicesRows);
+    WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, iFirstQuery, nQuery);
+    DAAL_CHECK_BLOCK_STATUS(distancesRows);
+    algorithmFpType * const dy = yRows.get();
+    int * const di = indicesRows.get();
+    algorithmFpType * const dd = distancesRows.get();
+
+    /* The number of columns of the optional results is the parameter k, it may exceed the number of training points */
+    const size_t nResultCols = options.k;
+    for (size_t i = 0; i < nQuery; ++i)
+    {
+        algorithmFpType queryNorm = 0;
+        if (needQueryNorms)
+        {
+            const algorithmFpType * const row = query + i * nCols;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; ++j) { queryNorm += row[j] * row[j]; }
+        }
+        processNeighbors<algorithmFpType, cpu>(neighbors + i * k, counts[i], queryNorm, options, trainLabels, trainIndices,
+                                               dy ? dy + i * yColumnCount : nullptr, di ? di + i * nResultCols : nullptr,
+                                               dd ? dd + i * nResultCols : nullptr);
+    }
+    return Status();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -62,15 +62,13 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                             NumericTable * distances, const daal::algorithms::Parameter * par);
 
 protected:
     void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                               kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data);
-
-    services::Status predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels,
-                 size_t k);
+                              const KDTreeNode * nodes, size_t rootTreeNodeIndex, const algorithmFpType * const * columns, size_t nFeatures);
 };
 
 } // namespace internal
@@ -24,6 +24,7 @@
 
 #include "kdtree_knn_classification_predict.h"
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
+#include "kdtree_knn_classification_predict_dense_brute_force_batch.h"
 
 namespace daal
 {
@@ -62,7 +63,7 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), \
-                       compute, a.get(), m.get(), r.get(), par);
+                       compute, a.get(), m.get(), r.get(), nullptr, nullptr, par);
 }
 
 }
@@ -91,11 +92,16 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     const classifier::ModelConstPtr m = input->get(classifier::prediction::model);
     const data_management::NumericTablePtr r = result->get(classifier::prediction::prediction);
 
+    /* The result registered by the user may be the one of the classifier, it holds the predicted labels only */
+    const Result * const knnResult = dynamic_cast<const Result *>(result);
+    const data_management::NumericTablePtr indices = knnResult ? knnResult->get(prediction::indices) : data_management::NumericTablePtr();
+    const data_management::NumericTablePtr distances = knnResult ? knnResult->get(prediction::distances) : data_management::NumericTablePtr();
+
     const daal::algorithms::Parameter * const par = _par;
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), \
-                       compute, a.get(), m.get(), r.get(), par);
+                       compute, a.get(), m.get(), r.get(), indices.get(), distances.get(), par);
 }
 
 }
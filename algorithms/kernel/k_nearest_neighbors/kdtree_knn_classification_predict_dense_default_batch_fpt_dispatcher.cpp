@@ -32,6 +32,10 @@ __DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::prediction::int
                                       kdtree_knn_classification::prediction::defaultDense)
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::prediction::BatchContainer, batch, DAAL_FPTYPE, \
                                       kdtree_knn_classification::prediction::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::prediction::interface1::BatchContainer, batch, DAAL_FPTYPE, \
+                                      kdtree_knn_classification::prediction::bruteForceDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::prediction::BatchContainer, batch, DAAL_FPTYPE, \
+                                      kdtree_knn_classification::prediction::bruteForceDense)
 
 } // namespace algorithms
 } // namespace daal
@@ -33,11 +33,16 @@
 #include "service_math.h"
 #include "service_rng.h"
 #include "service_sort.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
 #include "numeric_table.h"
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
 #include "kdtree_knn_classification_model_impl.h"
 #include "kdtree_knn_impl.i"
 
+/* Number of queries processed by one task */
+#define __KDTREE_QUERY_BLOCK_SIZE 128
+
 namespace daal
 {
 namespace algorithms
@@ -68,11 +73,10 @@ void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last)
         if (i > 0)
         {
             const auto newItem = *last; // It can be moved instead.
-            auto prev = i;
-            for (i = heapParentIndex<cpu>(i); i && (*(first + i) < newItem); i = heapParentIndex<cpu>(i))
+            for (auto parent = heapParentIndex<cpu>(i); i && (*(first + parent) < newItem); parent = heapParentIndex<cpu>(i))
             {
-                *(first + prev) = *(first + i); // It can be moved instead.
-                prev = i;
+                *(first + i) = *(first + parent); // It can be moved instead.
+                i = parent;
             }
             *(first + i) = newItem; // It can be moved instead.
         }
@@ -162,6 +166,8 @@ public:
 
     T * getMax() { return _elements; }
 
+    T * elements() { return _elements; }
+
     const T & operator[] (size_t index) const { return *(_elements + index); }
 
 private:
@@ -185,9 +191,154 @@ struct SearchNode
     algorithmFpType minDistance;
 };
 
+struct QueryLeaf
+{
+    size_t leaf;
+    size_t query;
+};
+
+/* Options of the prediction taken from the algorithm parameter */
+struct PredictionOptions
+{
+    size_t k;
+    DAAL_UINT64 resultsToCompute;
+    VoteWeights voteWeights;
+    PredictionMode predictionMode;
+};
+
+template <CpuType cpu>
+Status getPredictionOptions(const daal::algorithms::Parameter * par, PredictionOptions & options)
+{
+    options.resultsToCompute = 0;
+    options.voteWeights = voteUniform;
+    options.predictionMode = classVoting;
+
+    auto par1 = dynamic_cast<const kdtree_knn_classification::interface1::Parameter *>(par);
+    if (par1)
+    {
+        options.k = par1->k;
+        return Status();
+    }
+
+    auto par3 = dynamic_cast<const kdtree_knn_classification::interface3::Parameter *>(par);
+    if (par3)
+    {
+        options.k = par3->k;
+        options.resultsToCompute = par3->resultsToCompute;
+        options.voteWeights = par3->voteWeights;
+        options.predictionMode = par3->predictionMode;
+        return Status();
+    }
+
+    auto par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(par);
+    if (par2)
+    {
+        options.k = par2->k;
+        return Status();
+    }
+
+    return Status(ErrorNullParameterNotSupported);
+}
+
+/* Produces all the results for one query point from its nearest neighbors found by the search kernel:
+   the predicted label or response, and the indices and the distances of the neighbors in the order
+   of increasing distance. The neighbors hold the squared distances without the squared norm of the query,
+   which is passed in queryNorm. The neighbors are reordered in place */
+template <typename algorithmFpType, CpuType cpu>
+void processNeighbors(GlobalNeighbors<algorithmFpType, cpu> * neighbors, size_t count, algorithmFpType queryNorm, const PredictionOptions & options,
+                      const algorithmFpType * labels, const int * trainIndices, algorithmFpType * response, int * indices, algorithmFpType * distances)
+{
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
+    const bool weighted = (options.voteWeights == voteDistance);
+    if (distances || weighted)
+    {
+        /* The transformation is monotonic, so the order of neighbors does not change */
+        for (size_t i = 0; i < count; ++i)
+        {
+            const algorithmFpType d = neighbors[i].distance + queryNorm;
+            neighbors[i].distance = (d > 0) ? Math::sSqrt(d) : algorithmFpType(0);
+        }
+    }
+
+    if (indices || distances)
+    {
+        daal::algorithms::internal::introSort<cpu>(neighbors, neighbors + count, [](const Neighbors & a, const Neighbors & b) -> bool
+        {
+            return (a.distance < b.distance) || (a.distance == b.distance && a.index < b.index);
+        } );
+        if (indices)
+        {
+            for (size_t i = 0; i < count; ++i) { indices[i] = trainIndices ? trainIndices[neighbors[i].index] : static_cast<int>(neighbors[i].index); }
+            for (size_t i = count; i < options.k; ++i) { indices[i] = -1; }
+        }
+        if (distances)
+        {
+            for (size_t i = 0; i < count; ++i) { distances[i] = neighbors[i].distance; }
+            for (size_t i = count; i < options.k; ++i) { distances[i] = daal::services::internal::MaxVal<algorithmFpType>::get(); }
+        }
+    }
+
+    if (!response) { return; }
+    if (count < 1)
+    {
+        *response = 0;
+        return;
+    }
+
+    /* With the inverse distance weights, the neighbors that coincide with the query point take all the weight */
+    bool exactMatch = false;
+    if (weighted)
+    {
+        for (size_t i = 0; i < count; ++i) { exactMatch |= (neighbors[i].distance == 0); }
+    }
+    const algorithmFpType one = 1.0;
+    auto weight = [=](const Neighbors & n) -> algorithmFpType
+    {
+        if (!weighted) { return one; }
+        if (exactMatch) { return (n.distance == 0) ? one : algorithmFpType(0); }
+        return one / n.distance;
+    };
+
+    if (options.predictionMode == responseAveraging)
+    {
+        algorithmFpType sum = 0;
+        algorithmFpType weightSum = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const algorithmFpType w = weight(neighbors[i]);
+            sum += w * labels[neighbors[i].index];
+            weightSum += w;
+        }
+        *response = sum / weightSum;
+        return;
+    }
+
+    daal::algorithms::internal::introSort<cpu>(neighbors, neighbors + count, [=](const Neighbors & a, const Neighbors & b) -> bool
+    {
+        return labels[a.index] < labels[b.index];
+    } );
+    algorithmFpType winnerClass = labels[neighbors[0].index];
+    algorithmFpType winnerWeight = 0;
+    for (size_t i = 0; i < count;)
+    {
+        const algorithmFpType currentClass = labels[neighbors[i].index];
+        algorithmFpType currentWeight = 0;
+        for (; i < count && labels[neighbors[i].index] == currentClass; ++i) { currentWeight += weight(neighbors[i]); }
+        if (currentWeight > winnerWeight)
+        {
+            winnerWeight = currentWeight;
+            winnerClass = currentClass;
+        }
+    }
+    *response = winnerClass;
+}
+
 template<typename algorithmFpType, CpuType cpu>
 Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par)
+                 compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices,
+                         NumericTable * distances, const daal::algorithms::Parameter * par)
 {
     Status status;
 
@@ -197,22 +348,43 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
-    size_t k;
-    {
-        auto par1 = dynamic_cast<const kdtree_knn_classification::interface1::Parameter *>(par);
-        if(par1) k = par1->k;
-
-        auto par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(par);
-        if(par2) k = par2->k;
-
-        if(par1 == NULL && par2 == NULL) return Status(ErrorNullParameterNotSupported);
-    }
+    PredictionOptions options;
+    DAAL_CHECK_STATUS(status, getPredictionOptions<cpu>(par, options));
+    const size_t k = options.k;
 
     const Model * const model = static_cast<const Model *>(m);
-    const auto & kdTreeTable = *(model->impl()->getKDTreeTable());
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(model->impl()->getKDTreeTable()->getArray());
     const auto rootTreeNodeIndex = model->impl()->getRootNodeIndex();
-    const NumericTable & data = *(model->impl()->getData());
-    const NumericTable & labels = *(model->impl()->getLabels());
+    NumericTable & data = const_cast<NumericTable &>(*(model->impl()->getData()));
+    NumericTable & labelTable = const_cast<NumericTable &>(*(model->impl()->getLabels()));
+    const size_t nPoints = data.getNumberOfRows();
+    const size_t nFeatures = data.getNumberOfColumns();
+
+    /* Columns of the training points. The training sorts the points by leaves, so the points of a leaf are contiguous
+       in every feature and their distances to a query are computed with unit-stride vector loads. The columns of the data
+       kept by the training in the column-major layout are read without a copy */
+    TArray<ReadColumns<algorithmFpType, cpu>, cpu> columnsArray(nFeatures);
+    TArray<const algorithmFpType *, cpu> columnPtrsArray(nFeatures);
+    DAAL_CHECK_MALLOC(columnsArray.get() && columnPtrsArray.get());
+    const algorithmFpType ** const columns = columnPtrsArray.get();
+    {
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j)
+        {
+            columns[j] = columnsArray[j].set(&data, j, 0, nPoints);
+            DAAL_CHECK_BLOCK_STATUS_THR(columnsArray[j]);
+        } );
+        DAAL_CHECK_SAFE_STATUS()
+    }
+
+    ReadColumns<algorithmFpType, cpu> labelsColumn(labelTable, 0, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(labelsColumn);
+    const algorithmFpType * const labels = labelsColumn.get();
+
+    /* The training reorders the points, the model keeps their positions in the input dataset */
+    ReadColumns<int, cpu> trainIndicesColumn(indices ? const_cast<NumericTable *>(model->impl()->getIndices().get()) : nullptr, 0, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(trainIndicesColumn);
+    const int * const trainIndices = trainIndicesColumn.get();
 
     size_t iSize = 1;
     while (iSize < k) { iSize *= 2; }
@@ -220,7 +392,7 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
 
     const size_t xRowCount = x->getNumberOfRows();
     const algorithmFpType base = 2.0;
-    const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
+    const size_t expectedMaxDepth = (Math::sLog(nPoints) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
     struct Local
     {
@@ -252,39 +424,61 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
 
     DAAL_CHECK_STATUS_OK((status.ok()), status);
 
-    const auto maxThreads = threader_get_threads_number();
     const size_t xColumnCount = x->getNumberOfColumns();
-    const size_t yColumnCount = y->getNumberOfColumns();
-    const auto rowsPerBlock = (xRowCount + maxThreads - 1) / maxThreads;
-    const auto blockCount = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    const size_t yColumnCount = y ? y->getNumberOfColumns() : 0;
+    const size_t blockCount = (xRowCount + __KDTREE_QUERY_BLOCK_SIZE - 1) / __KDTREE_QUERY_BLOCK_SIZE;
     SafeStatus safeStat;
-    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &data, &labels, &rowsPerBlock, &k, &safeStat](int iBlock)
+    daal::threader_for(blockCount, blockCount, [&](size_t iBlock)
     {
         Local * const local = localTLS.local();
-        if (local)
+        DAAL_CHECK_MALLOC_THR(local);
+
+        const size_t first = iBlock * __KDTREE_QUERY_BLOCK_SIZE;
+        const size_t last = min<cpu>(first + __KDTREE_QUERY_BLOCK_SIZE, xRowCount);
+
+        ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        WriteOnlyRows<int, cpu> indicesRows(indices, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(indicesRows);
+        WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(distancesRows);
+        const algorithmFpType * const dx = xRows.get();
+        algorithmFpType * const dy = yRows.get();
+        int * const di = indicesRows.get();
+        algorithmFpType * const dd = distancesRows.get();
+
+        /* The queries of the block that fall into the same leaf are searched one after another,
+           so the nodes and the points near the leaf are reused from cache */
+        QueryLeaf order[__KDTREE_QUERY_BLOCK_SIZE];
+        for (size_t i = 0; i < last - first; ++i)
         {
-            const size_t first = iBlock * rowsPerBlock;
-            const size_t last = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
-
-            const algorithmFpType radius = MaxVal::get();
-            data_management::BlockDescriptor<algorithmFpType> xBD;
-            const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
-            const algorithmFpType * const dx = xBD.getBlockPtr();
-            data_management::BlockDescriptor<algorithmFpType> yBD;
-            y->getBlockOfRows(first, last - first, writeOnly, yBD);
-            auto * const dy = yBD.getBlockPtr();
-            for (size_t i = 0; i < last - first; ++i)
+            const algorithmFpType * const query = &dx[i * xColumnCount];
+            size_t nodeIndex = rootTreeNodeIndex;
+            while (nodes[nodeIndex].dimension != __KDTREE_NULLDIMENSION)
             {
-                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data);
-                services::Status s = predict(dy[i * yColumnCount], local->heap, labels, k);
-                DAAL_CHECK_STATUS_THR(s)
+                const KDTreeNode & node = nodes[nodeIndex];
+                nodeIndex = (query[node.dimension] < node.cutPoint) ? node.leftIndex : node.rightIndex;
             }
-            y->releaseBlockOfRows(yBD);
-            const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
+            order[i].leaf = nodeIndex;
+            order[i].query = i;
         }
-    } );
+        daal::algorithms::internal::introSort<cpu>(order, order + (last - first), [](const QueryLeaf & a, const QueryLeaf & b) -> bool
+        {
+            return (a.leaf < b.leaf) || (a.leaf == b.leaf && a.query < b.query);
+        } );
 
-    DAAL_CHECK_SAFE_STATUS()
+        const algorithmFpType radius = MaxVal::get();
+        for (size_t i = 0; i < last - first; ++i)
+        {
+            const size_t iQuery = order[i].query;
+            findNearestNeighbors(&dx[iQuery * xColumnCount], local->heap, local->stack, k, radius, nodes, rootTreeNodeIndex, columns, nFeatures);
+            processNeighbors<algorithmFpType, cpu>(local->heap.elements(), local->heap.size(), algorithmFpType(0), options, labels, trainIndices,
+                                                   dy ? dy + iQuery * yColumnCount : nullptr, di ? di + iQuery * k : nullptr,
+                                                   dd ? dd + iQuery * k : nullptr);
+        }
+    } );
 
     localTLS.reduce([=](Local * ptr) -> void
     {
@@ -295,6 +489,8 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             service_scalable_free<Local, cpu>(ptr);
         }
     } );
+
+    DAAL_CHECK_SAFE_STATUS()
     return status;
 }
 
@@ -302,75 +498,56 @@ template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                          kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                         const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data)
+                         const KDTreeNode * nodes, size_t rootTreeNodeIndex, const algorithmFpType * const * columns, size_t nFeatures)
 {
     heap.reset();
     stack.reset();
     GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
     size_t i, j;
-    SearchNode<algorithmFpType> cur, toPush, interCur;
+    SearchNode<algorithmFpType> cur, toPush;
     const KDTreeNode * node;
     cur.nodeIndex = rootTreeNodeIndex;
     cur.minDistance = 0;
 
-    const size_t xRowCount = data.getNumberOfRows();
-    const size_t xColumnCount = data.getNumberOfColumns();
-
     DAAL_ALIGNAS(256) algorithmFpType distance[__KDTREE_LEAF_BUCKET_SIZE + 1];
     size_t start, end;
-    algorithmFpType dist, diff, val;
+    algorithmFpType diff, val;
 
-    data_management::BlockDescriptor<algorithmFpType> xBD[2];
-    size_t curBDIdx, nextBDIdx;
     for (;;)
     {
-        node = static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex;
+        node = nodes + cur.nodeIndex;
         if (node->dimension == __KDTREE_NULLDIMENSION)
         {
             start = node->leftIndex;
             end = node->rightIndex;
+            const size_t count = end - start;
 
-            for (i = start; i < end; ++i)
+            for (i = 0; i < count; ++i)
             {
-                distance[i - start] = 0;
+                distance[i] = 0;
             }
 
-            curBDIdx = 0;
-            nextBDIdx = 1;
-            const_cast<NumericTable &>(data).getBlockOfColumnValues(0, start, end - start, readOnly, xBD[curBDIdx]);
-            for (j = 1; j < xColumnCount; ++j)
+            for (j = 0; j < nFeatures; ++j)
             {
-                const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
-
-                const_cast<NumericTable &>(data).getBlockOfColumnValues(j, start, end - start, readOnly, xBD[nextBDIdx]);
-                const algorithmFpType * const nx = xBD[nextBDIdx].getBlockPtr();
-                DAAL_PREFETCH_READ_T0(nx);
-                DAAL_PREFETCH_READ_T0(nx + 16);
+                const algorithmFpType * const column = columns[j] + start;
+                if (j + 1 < nFeatures) { DAAL_PREFETCH_READ_T0(columns[j + 1] + start); }
+                const algorithmFpType q = query[j];
 
-                for (i = 0; i < end - start; ++i)
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (i = 0; i < count; ++i)
                 {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+                    const algorithmFpType d = column[i] - q;
+                    distance[i] += d * d;
                 }
-
-                const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
-
-                const auto tempBDIdx = curBDIdx; curBDIdx = nextBDIdx; nextBDIdx = tempBDIdx;
-            }
-            {
-                const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
-                for (i = 0; i < end - start; ++i)
-                {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-                }
-                const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
             }
 
-            for (i = start; i < end; ++i)
+            for (i = 0; i < count; ++i)
             {
-                if (distance[i - start] <= radius)
+                if (distance[i] <= radius)
                 {
-                    curNeighbor.distance = distance[i - start];
-                    curNeighbor.index = i;
+                    curNeighbor.distance = distance[i];
+                    curNeighbor.index = start + i;
                     if (heap.size() < k)
                     {
                         heap.push(curNeighbor, k);
@@ -394,7 +571,7 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             if (!stack.empty())
             {
                 cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
+                DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
             }
             else { break; }
 
@@ -408,71 +585,19 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             {
                 cur.nodeIndex = (diff < 0) ? node->leftIndex : node->rightIndex;
                 toPush.nodeIndex = (diff < 0) ? node->rightIndex : node->leftIndex;
-                val -= node->cutPoint;
-                toPush.minDistance = cur.minDistance + val * val;
+                toPush.minDistance = cur.minDistance + diff * diff;
                 stack.push(toPush);
             }
             else if (!stack.empty())
             {
                 cur = stack.pop();
-                DAAL_PREFETCH_READ_T0(static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex);
+                DAAL_PREFETCH_READ_T0(nodes + cur.nodeIndex);
             }
             else { break; }
         }
     }
 }
 
-template<typename algorithmFpType, CpuType cpu>
-services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-    predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
-{
-    const size_t heapSize = heap.size();
-    if (heapSize < 1)
-        return services::Status();
-
-    struct Voting
-    {
-        algorithmFpType predictedClass;
-        size_t weight;
-
-    };
-
-    data_management::BlockDescriptor<algorithmFpType> labelBD;
-    algorithmFpType * classes = static_cast<algorithmFpType *>(daal_malloc(heapSize * sizeof(*classes)));
-    DAAL_CHECK_MALLOC(classes)
-    for (size_t i = 0; i < heapSize; ++i)
-    {
-        const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
-        classes[i] = *(labelBD.getBlockPtr());
-        const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelBD);
-    }
-    daal::algorithms::internal::qSort<algorithmFpType, cpu>(heapSize, classes);
-    algorithmFpType currentClass = classes[0];
-    algorithmFpType winnerClass = currentClass;
-    size_t currentWeight = 1;
-    size_t winnerWeight = currentWeight;
-    for (size_t i = 1; i < heapSize; ++i)
-    {
-        if (classes[i] == currentClass)
-        {
-            if((++currentWeight) > winnerWeight)
-            {
-                winnerWeight = currentWeight;
-                winnerClass = currentClass;
-            }
-        }
-        else
-        {
-            currentWeight = 1;
-            currentClass = classes[i];
-        }
-    }
-    predictedClass = winnerClass;
-    daal_free(classes);
-    classes = nullptr;
-    return services::Status();
-}
-
 } // namespace internal
 } // namespace prediction
 } // namespace kdtree_knn_classification
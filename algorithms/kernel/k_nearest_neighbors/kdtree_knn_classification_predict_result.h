@@ -0,0 +1,70 @@
+/* file: kdtree_knn_classification_predict_result.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the result of K-Nearest Neighbors (kNN) model-based prediction
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_RESULT_
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_RESULT_
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+
+/**
+ * Allocates memory to store the results of KD-tree based kNN model-based prediction
+ * \param[in] input     Pointer to an object containing the input data
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    services::Status status = classifier::prediction::Result::allocate<algorithmFPType>(input, parameter, method);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const kdtree_knn_classification::interface3::Parameter *par = dynamic_cast<const kdtree_knn_classification::interface3::Parameter *>(parameter);
+    if (!par) { return status; }
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        set(indices, data_management::HomogenNumericTable<int>::create(par->k, nRows, data_management::NumericTable::doAllocate, &status));
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        set(distances, data_management::HomogenNumericTable<algorithmFPType>::create(par->k, nRows, data_management::NumericTable::doAllocate, &status));
+    }
+    return status;
+}
+
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
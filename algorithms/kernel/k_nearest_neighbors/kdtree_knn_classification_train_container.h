@@ -78,8 +78,17 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     daal::services::Environment::env & env = *_env;
 
     const bool copy = (par->dataUseInModel == doNotUse);
-    r->impl()->setData<algorithmFpType>(x, copy);
+    if (method == bruteForceDense)
+    {
+        services::Status s = r->impl()->setRowMajorData<algorithmFpType>(x, copy);
+        if (!s) { return s; }
+    }
+    else
+    {
+        r->impl()->setData<algorithmFpType>(x, copy);
+    }
     r->impl()->setLabels<algorithmFpType>(y, copy);
+    r->impl()->resetUpdates(x->getNumberOfRows());
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method),    \
                        compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine);
@@ -117,13 +126,24 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
 
     const kdtree_knn_classification::ModelPtr r = result->get(classifier::training::model);
 
-    const kdtree_knn_classification::Parameter * const par = static_cast<kdtree_knn_classification::Parameter *>(_par);
+    const kdtree_knn_classification::interface2::Parameter * const par = static_cast<kdtree_knn_classification::interface2::Parameter *>(_par);
 
     daal::services::Environment::env & env = *_env;
 
     const bool copy = (par->dataUseInModel == doNotUse);
-    r->impl()->setData<algorithmFpType>(x, copy);
+    if (method == bruteForceDense)
+    {
+        services::Status s = r->impl()->setRowMajorData<algorithmFpType>(x, copy);
+        if (!s) { return s; }
+    }
+    else
+    {
+        r->impl()->setData<algorithmFpType>(x, copy);
+    }
     r->impl()->setLabels<algorithmFpType>(y, copy);
+    r->impl()->resetUpdates(x->getNumberOfRows());
+    const kdtree_knn_classification::interface3::Parameter * const par3 = dynamic_cast<const kdtree_knn_classification::interface3::Parameter *>(par);
+    if (par3) { r->impl()->setRebuildThreshold(par3->rebuildThreshold); }
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method),    \
                        compute, r->impl()->getData().get(), r->impl()->getLabels().get(), r.get(), *par->engine);
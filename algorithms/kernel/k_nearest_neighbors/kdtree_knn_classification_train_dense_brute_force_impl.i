@@ -0,0 +1,76 @@
+/* file: kdtree_knn_classification_train_dense_brute_force_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training for the brute-force (bruteForceDense) method.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTE_FORCE_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTE_FORCE_IMPL_I__
+
+#include "daal_defines.h"
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_classification_train_kernel.h"
+#include "kdtree_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+
+using namespace daal::services;
+
+/**
+ *  The brute-force method does not build any search structure: the training data is kept in the model as is
+ *  (it is copied to the row-major layout by the container when required), so that the prediction can
+ *  process it with the blocked matrix multiplication. The squared norms of the training points are computed
+ *  once and kept in the model for the prediction.
+ */
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu>::
+                 compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine)
+{
+    r->setNFeatures(x->getNumberOfColumns());
+    r->impl()->setKDTreeTable(KDTreeTablePtr());
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(0);
+
+    Status status;
+    const size_t nRows = x->getNumberOfRows();
+    services::SharedPtr<HomogenNumericTable<algorithmFpType> > norms = HomogenNumericTable<algorithmFpType>::create(1, nRows,
+                                                                                                                    NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, (kdtree_knn_classification::internal::computeSquaredNorms<algorithmFpType, cpu>(*x, norms->getArray())));
+    r->impl()->setSquaredNorms(norms);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
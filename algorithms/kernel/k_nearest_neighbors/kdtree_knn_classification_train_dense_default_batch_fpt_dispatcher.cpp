@@ -31,5 +31,9 @@ __DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::training::inter
                                       kdtree_knn_classification::training::defaultDense)
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::training::BatchContainer, batch, DAAL_FPTYPE, \
                                       kdtree_knn_classification::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::training::interface1::BatchContainer, batch, DAAL_FPTYPE, \
+                                      kdtree_knn_classification::training::bruteForceDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::training::BatchContainer, batch, DAAL_FPTYPE, \
+                                      kdtree_knn_classification::training::bruteForceDense)
 } // namespace algorithms
 } // namespace daal
@@ -168,6 +168,8 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     DAAL_CHECK_STATUS(status, buildSecondPartOfKDTree(q, bboxQ, *x, *r, indexes, engine));
     DAAL_CHECK_STATUS(status, rearrangePoints(*x, indexes));
     DAAL_CHECK_STATUS(status, rearrangePoints(*y, indexes));
+    DAAL_CHECK_STATUS(status, reorderNodesBreadthFirst(*r));
+    DAAL_CHECK_STATUS(status, storeIndices(*r, indexes, xRowCount));
 
     daal_free(bboxQ);
     daal_free(indexes);
@@ -769,6 +771,27 @@ void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense,
     }
 }
 
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
+    storeIndices(kdtree_knn_classification::Model & r, const size_t * indexes, size_t nRows)
+{
+    Status status;
+    NumericTablePtr indicesTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    WriteOnlyColumns<int, cpu> indicesColumn(indicesTable.get(), 0, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(indicesColumn);
+    int * const indices = indicesColumn.get();
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        indices[i] = static_cast<int>(indexes[i]);
+    }
+    indicesColumn.release();
+
+    r.impl()->setIndices(indicesTable);
+    return status;
+}
+
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
     rearrangePoints(NumericTable & x, const size_t * indexes)
@@ -857,6 +880,57 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     return status;
 }
 
+/**
+ * Copies the nodes reachable from the root to the new table in the breadth-first order. The upper levels of the tree,
+ * which every search passes through, become contiguous in memory, and the children of a node are stored next to each other,
+ * so the search loads the far child from the same cache line as the near one. The unused nodes left between the subtrees
+ * built by different threads are dropped.
+ */
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::reorderNodesBreadthFirst(kdtree_knn_classification::Model & r)
+{
+    const KDTreeTablePtr oldTable = r.impl()->getKDTreeTable();
+    const KDTreeNode * const oldNodes = static_cast<const KDTreeNode *>(oldTable->getArray());
+    const size_t maxNodeCount = oldTable->getNumberOfRows();
+
+    TArray<size_t, cpu> orderArray(maxNodeCount);
+    size_t * const order = orderArray.get();
+    DAAL_CHECK_MALLOC(order);
+
+    size_t nodeCount = 1;
+    order[0] = r.impl()->getRootNodeIndex();
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        const KDTreeNode & node = oldNodes[order[i]];
+        if (node.dimension != __KDTREE_NULLDIMENSION)
+        {
+            order[nodeCount++] = node.leftIndex;
+            order[nodeCount++] = node.rightIndex;
+        }
+    }
+
+    Status status;
+    KDTreeTablePtr newTable(new KDTreeTable(nodeCount, status));
+    DAAL_CHECK_STATUS_VAR(status);
+    KDTreeNode * const newNodes = static_cast<KDTreeNode *>(newTable->getArray());
+
+    size_t childIndex = 1;
+    for (size_t i = 0; i < nodeCount; ++i)
+    {
+        newNodes[i] = oldNodes[order[i]];
+        if (newNodes[i].dimension != __KDTREE_NULLDIMENSION)
+        {
+            newNodes[i].leftIndex = childIndex++;
+            newNodes[i].rightIndex = childIndex++;
+        }
+    }
+
+    r.impl()->setKDTreeTable(newTable);
+    r.impl()->setRootNodeIndex(0);
+    r.impl()->setLastNodeIndex(nodeCount);
+    return status;
+}
+
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
     buildSecondPartOfKDTree(Queue<BuildNode, cpu> & q, BoundingBox<algorithmFpType> * & bboxQ, const NumericTable & x,
@@ -88,6 +88,10 @@ protected:
 
     Status rearrangePoints(NumericTable & x, const size_t * indexes);
 
+    Status reorderNodesBreadthFirst(kdtree_knn_classification::Model & r);
+
+    Status storeIndices(kdtree_knn_classification::Model & r, const size_t * indexes, size_t nRows);
+
     Status buildSecondPartOfKDTree(Queue<BuildNode, cpu> & q, BoundingBox<algorithmFpType> * & bboxQ, const NumericTable & x,
                                  kdtree_knn_classification::Model & r, size_t * indexes, engines::BatchBase &engine);
 
@@ -105,6 +109,13 @@ protected:
                                     IndexValuePair<algorithmFpType, cpu> * outValues);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, engines::BatchBase &engine);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace kdtree_knn_classification
@@ -24,6 +24,11 @@
 #ifndef __KDTREE_KNN_IMPL_I__
 #define __KDTREE_KNN_IMPL_I__
 
+#include "threading.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+
 #if defined(_MSC_VER) || defined(__INTEL_COMPILER)
     #include <immintrin.h>
 #endif
@@ -67,6 +72,9 @@ namespace internal
 
 #define __KDTREE_NULLDIMENSION (static_cast<size_t>(-1))
 
+/* Number of rows read at once when the squared norms of the rows are computed */
+#define __KDTREE_NORMS_BLOCK_SIZE 512
+
 template <CpuType cpu, typename T>
 inline const T & min(const T & a, const T & b) { return !(b < a) ? a : b; }
 
@@ -156,6 +164,37 @@ private:
     size_t _sizeMinus1;
 };
 
+/* Computes the squared Euclidean norms of the rows of the data. The rows are read block by block, so the data
+   stored in the column-major layout is not converted as a whole */
+template <typename algorithmFpType, CpuType cpu>
+services::Status computeSquaredNorms(data_management::NumericTable & data, algorithmFpType * norms)
+{
+    const size_t nRows = data.getNumberOfRows();
+    const size_t nCols = data.getNumberOfColumns();
+    const size_t blockSize = __KDTREE_NORMS_BLOCK_SIZE;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iFirst = iBlock * blockSize;
+        const size_t nBlockRows = min<cpu>(blockSize, nRows - iFirst);
+        daal::internal::ReadRows<algorithmFpType, cpu> rows(&data, iFirst, nBlockRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(rows);
+        const algorithmFpType * const block = rows.get();
+        for (size_t i = 0; i < nBlockRows; ++i)
+        {
+            const algorithmFpType * const row = block + i * nCols;
+            algorithmFpType sum = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nCols; ++j) { sum += row[j] * row[j]; }
+            norms[iFirst + i] = sum;
+        }
+    } );
+    return safeStat.detach();
+}
+
 } // namespace internal
 } // namespace kdtree_knn_classification
 } // namespace algorithms
@@ -0,0 +1,145 @@
+/* file: prediction_session.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the base class of the low-latency prediction sessions.
+//--
+*/
+
+#include "algorithms/prediction_session.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "service_threading.h"
+#include "service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+using namespace daal::data_management;
+
+/* Tree ensemble prediction kernels split the rows into blocks of 2 * VECTOR_BLOCK_SIZE (128) rows
+ * before threading, so smaller inputs give them a single task and are computed on the calling thread */
+const size_t defaultSequentialThreshold = 128;
+
+/* Buffers and computation environment of the prediction session */
+class PredictionSessionImpl
+{
+public:
+    DAAL_NEW_DELETE();
+
+    PredictionSessionImpl() : algorithm(nullptr), sequentialArena(1) {}
+
+    services::Status allocate(size_t nFeatures, size_t nOutputs, size_t maxRows)
+    {
+        services::Status s;
+        dataBuffer.reset((float *)services::daal_malloc(nFeatures * maxRows * sizeof(float)), services::ServiceDeleter());
+        predictionBuffer.reset((float *)services::daal_malloc(nOutputs * maxRows * sizeof(float)), services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(dataBuffer.get() && predictionBuffer.get());
+
+        /* The tables use the memory of the session, so changing the number of rows does not reallocate them */
+        data = HomogenNumericTable<float>::create(dataBuffer, nFeatures, maxRows, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        prediction = HomogenNumericTable<float>::create(predictionBuffer, nOutputs, maxRows, &s);
+        return s;
+    }
+
+    services::SharedPtr<float> dataBuffer;
+    services::SharedPtr<float> predictionBuffer;
+    NumericTablePtr data;
+    NumericTablePtr prediction;
+    Prediction *algorithm;
+    daal::task_arena sequentialArena;
+};
+
+} // namespace internal
+
+namespace interface1
+{
+
+PredictionSession::PredictionSession(size_t nFeatures, size_t nOutputs, size_t maxRows) :
+    _nFeatures(nFeatures), _nOutputs(nOutputs), _maxRows(maxRows), _sequentialThreshold(internal::defaultSequentialThreshold), _impl(nullptr)
+{
+}
+
+PredictionSession::~PredictionSession()
+{
+    delete _impl;
+}
+
+services::Status PredictionSession::initialize(Prediction *algorithm)
+{
+    DAAL_CHECK(algorithm, services::ErrorNullPtr);
+    DAAL_CHECK_EX(_nFeatures > 0, services::ErrorIncorrectParameter, services::ArgumentName, "nFeatures");
+    DAAL_CHECK_EX(_nOutputs > 0, services::ErrorIncorrectParameter, services::ArgumentName, "nOutputs");
+    DAAL_CHECK_EX(_maxRows > 0, services::ErrorIncorrectParameter, services::ArgumentName, "maxRows");
+
+    _impl = new internal::PredictionSessionImpl();
+    DAAL_CHECK_MALLOC(_impl);
+    services::Status s = _impl->allocate(_nFeatures, _nOutputs, _maxRows);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    s = bind(_impl->data, _impl->prediction);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The computation environment and the result bound to the session buffers are kept between the calls */
+    algorithm->enablePreparedCompute(true);
+    _impl->algorithm = algorithm;
+    return s;
+}
+
+services::Status PredictionSession::predict(const float *rows, size_t nRows, float *out)
+{
+    DAAL_CHECK_STATUS_VAR(_status);
+    DAAL_CHECK(_impl, services::ErrorNullPtr);
+    DAAL_CHECK(nRows, services::ErrorIncorrectNumberOfObservations);
+    DAAL_CHECK(rows && out, services::ErrorNullPtr);
+
+    services::Status s;
+    for(size_t iFirstRow = 0; iFirstRow < nRows && s; iFirstRow += _maxRows)
+    {
+        const size_t nRowsInBlock = (nRows - iFirstRow < _maxRows ? nRows - iFirstRow : _maxRows);
+        s = predictBlock(rows + iFirstRow * _nFeatures, nRowsInBlock, out + iFirstRow * _nOutputs);
+    }
+    return s;
+}
+
+services::Status PredictionSession::predictBlock(const float *rows, size_t nRows, float *out)
+{
+    services::Status s;
+    services::daal_memcpy_s(_impl->dataBuffer.get(), _nFeatures * _maxRows * sizeof(float), rows, _nFeatures * nRows * sizeof(float));
+
+    DAAL_CHECK_STATUS(s, _impl->data->resize(nRows));
+    DAAL_CHECK_STATUS(s, _impl->prediction->resize(nRows));
+
+    Prediction *algorithm = _impl->algorithm;
+    if(nRows < _sequentialThreshold)
+        _impl->sequentialArena.execute([&]() { s = algorithm->computeNoThrow(); });
+    else
+        s = algorithm->computeNoThrow();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    services::daal_memcpy_s(out, _nOutputs * nRows * sizeof(float), _impl->predictionBuffer.get(), _nOutputs * nRows * sizeof(float));
+    return s;
+}
+
+} // namespace interface1
+} // namespace algorithms
+} // namespace daal
@@ -72,6 +72,18 @@ void popMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare c
     }
 }
 
+template <CpuType cpu, typename RandomAccessIterator, typename Compare>
+void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    for (auto i = last - first - 1; 0 < i;)
+    {
+        const auto parent = heapParentIndex<cpu>(i);
+        if (!compare(*(first + parent), *(first + i))) { break; }
+        iterSwap<cpu>(first + parent, first + i);
+        i = parent;
+    }
+}
+
 template <CpuType cpu, typename RandomAccessIterator, typename Compare>
 void makeMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
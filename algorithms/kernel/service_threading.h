@@ -104,6 +104,36 @@ protected:
     void* _impl;
 };
 
+/* Executes functors on the limited number of threads.
+   Parallel loops run within an arena of one thread are executed by the calling thread only */
+class task_arena
+{
+public:
+    task_arena(int nThreads) : _impl(nullptr)
+    {
+        _impl = _daal_new_task_arena(nThreads);
+    }
+    ~task_arena()
+    {
+        if(_impl)
+            _daal_del_task_arena(_impl);
+    }
+    template<typename F>
+    void execute(const F &f)
+    {
+        if(_impl)
+        {
+            auto wrapper = [&](int) { f(); };
+            _daal_execute_in_task_arena(_impl, &wrapper, threader_func<decltype(wrapper)>);
+        }
+        else
+            f();
+    }
+
+protected:
+    void* _impl;
+};
+
 template <typename T, CpuType cpu, typename Allocator = services::internal::ScalableMalloc<T, cpu>>
 class TlsMem : public daal::tls<T *>
 {
@@ -604,6 +604,21 @@ DAAL_EXPORT void  _daal_wait_task_group(void *taskGroupPtr)
     ((tbb::task_group*)taskGroupPtr)->wait();
 }
 
+DAAL_EXPORT void *_daal_new_task_arena(int nThreads)
+{
+    return new tbb::task_arena(nThreads);
+}
+
+DAAL_EXPORT void  _daal_del_task_arena(void *taskArenaPtr)
+{
+    delete (tbb::task_arena*)taskArenaPtr;
+}
+
+DAAL_EXPORT void  _daal_execute_in_task_arena(void *taskArenaPtr, const void *a, daal::functype func)
+{
+    ((tbb::task_arena*)taskArenaPtr)->execute([&]() { func(0, a); });
+}
+
 #else
 DAAL_EXPORT void *_daal_get_ls_ptr(void *a, daal::tls_functype func)
 {
@@ -645,6 +660,20 @@ DAAL_EXPORT void  _daal_wait_task_group(void *taskGroupPtr)
 {
 }
 
+DAAL_EXPORT void *_daal_new_task_arena(int nThreads)
+{
+    return nullptr;
+}
+
+DAAL_EXPORT void  _daal_del_task_arena(void *taskArenaPtr)
+{
+}
+
+DAAL_EXPORT void  _daal_execute_in_task_arena(void *taskArenaPtr, const void *a, daal::functype func)
+{
+    func(0, a);
+}
+
 #endif
 
 namespace daal
@@ -66,6 +66,10 @@ extern "C" {
     DAAL_EXPORT void  _daal_run_task_group(void *taskGroupPtr, daal::task* t);
     DAAL_EXPORT void  _daal_wait_task_group(void *taskGroupPtr);
 
+    DAAL_EXPORT void *_daal_new_task_arena(int nThreads);
+    DAAL_EXPORT void  _daal_del_task_arena(void *taskArenaPtr);
+    DAAL_EXPORT void  _daal_execute_in_task_arena(void *taskArenaPtr, const void *a, daal::functype func);
+
     DAAL_EXPORT void _daal_tbb_task_scheduler_free(void*& init);
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void **init);
 
@@ -0,0 +1,85 @@
+/* file: datasource_sampling.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of training the decision forest classification model
+!    on a stratified sample of the rows read from a file
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_SAMPLING"></a>
+ * \example datasource_sampling.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_classification_train.csv";
+const size_t nFeatures = 3;  /* Number of features in training data set */
+const size_t nClasses  = 5;  /* Number of classes */
+
+/* Sampling parameters */
+const size_t nRowsPerClass = 50;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(trainDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Select at most nRowsPerClass rows of each class while reading the file */
+    SamplingParameter samplingParameter(stratifiedSampling, nRowsPerClass);
+    samplingParameter.engine = engines::mt19937::Batch<>::create(777);
+    SamplingDataSource samplingDataSource(dataSource, samplingParameter);
+
+    /* Create Numeric Tables for training data and labels */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    NumericTablePtr trainLabels(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainLabels));
+
+    /* Retrieve the sample of the data from the input file */
+    samplingDataSource.loadDataBlock(mergedData.get());
+
+    std::cout << "Number of rows read: " << samplingDataSource.getNumberOfProcessedRows() << std::endl;
+    std::cout << "Number of rows in the sample: " << trainData->getNumberOfRows() << std::endl;
+
+    /* Create an algorithm object to train the decision forest classification model */
+    training::Batch<> algorithm(nClasses);
+    algorithm.parameter.nTrees = 10;
+    algorithm.parameter.featuresPerNode = nFeatures;
+
+    /* Pass the sample to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainLabels);
+
+    /* Build the decision forest classification model */
+    algorithm.compute();
+
+    printNumericTable(trainLabels, "Labels of the sample (first 10 rows):", 10);
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/* file: dbscan_dense_grid_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense DBSCAN clustering with the grid method in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DBSCAN_GRID_BATCH"></a>
+ * \example dbscan_dense_grid_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/dbscan_dense.csv";
+
+/* DBSCAN algorithm parameters */
+const float epsilon = 0.02f;
+const size_t minObservations = 180;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm object for the DBSCAN algorithm that finds the neighborhoods of observations
+       with the grid of cells of size epsilon instead of computing the distances between all pairs of observations */
+    dbscan::Batch<float, dbscan::gridDense> algorithm(epsilon, minObservations);
+
+    algorithm.input.set(dbscan::data, dataSource.getNumericTable());
+
+    algorithm.compute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(dbscan::nClusters), "Number of clusters:");
+    printNumericTable(algorithm.getResult()->get(dbscan::assignments), "Assignments of first 20 observations:", 20);
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/* file: df_cls_compiled_model.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification model compiled into native code.
+!
+!    The program trains the decision forest classification model, generates
+!    C++ source of the prediction function from the model traversal, builds it
+!    into a shared object with the system compiler and loads it. Predictions of
+!    the compiled model are compared with the ones computed by the library.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_CLS_COMPILED_MODEL"></a>
+ * \example df_cls_compiled_model.cpp
+ */
+
+#include <chrono>
+
+#include "daal.h"
+#include "service.h"
+#include "tree_compiler.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_classification_train.csv";
+const string testDatasetFileName  = "../data/batch/df_classification_test.csv";
+const size_t nFeatures  = 3;  /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 10;
+const size_t minObservationsInLeafNode = 8;
+
+const size_t nClasses = 5;  /* Number of classes */
+
+/* Number of prediction runs used to measure the throughput */
+const size_t nRepeats = 100;
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+decision_forest::classification::ModelPtr trainModel();
+void testModel(const decision_forest::classification::ModelPtr& model, const tree_compiler::CompiledModel& compiledModel);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    decision_forest::classification::ModelPtr model = trainModel();
+
+    /* Generate the source of the prediction function from the trees of the model */
+    const std::vector<tree_compiler::Tree> trees =
+        tree_compiler::readTrees<tree_utils::classification::LeafNodeDescriptor>(*model);
+    const std::string source = tree_compiler::generateSource(trees, nFeatures, nClasses, tree_compiler::majorityVote);
+
+    /* Build and load the shared object */
+    tree_compiler::CompiledModel compiledModel;
+    if(!compiledModel.build(source, "df_cls_compiled_model"))
+        return 0;
+
+    testModel(model, compiledModel);
+    return 0;
+}
+
+decision_forest::classification::ModelPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the decision forest classification model */
+    training::Batch<float> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainDependentVariable);
+
+    algorithm.parameter.nTrees = nTrees;
+    algorithm.parameter.featuresPerNode = nFeatures;
+    algorithm.parameter.minObservationsInLeafNode = minObservationsInLeafNode;
+
+    /* Build the decision forest classification model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return services::staticPointerCast<decision_forest::classification::Model, classifier::Model>(
+        algorithm.getResult()->get(classifier::training::model));
+}
+
+void testModel(const decision_forest::classification::ModelPtr& model, const tree_compiler::CompiledModel& compiledModel)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+    const size_t nRows = testData->getNumberOfRows();
+
+    /* Create an algorithm object to predict values of decision forest classification */
+    prediction::Batch<float> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+
+    /* Predict values of decision forest classification with the library */
+    const std::chrono::steady_clock::time_point libraryStart = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < nRepeats; ++i)
+        algorithm.compute();
+    const std::chrono::steady_clock::time_point libraryFinish = std::chrono::steady_clock::now();
+    NumericTablePtr libraryPrediction = algorithm.getResult()->get(classifier::prediction::prediction);
+
+    /* Predict values with the compiled model */
+    BlockDescriptor<float> xBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    std::vector<float> compiledPrediction(nRows);
+    const std::chrono::steady_clock::time_point compiledStart = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < nRepeats; ++i)
+        compiledModel.predict(xBlock.getBlockPtr(), nRows, &compiledPrediction[0]);
+    const std::chrono::steady_clock::time_point compiledFinish = std::chrono::steady_clock::now();
+    testData->releaseBlockOfRows(xBlock);
+
+    /* Compare the predictions */
+    BlockDescriptor<float> resBlock;
+    libraryPrediction->getBlockOfRows(0, nRows, readOnly, resBlock);
+    size_t nMismatches = 0;
+    for(size_t i = 0; i < nRows; ++i)
+        nMismatches += (resBlock.getBlockPtr()[i] != compiledPrediction[i]);
+    libraryPrediction->releaseBlockOfRows(resBlock);
+
+    printNumericTable(libraryPrediction, "Decision forest prediction results (first 10 rows):", 10);
+    printArray<float>(&compiledPrediction[0], 1, std::min<size_t>(nRows, 10), "Compiled model prediction results (first 10 rows):");
+    std::cout << "Number of different predictions: " << nMismatches << std::endl;
+    std::cout << "Prediction time of " << nRepeats << " runs, ms: library " <<
+        std::chrono::duration<double, std::milli>(libraryFinish - libraryStart).count() << ", compiled model " <<
+        std::chrono::duration<double, std::milli>(compiledFinish - compiledStart).count() << std::endl;
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<float>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file. The generated code supports ordered features only,
+       so categorical feature 2 of the data set is loaded as continuous one */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,126 @@
+/* file: df_cls_dense_batch_bulk_model_builder.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification model building.
+!
+!    The program builds the decision forest classification model
+!     from the arrays of tree nodes via Model Builder
+!     and computes classification for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_CLS_BULK_MODEL_BUILDER"></a>
+ * \example df_cls_dense_batch_bulk_model_builder.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+const string testDatasetFileName  = "../data/batch/df_classification_model_builder_test.csv";
+const size_t categoricalFeaturesIndices[] = { 2 };
+const size_t nFeatures  = 3;  /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 3;
+const size_t nClasses = 5;  /* Number of classes */
+
+
+void testModel(decision_forest::classification::ModelPtr& model);
+decision_forest::classification::ModelPtr buildModel();
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &testDatasetFileName);
+
+    decision_forest::classification::ModelPtr model = buildModel();
+    testModel(model);
+
+    return 0;
+}
+
+decision_forest::classification::ModelPtr buildModel()
+{
+    /* Nodes of all the trees, indexes of the child nodes are counted from the root of their tree */
+    const size_t treeOffsets[nTrees + 1] = { 0, 3, 6, 9 };
+    const int featureIndexes[]  = { 0, -1, -1,   1, -1, -1,   0, -1, -1 };
+    const size_t leftChildren[] = { 1,  0,  0,   1,  0,  0,   1,  0,  0 };
+    const size_t rightChildren[] = { 2,  0,  0,   2,  0,  0,   2,  0,  0 };
+    /* Split nodes: feature values, leaf nodes: class labels */
+    const double values[] = { 0.174108, 0, 4,   0.571184, 2, 4,   0.303995, 2, 4 };
+
+    ModelBuilder modelBuilder(nClasses, nTrees);
+    modelBuilder.addTrees(nTrees, treeOffsets, featureIndexes, leftChildren, rightChildren, values);
+
+    return modelBuilder.getModel();
+}
+
+void testModel(decision_forest::classification::ModelPtr& model)
+{
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of decision forest classification */
+    prediction::Batch<> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+
+    /* set model obtained by builder */
+    algorithm.input.set(classifier::prediction::model, model);
+
+    /* Predict values of decision forest classification */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    classifier::prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(classifier::prediction::prediction),
+        "Decision forest prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for(size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,170 @@
+/* file: df_cls_hist_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest classification in the batch processing mode
+!    with the histogram training method.
+!
+!    The program trains the decision forest classification models with the
+!    default and the histogram methods on a training data set and compares
+!    their classification errors on the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_CLS_HIST_BATCH"></a>
+ * \example df_cls_hist_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::decision_forest::classification;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/df_classification_train.csv";
+string testDatasetFileName  = "../data/batch/df_classification_test.csv";
+const size_t categoricalFeaturesIndices[] = { 2 };
+const size_t nFeatures  = 3;  /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 10;
+const size_t minObservationsInLeafNode = 8;
+
+/* Parameters of the histogram method */
+const size_t maxBins = 32;
+const size_t minBinSize = 5;
+
+const size_t nClasses = 5;  /* Number of classes */
+
+/* Maximal difference between the test errors of the histogram and the default methods */
+const double maxErrorDifference = 0.05;
+
+template <training::Method method>
+decision_forest::classification::ModelPtr trainModel(const NumericTablePtr& trainData, const NumericTablePtr& trainDependentVariable);
+void setParameters(training::Parameter& parameter);
+void setParameters(training::HistParameter& parameter);
+double testModel(const decision_forest::classification::ModelPtr& model, const NumericTablePtr& testData, const NumericTablePtr& testGroundTruth);
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData, trainDependentVariable;
+    NumericTablePtr testData, testGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    decision_forest::classification::ModelPtr defaultModel = trainModel<training::defaultDense>(trainData, trainDependentVariable);
+    decision_forest::classification::ModelPtr histModel    = trainModel<training::hist>(trainData, trainDependentVariable);
+
+    const double defaultError = testModel(defaultModel, testData, testGroundTruth);
+    const double histError    = testModel(histModel, testData, testGroundTruth);
+
+    cout << "Test error of the default method:   " << defaultError << endl;
+    cout << "Test error of the histogram method: " << histError << " (" << maxBins << " bins at most)" << endl;
+
+    if (histError > defaultError + maxErrorDifference)
+    {
+        cout << "The histogram method is less accurate than expected" << endl;
+        return -1;
+    }
+    return 0;
+}
+
+template <training::Method method>
+decision_forest::classification::ModelPtr trainModel(const NumericTablePtr& trainData, const NumericTablePtr& trainDependentVariable)
+{
+    /* Create an algorithm object to train the decision forest classification model */
+    training::Batch<float, method> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainDependentVariable);
+    setParameters(algorithm.parameter);
+
+    /* Build the decision forest classification model */
+    checkStatus(algorithm.computeNoThrow());
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+void setParameters(training::Parameter& parameter)
+{
+    parameter.nTrees = nTrees;
+    parameter.featuresPerNode = nFeatures;
+    parameter.minObservationsInLeafNode = minObservationsInLeafNode;
+}
+
+void setParameters(training::HistParameter& parameter)
+{
+    setParameters(static_cast<training::Parameter&>(parameter));
+
+    /* Continuous features are bucketed to at most maxBins bins once for all trees */
+    parameter.maxBins = maxBins;
+    parameter.minBinSize = minBinSize;
+}
+
+double testModel(const decision_forest::classification::ModelPtr& model, const NumericTablePtr& testData, const NumericTablePtr& testGroundTruth)
+{
+    /* Create an algorithm object to predict values of decision forest classification */
+    prediction::Batch<> algorithm(nClasses);
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, model);
+
+    /* Predict values of decision forest classification */
+    checkStatus(algorithm.computeNoThrow());
+    NumericTablePtr prediction = algorithm.getResult()->get(classifier::prediction::prediction);
+
+    /* Compute the classification error */
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<> predictionBlock, groundTruthBlock;
+    prediction->getBlockOfRows(0, nRows, readOnly, predictionBlock);
+    testGroundTruth->getBlockOfRows(0, nRows, readOnly, groundTruthBlock);
+    size_t nErrors = 0;
+    for (size_t i = 0; i < nRows; i++)
+        nErrors += (predictionBlock.getBlockPtr()[i] != groundTruthBlock.getBlockPtr()[i]);
+    prediction->releaseBlockOfRows(predictionBlock);
+    testGroundTruth->releaseBlockOfRows(groundTruthBlock);
+
+    return double(nErrors) / double(nRows);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for(size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
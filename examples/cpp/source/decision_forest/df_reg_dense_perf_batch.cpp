@@ -0,0 +1,142 @@
+/* file: df_reg_dense_perf_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the performance of decision forest regression prediction
+!    in the batch processing mode.
+!
+!    The program generates a data set, trains the decision forest regression model and reports
+!    the number of rows predicted per second for several sizes of the test data. The first
+!    prediction with a model builds the prediction-oriented copy of its trees, the following ones
+!    reuse it. The same measurement is done for the data with a categorical feature, the trees
+!    are traversed in their original layout then.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_REG_DENSE_PERF_BATCH"></a>
+ * \example df_reg_dense_perf_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Data set parameters */
+const size_t nFeatures          = 20;
+const size_t nTrainObservations = 20000;
+
+/* Numbers of rows of the test data to measure */
+const size_t testSizes[] = { 100, 10000, 100000 };
+
+/* Decision forest parameters */
+const size_t nTrees = 100;
+
+/* Number of the repeated predictions */
+const size_t nRepeats = 5;
+
+void generateData(size_t nRows, bool withCategorical, NumericTablePtr& data, NumericTablePtr& response);
+training::ResultPtr trainModel(bool withCategorical);
+void measurePrediction(const ModelPtr& model, bool withCategorical);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    printf("%12s %10s %24s %24s\n", "categorical", "rows", "first call, rows per s", "next calls, rows per s");
+    for (size_t c = 0; c < 2; c++)
+    {
+        const bool withCategorical = (c == 1);
+        training::ResultPtr trainingResult = trainModel(withCategorical);
+        measurePrediction(trainingResult->get(training::model), withCategorical);
+    }
+
+    return 0;
+}
+
+training::ResultPtr trainModel(bool withCategorical)
+{
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponse;
+    generateData(nTrainObservations, withCategorical, trainData, trainResponse);
+
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainResponse);
+    algorithm.parameter.nTrees = nTrees;
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult();
+}
+
+void measurePrediction(const ModelPtr& model, bool withCategorical)
+{
+    for (size_t t = 0; t < sizeof(testSizes) / sizeof(testSizes[0]); t++)
+    {
+        const size_t nRows = testSizes[t];
+        NumericTablePtr testData;
+        NumericTablePtr testResponse;
+        generateData(nRows, withCategorical, testData, testResponse);
+
+        double firstCall = 0;
+        double nextCalls = 0;
+        for (size_t i = 0; i <= nRepeats; i++)
+        {
+            prediction::Batch<float> algorithm;
+            algorithm.input.set(prediction::data, testData);
+            algorithm.input.set(prediction::model, model);
+
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            checkStatus(algorithm.compute());
+            const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+            const double seconds = std::chrono::duration<double>(finish - start).count();
+            if (i == 0)
+                firstCall = seconds;
+            else
+                nextCalls += seconds;
+        }
+
+        printf("%12s %10lu %24.0f %24.0f\n", (withCategorical ? "yes" : "no"), (unsigned long)nRows,
+               nRows / firstCall, nRows * nRepeats / nextCalls);
+    }
+}
+
+/* The response is a non-linear function of the first features. The data with a categorical feature
+   get an additional column of the values from 0 to 3 that doesn't affect the response */
+void generateData(size_t nRows, bool withCategorical, NumericTablePtr& data, NumericTablePtr& response)
+{
+    generateRandomData<float>(nFeatures + (withCategorical ? 1 : 0), nRows, [withCategorical](float *row)
+    {
+        if (withCategorical)
+            row[nFeatures] = (float)(rand() % 4);
+        return row[0] * row[1] + (row[2] > 0.5f ? row[3] : -row[4]) + 0.1f * row[5];
+    }, data, response);
+
+    if (withCategorical)
+    {
+        NumericTableDictionaryPtr pDictionary = data->getDictionarySharedPtr();
+        (*pDictionary)[nFeatures].featureType = data_feature_utils::DAAL_CATEGORICAL;
+    }
+}
@@ -0,0 +1,143 @@
+/* file: dt_reg_levelwise_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the level-by-level construction of decision tree regression
+!    in the batch processing mode.
+!
+!    The tree is built level by level on the presorted features when the number of features
+!    is not less than the number of threads, and depth-first otherwise. The program trains
+!    the model on the generated data with one thread, which selects the level-by-level
+!    construction, and with more threads than features, which selects the depth-first one.
+!    It reports the training time of both and checks that both models predict the same values.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DT_REG_LEVELWISE_BATCH"></a>
+ * \example dt_reg_levelwise_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::decision_tree::regression;
+
+/* Data set parameters */
+const size_t nFeatures          = 8;
+const size_t nTrainObservations = 50000;
+const size_t nTestObservations  = 10000;
+
+/* Decision tree parameters */
+const size_t maxTreeDepth = 12;
+
+float computeResponse(float *row);
+ModelPtr trainModel(size_t nThreads, const NumericTablePtr& data, const NumericTablePtr& response);
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponse;
+    generateRandomData<float>(nFeatures, nTrainObservations, computeResponse, trainData, trainResponse);
+
+    NumericTablePtr testData;
+    NumericTablePtr testResponse;
+    generateRandomData<float>(nFeatures, nTestObservations, computeResponse, testData, testResponse);
+
+    const size_t defaultNumberOfThreads = services::Environment::getInstance()->getNumberOfThreads();
+
+    /* One thread: the number of features is not less than the number of threads */
+    ModelPtr levelwiseModel = trainModel(1, trainData, trainResponse);
+
+    /* More threads than features */
+    ModelPtr depthFirstModel = trainModel(nFeatures + 1, trainData, trainResponse);
+
+    services::Environment::getInstance()->setNumberOfThreads(defaultNumberOfThreads);
+
+    NumericTablePtr levelwisePrediction = predict(levelwiseModel, testData);
+    NumericTablePtr depthFirstPrediction = predict(depthFirstModel, testData);
+
+    BlockDescriptor<float> levelwiseBlock;
+    BlockDescriptor<float> depthFirstBlock;
+    levelwisePrediction->getBlockOfRows(0, nTestObservations, readOnly, levelwiseBlock);
+    depthFirstPrediction->getBlockOfRows(0, nTestObservations, readOnly, depthFirstBlock);
+    const float *levelwise = levelwiseBlock.getBlockPtr();
+    const float *depthFirst = depthFirstBlock.getBlockPtr();
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nTestObservations; i++)
+    {
+        if (fabs(levelwise[i] - depthFirst[i]) > 1e-5f * (1.0f + fabs(depthFirst[i])))
+            nMismatches++;
+    }
+    levelwisePrediction->releaseBlockOfRows(levelwiseBlock);
+    depthFirstPrediction->releaseBlockOfRows(depthFirstBlock);
+
+    printf("Number of mismatching predictions: %lu of %lu\n", (unsigned long)nMismatches, (unsigned long)nTestObservations);
+    if (nMismatches != 0)
+    {
+        printf("The level-by-level and depth-first trees differ\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+ModelPtr trainModel(size_t nThreads, const NumericTablePtr& data, const NumericTablePtr& response)
+{
+    services::Environment::getInstance()->setNumberOfThreads(nThreads);
+
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariables, response);
+    algorithm.parameter.pruning = daal::algorithms::decision_tree::none;
+    algorithm.parameter.maxTreeDepth = maxTreeDepth;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    checkStatus(algorithm.compute());
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    printf("Training with %lu threads: %.1f ms\n", (unsigned long)services::Environment::getInstance()->getNumberOfThreads(),
+           std::chrono::duration<double, std::milli>(finish - start).count());
+
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data)
+{
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+/* The response is a non-linear function of the features */
+float computeResponse(float *row)
+{
+    return row[0] * row[1] + (row[2] > 0.5f ? row[3] : -row[4]) + 0.1f * row[5];
+}
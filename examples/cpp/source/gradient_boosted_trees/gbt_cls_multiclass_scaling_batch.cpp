@@ -0,0 +1,101 @@
+/* file: gbt_cls_multiclass_scaling_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the scaling of gradient boosted trees classification
+!    training with the number of classes in the batch processing mode.
+!
+!    Every iteration of multiclass training builds one tree per class. The
+!    program generates data sets with 10 and 100 classes, trains the models
+!    with the same number of iterations and reports the training time per
+!    iteration and per tree. The time per tree stays about the same when the
+!    trees of an iteration are built in parallel and update the loss function
+!    arguments without contention.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_CLS_MULTICLASS_SCALING_BATCH"></a>
+ * \example gbt_cls_multiclass_scaling_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::gbt::classification;
+
+/* Data set parameters */
+const size_t nFeatures     = 20;
+const size_t nObservations = 20000;
+
+/* Numbers of classes to measure */
+const size_t classes[] = { 10, 100 };
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 5;
+const size_t maxTreeDepth  = 4;
+
+void generateData(size_t nClasses, NumericTablePtr& data, NumericTablePtr& labels);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    printf("%8s %8s %20s %16s\n", "classes", "trees", "ms per iteration", "ms per tree");
+    for (size_t c = 0; c < sizeof(classes) / sizeof(classes[0]); c++)
+    {
+        const size_t nClasses = classes[c];
+        NumericTablePtr data;
+        NumericTablePtr labels;
+        generateData(nClasses, data, labels);
+
+        training::Batch<float> algorithm(nClasses);
+        algorithm.input.set(classifier::training::data, data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter().maxIterations = maxIterations;
+        algorithm.parameter().maxTreeDepth = maxTreeDepth;
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        checkStatus(algorithm.compute());
+        const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+        const size_t nTrees = algorithm.getResult()->get(classifier::training::model)->getNumberOfTrees();
+        const double milliseconds = std::chrono::duration<double, std::milli>(finish - start).count();
+        printf("%8lu %8lu %20.1f %16.3f\n", (unsigned long)nClasses, (unsigned long)nTrees,
+               milliseconds * nClasses / nTrees, milliseconds / nTrees);
+    }
+
+    return 0;
+}
+
+/* The class is defined by the interval the weighted sum of the first features falls into */
+void generateData(size_t nClasses, NumericTablePtr& data, NumericTablePtr& labels)
+{
+    generateRandomData<float>(nFeatures, nObservations, [nClasses](float *row)
+    {
+        const float score = (0.5f * row[0] + 0.3f * row[1] + 0.2f * row[2]) * nClasses;
+        const size_t label = size_t(score);
+        return (float)(label < nClasses ? label : nClasses - 1);
+    }, data, labels);
+}
@@ -0,0 +1,151 @@
+/* file: gbt_cls_prediction_session.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the low-latency prediction session of gradient boosted trees classification.
+!
+!    The program trains the gradient boosted trees classification model on a training
+!    datasetFileName and computes classification for the single observations of the test data
+!    with the prediction session.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_CLS_PREDICTION_SESSION"></a>
+ * \example gbt_cls_prediction_session.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::gbt::classification;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_classification_train.csv";
+const string testDatasetFileName  = "../data/batch/df_classification_test.csv";
+const size_t categoricalFeaturesIndices[] = { 2 };
+const size_t nFeatures  = 3;  /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const size_t minObservationsInLeafNode = 8;
+
+const size_t nClasses = 5;  /* Number of classes */
+
+/* Number of test observations passed to the prediction session at once */
+const size_t nRowsInBlock = 1;
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr& res);
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the gradient boosted trees classification model */
+    training::Batch<> algorithm(nClasses);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainDependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().featuresPerNode = nFeatures;
+    algorithm.parameter().minObservationsInLeafNode = minObservationsInLeafNode;
+
+    /* Build the gradient boosted trees classification model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    return trainingResult;
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees classification */
+    prediction::Batch<float> algorithm(nClasses);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Bind the prediction session to the algorithm with the trained model once */
+    classifier::prediction::Session session(algorithm, nFeatures, nRowsInBlock);
+    checkStatus(session.getStatus());
+
+    const size_t nRows = testData->getNumberOfRows();
+    HomogenNumericTable<float> *predictionTable = new HomogenNumericTable<float>(1, nRows, NumericTable::doAllocate);
+    NumericTablePtr predictionResult(predictionTable);
+
+    BlockDescriptor<float> block;
+    testData->getBlockOfRows(0, nRows, readOnly, block);
+    const float *rows = block.getBlockPtr();
+    float *out = predictionTable->getArray();
+
+    /* Predict values of gradient boosted trees classification for the observations one by one */
+    for(size_t i = 0; i < nRows; i += nRowsInBlock)
+    {
+        const size_t n = (nRows - i < nRowsInBlock ? nRows - i : nRowsInBlock);
+        checkStatus(session.predict(rows + i * nFeatures, n, out + i));
+    }
+    testData->releaseBlockOfRows(block);
+
+    printNumericTable(predictionResult, "Gragient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for(size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
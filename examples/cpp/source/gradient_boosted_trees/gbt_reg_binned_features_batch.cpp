@@ -0,0 +1,146 @@
+/* file: gbt_reg_binned_features_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode
+!    with the binned features shared by several trainings.
+!
+!    The program bins the features of a training data set once, trains several
+!    gradient boosted trees regression models with different parameters
+!    concurrently on the binned features and computes regression for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_BINNED_FEATURES_BATCH"></a>
+ * \example gbt_reg_binned_features_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+using namespace daal::algorithms::tree_utils;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures = 13;  /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const size_t maxBins = 256;
+const size_t minBinSize = 5;
+const size_t nConfigurations = 3;
+const size_t maxTreeDepth[nConfigurations] = { 3, 6, 9 };
+
+void testModel(const training::ResultPtr& res, size_t iConfiguration);
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Bin the features of the training data set once for all trainings */
+    BinnedFeaturesPtr binnedFeatures = BinnedFeatures::create<float>(*trainData, maxBins, minBinSize);
+
+    /* Create algorithm objects to train the gradient boosted trees regression models with different parameters */
+    services::Collection<services::SharedPtr<algorithms::Training<batch> > > trainingAlgorithms;
+    services::Collection<services::SharedPtr<training::Batch<> > > trainings;
+    for(size_t i = 0; i < nConfigurations; ++i)
+    {
+        services::SharedPtr<training::Batch<> > algorithm(new training::Batch<>());
+
+        /* Pass a training data set, dependent values and the binned features to the algorithm */
+        algorithm->input.set(training::data, trainData);
+        algorithm->input.set(training::dependentVariable, trainDependentVariable);
+        algorithm->input.set(training::binnedFeatures, binnedFeatures);
+
+        /* The binned features are used by the training with the same binning parameters */
+        algorithm->parameter().splitMethod = algorithms::gbt::training::inexact;
+        algorithm->parameter().maxBins = maxBins;
+        algorithm->parameter().minBinSize = minBinSize;
+        algorithm->parameter().maxIterations = maxIterations;
+        algorithm->parameter().maxTreeDepth = maxTreeDepth[i];
+
+        trainings.push_back(algorithm);
+        trainingAlgorithms.push_back(algorithm);
+    }
+
+    /* Build the gradient boosted trees regression models concurrently */
+    computeConcurrently(trainingAlgorithms);
+
+    for(size_t i = 0; i < nConfigurations; ++i)
+        testModel(trainings[i]->getResult(), i);
+
+    return 0;
+}
+
+void testModel(const training::ResultPtr& trainingResult, size_t iConfiguration)
+{
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    std::cout << "Maximal tree depth: " << maxTreeDepth[iConfiguration] << std::endl;
+    printNumericTable(predictionResult->get(prediction::prediction),
+        "Gragient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for(size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,115 @@
+/* file: gbt_reg_continued_training_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression training continued
+!    from an input model in the batch processing mode.
+!
+!    The program trains the model for some iterations, then continues the
+!    training from it for more iterations and checks that:
+!    - the continued model has the trees of both trainings;
+!    - its first trees give the same predictions as the input model;
+!    - its predictions are close to the ones of the model trained for all
+!      the iterations at once.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_CONTINUED_TRAINING_BATCH"></a>
+ * \example gbt_reg_continued_training_batch.cpp
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nFeatures     = 10;
+const size_t nObservations = 5000;
+
+/* Gradient boosted trees training parameters */
+const size_t firstIterations  = 20; /* Iterations of the input model */
+const size_t secondIterations = 30; /* Iterations added by the continued training */
+
+ModelPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& response, size_t maxIterations, const ModelPtr& inputModel);
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr data;
+    NumericTablePtr response;
+    generateRandomData<float>(nFeatures, nObservations,
+                              [](float *row) { return (float)sin(6.0f * row[0]) + row[1] * row[2] + 0.5f * row[3]; },
+                              data, response);
+
+    ModelPtr inputModel = trainModel(data, response, firstIterations, ModelPtr());
+    ModelPtr continuedModel = trainModel(data, response, secondIterations, inputModel);
+    ModelPtr fullModel = trainModel(data, response, firstIterations + secondIterations, ModelPtr());
+
+    printf("Number of trees: input model %lu, continued model %lu, model trained at once %lu\n",
+           (unsigned long)inputModel->getNumberOfTrees(), (unsigned long)continuedModel->getNumberOfTrees(),
+           (unsigned long)fullModel->getNumberOfTrees());
+    if (continuedModel->getNumberOfTrees() != inputModel->getNumberOfTrees() + secondIterations)
+        printf("Error: the continued model does not have the trees of both trainings\n");
+
+    /* The first trees of the continued model are the trees of the input model */
+    const float inputDifference = maxAbsDifference<float>(predict(continuedModel, data, firstIterations), predict(inputModel, data, 0),
+                                                          nObservations);
+    printf("Max difference of the input model and the first %lu iterations of the continued model: %g\n",
+           (unsigned long)firstIterations, inputDifference);
+    if (inputDifference != 0.0f)
+        printf("Error: the first trees of the continued model differ from the input model\n");
+
+    /* The continued training fits the same residuals as the training of all the iterations at once,
+       the predictions differ by the rounding of the accumulated responses only */
+    printf("Max difference of the continued model and the model trained at once: %g\n",
+           maxAbsDifference<float>(predict(continuedModel, data, 0), predict(fullModel, data, 0), nObservations));
+
+    return 0;
+}
+
+ModelPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& response, size_t maxIterations, const ModelPtr& inputModel)
+{
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, response);
+    if (inputModel)
+        algorithm.input.set(training::inputModel, inputModel);
+    algorithm.parameter().maxIterations = maxIterations;
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations)
+{
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+    algorithm.parameter().nIterations = nIterations;
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(prediction::prediction);
+}
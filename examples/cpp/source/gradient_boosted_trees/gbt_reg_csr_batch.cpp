@@ -0,0 +1,152 @@
+/* file: gbt_reg_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with the training data
+!    in the compressed sparse row (CSR) format in the batch processing mode.
+!
+!    The program generates a sparse data set, stores it both in a CSR numeric
+!    table and in a dense numeric table and trains the models with the inexact
+!    split method on each of them. The histograms of the sparse data are
+!    computed over its nonzero values. The program reports the training time
+!    and checks that both models give the same predictions.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_CSR_BATCH"></a>
+ * \example gbt_reg_csr_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nFeatures     = 200;
+const size_t nObservations = 20000;
+const float density        = 0.05f; /* Fraction of the nonzero values */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 20;
+
+void generateData(NumericTablePtr& sparseData, NumericTablePtr& denseData, NumericTablePtr& response);
+ModelPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& response, double& milliseconds);
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr sparseData;
+    NumericTablePtr denseData;
+    NumericTablePtr response;
+    generateData(sparseData, denseData, response);
+
+    double sparseTime = 0;
+    double denseTime = 0;
+    ModelPtr sparseModel = trainModel(sparseData, response, sparseTime);
+    ModelPtr denseModel = trainModel(denseData, response, denseTime);
+
+    /* Compare the predictions of the models */
+    const float maxDifference = maxAbsDifference<float>(predict(sparseModel, denseData), predict(denseModel, denseData), nObservations);
+
+    printf("Training time, ms: CSR data %.1f, dense data %.1f\n", sparseTime, denseTime);
+    printf("Max difference of the predictions of the models: %g\n", maxDifference);
+
+    return 0;
+}
+
+ModelPtr trainModel(const NumericTablePtr& data, const NumericTablePtr& response, double& milliseconds)
+{
+    training::Batch<float> algorithm;
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, response);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().splitMethod = daal::algorithms::gbt::training::inexact;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    checkStatus(algorithm.compute());
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+    milliseconds = std::chrono::duration<double, std::milli>(finish - start).count();
+
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data)
+{
+    prediction::Batch<float> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+/* Each value is nonzero with the probability 'density', the response depends on the first features */
+void generateData(NumericTablePtr& sparseData, NumericTablePtr& denseData, NumericTablePtr& response)
+{
+    std::vector<float> values;
+    std::vector<size_t> colIndices;
+    services::SharedPtr<size_t> rowOffsets((size_t *)daal::services::daal_malloc((nObservations + 1) * sizeof(size_t)),
+                                           services::ServiceDeleter());
+
+    denseData = HomogenNumericTable<float>::create(nFeatures, nObservations, NumericTable::doAllocate, 0.0f);
+    response = HomogenNumericTable<float>::create(1, nObservations, NumericTable::doAllocate);
+    BlockDescriptor<float> denseBlock;
+    BlockDescriptor<float> responseBlock;
+    denseData->getBlockOfRows(0, nObservations, readWrite, denseBlock);
+    response->getBlockOfRows(0, nObservations, writeOnly, responseBlock);
+    float *x = denseBlock.getBlockPtr();
+    float *y = responseBlock.getBlockPtr();
+
+    rowOffsets.get()[0] = 1;
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        float *row = x + i * nFeatures;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if ((float)rand() / RAND_MAX < density)
+            {
+                row[j] = (float)rand() / RAND_MAX;
+                values.push_back(row[j]);
+                colIndices.push_back(j + 1);
+            }
+        }
+        rowOffsets.get()[i + 1] = values.size() + 1;
+        y[i] = row[0] + 2.0f * row[1] - row[2] + (row[3] > 0.5f ? 1.0f : 0.0f);
+    }
+    denseData->releaseBlockOfRows(denseBlock);
+    response->releaseBlockOfRows(responseBlock);
+
+    const size_t nNonZeros = values.size();
+    services::SharedPtr<float> csrValues((float *)daal::services::daal_malloc(nNonZeros * sizeof(float)), services::ServiceDeleter());
+    services::SharedPtr<size_t> csrColIndices((size_t *)daal::services::daal_malloc(nNonZeros * sizeof(size_t)), services::ServiceDeleter());
+    for (size_t i = 0; i < nNonZeros; i++)
+    {
+        csrValues.get()[i] = values[i];
+        csrColIndices.get()[i] = colIndices[i];
+    }
+    sparseData = CSRNumericTable::create(csrValues, csrColIndices, rowOffsets, nFeatures, nObservations);
+}
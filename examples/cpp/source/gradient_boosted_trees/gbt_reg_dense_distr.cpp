@@ -0,0 +1,160 @@
+/* file: gbt_reg_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the distributed processing mode.
+!
+!    The program trains the gradient boosted trees regression model on the blocks
+!    of a training data set processed by the local nodes and computes regression
+!    for the test data. The local and master nodes are emulated in one process.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_DISTR"></a>
+ * \example gbt_reg_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures = 13;  /* Number of features in training and testing data sets */
+const size_t nBlocks   = 4;   /* Number of local nodes */
+const size_t nRowsInBlock = 95;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr& res);
+void loadData(FileDataSource<CSVFeatureManager>& dataSource, size_t nRows, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm object to build the trees on the master node */
+    training::Distributed<step2Master> masterAlgorithm;
+    masterAlgorithm.parameter.maxIterations = maxIterations;
+
+    /* Create algorithm objects to compute the histograms on the local nodes */
+    training::Distributed<step1Local> localAlgorithms[nBlocks];
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        NumericTablePtr trainData;
+        NumericTablePtr trainDependentVariable;
+        loadData(trainDataSource, nRowsInBlock, trainData, trainDependentVariable);
+
+        localAlgorithms[i].input.set(training::data, trainData);
+        localAlgorithms[i].input.set(training::dependentVariable, trainDependentVariable);
+        localAlgorithms[i].parameter.maxIterations = maxIterations;
+
+        /* Compute the sketch of the bins of the features on the local node */
+        localAlgorithms[i].compute();
+        masterAlgorithm.input.add(training::partialResults, localAlgorithms[i].getPartialResult());
+    }
+
+    /* Merge the sketches into the bins of the features on the master node */
+    masterAlgorithm.compute();
+
+    while(!masterAlgorithm.getPartialResult()->isFinished())
+    {
+        training::DistributedStep2MasterPartialResultPtr masterResult = masterAlgorithm.getPartialResult();
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            /* Compute the histograms of the open nodes of the tree on the local node */
+            localAlgorithms[i].input.set(training::binBorders, masterResult->get(training::globalBinBorders));
+            localAlgorithms[i].input.set(training::tree, masterResult->get(training::currentTree));
+            localAlgorithms[i].compute();
+
+            /* Keep the binned data of the local node for the next iterations */
+            localAlgorithms[i].input.set(training::internalInput, localAlgorithms[i].getPartialResult()->get(training::internalResult));
+            masterAlgorithm.input.add(training::partialResults, localAlgorithms[i].getPartialResult());
+        }
+
+        /* Choose the splits of the open nodes on the master node */
+        masterAlgorithm.compute();
+    }
+
+    /* Build the gradient boosted trees regression model */
+    masterAlgorithm.finalizeCompute();
+
+    /* Retrieve the algorithm results */
+    return masterAlgorithm.getResult();
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDataSource, 0, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction),
+        "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(FileDataSource<CSVFeatureManager>& dataSource, size_t nRows, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the next block of the data from input file, all the data if nRows is zero */
+    if(nRows)
+        dataSource.loadDataBlock(nRows, mergedData.get());
+    else
+        dataSource.loadDataBlock(mergedData.get());
+}
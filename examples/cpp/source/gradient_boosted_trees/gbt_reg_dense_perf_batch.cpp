@@ -0,0 +1,141 @@
+/* file: gbt_reg_dense_perf_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the performance of gradient boosted trees regression prediction
+!    in the batch processing mode.
+!
+!    The program generates a data set, trains the gradient boosted trees regression model
+!    and predicts the test data with several numbers of iterations of the model. Ensembles
+!    of 1024 trees and more of depth up to 6 are scored by the QuickScorer algorithm,
+!    the smaller ones by the traversal of the trees. The program reports the prediction
+!    time per row and per tree and compares QuickScorer predictions with the ones
+!    for a few rows, which are computed by the traversal of the trees.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_PERF_BATCH"></a>
+ * \example gbt_reg_dense_perf_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nFeatures          = 20;
+const size_t nTrainObservations = 10000;
+const size_t nTestObservations  = 20000;
+const size_t nSmallTestObservations = 32; /* Predicted by the traversal of the trees */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 2048;
+const size_t maxTreeDepth  = 6;
+
+/* Numbers of iterations of the model used for prediction */
+const size_t iterationsToUse[] = { 512, 1023, 1024, 2048 };
+
+/* Number of the repeated predictions */
+const size_t nRepeats = 3;
+
+float computeResponse(float *row);
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations, double& seconds);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponse;
+    generateRandomData<float>(nFeatures, nTrainObservations, computeResponse, trainData, trainResponse);
+
+    NumericTablePtr testData;
+    NumericTablePtr testResponse;
+    generateRandomData<float>(nFeatures, nTestObservations, computeResponse, testData, testResponse);
+
+    training::Batch<float> training;
+    training.input.set(training::data, trainData);
+    training.input.set(training::dependentVariable, trainResponse);
+    training.parameter().maxIterations = maxIterations;
+    training.parameter().maxTreeDepth = maxTreeDepth;
+    checkStatus(training.compute());
+    ModelPtr model = training.getResult()->get(training::model);
+
+    printf("%10s %20s\n", "trees", "ns per row per tree");
+    NumericTablePtr predictions;
+    for (size_t i = 0; i < sizeof(iterationsToUse) / sizeof(iterationsToUse[0]); i++)
+    {
+        const size_t nIterations = iterationsToUse[i];
+        double seconds = 0;
+        predictions = predict(model, testData, nIterations, seconds);
+        printf("%10lu %20.3f\n", (unsigned long)nIterations, seconds * 1e9 / (double(nTestObservations) * nIterations));
+    }
+
+    /* Few rows are predicted by the traversal of the trees, compare it with QuickScorer results for all the trees */
+    NumericTablePtr smallTestData = HomogenNumericTable<float>::create(nFeatures, nSmallTestObservations, NumericTable::doAllocate);
+    BlockDescriptor<float> testBlock;
+    BlockDescriptor<float> smallTestBlock;
+    testData->getBlockOfRows(0, nSmallTestObservations, readOnly, testBlock);
+    smallTestData->getBlockOfRows(0, nSmallTestObservations, writeOnly, smallTestBlock);
+    for (size_t i = 0; i < nFeatures * nSmallTestObservations; i++)
+        smallTestBlock.getBlockPtr()[i] = testBlock.getBlockPtr()[i];
+    testData->releaseBlockOfRows(testBlock);
+    smallTestData->releaseBlockOfRows(smallTestBlock);
+
+    double seconds = 0;
+    NumericTablePtr traversalPredictions = predict(model, smallTestData, maxIterations, seconds);
+    printf("Max difference of QuickScorer and tree traversal predictions: %g\n",
+           maxAbsDifference<float>(predictions, traversalPredictions, nSmallTestObservations));
+
+    return 0;
+}
+
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations, double& seconds)
+{
+    NumericTablePtr predictions;
+    seconds = 0;
+    for (size_t i = 0; i < nRepeats; i++)
+    {
+        prediction::Batch<float> algorithm;
+        algorithm.input.set(prediction::data, data);
+        algorithm.input.set(prediction::model, model);
+        algorithm.parameter().nIterations = nIterations;
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        checkStatus(algorithm.compute());
+        const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+        seconds += std::chrono::duration<double>(finish - start).count();
+        predictions = algorithm.getResult()->get(prediction::prediction);
+    }
+    seconds /= nRepeats;
+    return predictions;
+}
+
+/* The response is a non-linear function of the first features */
+float computeResponse(float *row)
+{
+    return row[0] * row[1] + (row[2] > 0.5f ? row[3] : -row[4]) + 0.1f * row[5];
+}
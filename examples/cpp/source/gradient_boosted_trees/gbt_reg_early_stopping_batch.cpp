@@ -0,0 +1,145 @@
+/* file: gbt_reg_early_stopping_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with early stopping
+!    in the batch processing mode.
+!
+!    The program generates noisy training and validation data sets and trains
+!    two models with the same parameters: one builds all the iterations, the
+!    other one stops when the loss on the validation data has not decreased for
+!    several iterations. The validation error of the first model for every
+!    number of iterations gives the best iteration. The program checks that the
+!    second model stops early and keeps the trees of the best iteration only.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_EARLY_STOPPING_BATCH"></a>
+ * \example gbt_reg_early_stopping_batch.cpp
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nFeatures               = 10;
+const size_t nTrainObservations      = 2000;
+const size_t nValidationObservations = 2000;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations                   = 300;
+const size_t maxIterationsWithoutImprovement = 10;
+const double shrinkage                       = 0.3;
+
+float computeResponse(float *row);
+ModelPtr trainModel(const NumericTablePtr& trainData, const NumericTablePtr& trainResponse,
+                    const NumericTablePtr& validationData, const NumericTablePtr& validationResponse);
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponse;
+    generateRandomData<float>(nFeatures, nTrainObservations, computeResponse, trainData, trainResponse);
+
+    NumericTablePtr validationData;
+    NumericTablePtr validationResponse;
+    generateRandomData<float>(nFeatures, nValidationObservations, computeResponse, validationData, validationResponse);
+
+    /* Train the model with all the iterations and find the iteration with the smallest validation error */
+    ModelPtr fullModel = trainModel(trainData, trainResponse, NumericTablePtr(), NumericTablePtr());
+    const size_t nFullTrees = fullModel->getNumberOfTrees();
+    size_t bestIterations = 0;
+    double bestError = 0;
+    for (size_t i = 1; i <= nFullTrees; i++)
+    {
+        const double error = meanSquaredError<float>(predict(fullModel, validationData, i), validationResponse);
+        if (i == 1 || error < bestError)
+        {
+            bestError = error;
+            bestIterations = i;
+        }
+    }
+
+    /* Train the model with early stopping */
+    ModelPtr model = trainModel(trainData, trainResponse, validationData, validationResponse);
+    const size_t nTrees = model->getNumberOfTrees();
+    const double error = meanSquaredError<float>(predict(model, validationData, 0), validationResponse);
+
+    printf("Number of trees without early stopping: %lu\n", (unsigned long)nFullTrees);
+    printf("Best iteration: %lu, validation MSE: %f\n", (unsigned long)bestIterations, bestError);
+    printf("Number of trees with early stopping: %lu, validation MSE: %f\n", (unsigned long)nTrees, error);
+
+    if (bestIterations + maxIterationsWithoutImprovement < nFullTrees && nTrees >= nFullTrees)
+        printf("Error: the training has not stopped early\n");
+    else if (nTrees != bestIterations)
+        printf("Error: the model does not have the number of trees of the best iteration\n");
+    else
+        printf("The training stopped early, the model has the trees of the best iteration\n");
+
+    return 0;
+}
+
+ModelPtr trainModel(const NumericTablePtr& trainData, const NumericTablePtr& trainResponse,
+                    const NumericTablePtr& validationData, const NumericTablePtr& validationResponse)
+{
+    training::Batch<> algorithm;
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainResponse);
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().shrinkage = shrinkage;
+
+    /* The trees do not depend on the validation data, it is used only to decide when to stop */
+    if (validationData)
+    {
+        algorithm.input.set(training::validationData, validationData);
+        algorithm.input.set(training::validationDependentVariable, validationResponse);
+        algorithm.parameter().maxIterationsWithoutImprovement = maxIterationsWithoutImprovement;
+    }
+
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(training::model);
+}
+
+NumericTablePtr predict(const ModelPtr& model, const NumericTablePtr& data, size_t nIterations)
+{
+    prediction::Batch<> algorithm;
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, model);
+    algorithm.parameter().nIterations = nIterations;
+    checkStatus(algorithm.compute());
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+/* The response is a smooth function of the first features with a strong noise, so that the model
+   starts to fit the noise of the training data after a number of iterations */
+float computeResponse(float *row)
+{
+    const float noise = (float)rand() / RAND_MAX - 0.5f;
+    return (float)sin(6.0f * row[0]) + row[1] * row[2] + noise;
+}
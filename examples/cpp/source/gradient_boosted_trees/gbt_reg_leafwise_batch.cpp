@@ -0,0 +1,139 @@
+/* file: gbt_reg_leafwise_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with the leaf-wise growth
+!    of the trees in the batch processing mode.
+!
+!    The program generates a data set whose response depends on a few features
+!    in a small region much more than elsewhere and trains the models with
+!    the same budget of leaves per tree: with the depth-wise growth limited by
+!    the depth and with the leaf-wise growth limited by the number of leaves.
+!    For each model it reports the number of leaves, the training and
+!    prediction time and the mean squared error on the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_LEAFWISE_BATCH"></a>
+ * \example gbt_reg_leafwise_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Data set parameters */
+const size_t nFeatures          = 10;
+const size_t nTrainObservations = 20000;
+const size_t nTestObservations  = 20000;
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 50;
+
+/* Depths of the depth-wise trees, the leaf-wise trees get 2^depth leaves */
+const size_t depths[] = { 3, 4, 5, 6 };
+
+/* Counts the leaves of the trees */
+class LeafCounter : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    LeafCounter() : nLeaves(0) {}
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor& desc) { ++nLeaves; return true; }
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::SplitNodeDescriptor& desc) { return true; }
+    size_t nLeaves;
+};
+
+float computeResponse(float *row);
+void trainAndTest(size_t maxTreeDepth, size_t maxLeaves, const NumericTablePtr& trainData, const NumericTablePtr& trainResponse,
+                  const NumericTablePtr& testData, const NumericTablePtr& testResponse);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainResponse;
+    generateRandomData<float>(nFeatures, nTrainObservations, computeResponse, trainData, trainResponse);
+
+    NumericTablePtr testData;
+    NumericTablePtr testResponse;
+    generateRandomData<float>(nFeatures, nTestObservations, computeResponse, testData, testResponse);
+
+    printf("%10s %10s %10s %14s %16s %12s\n", "growth", "budget", "leaves", "training, ms", "prediction, ms", "test MSE");
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++)
+    {
+        trainAndTest(depths[i], 0, trainData, trainResponse, testData, testResponse);
+        trainAndTest(0, size_t(1) << depths[i], trainData, trainResponse, testData, testResponse);
+    }
+
+    return 0;
+}
+
+void trainAndTest(size_t maxTreeDepth, size_t maxLeaves, const NumericTablePtr& trainData, const NumericTablePtr& trainResponse,
+                  const NumericTablePtr& testData, const NumericTablePtr& testResponse)
+{
+    /* Train the model */
+    training::Batch<float> training;
+    training.input.set(training::data, trainData);
+    training.input.set(training::dependentVariable, trainResponse);
+    training.parameter().maxIterations = maxIterations;
+    training.parameter().maxTreeDepth = maxTreeDepth;
+    training.parameter().maxLeaves = maxLeaves;
+
+    const std::chrono::steady_clock::time_point trainingStart = std::chrono::steady_clock::now();
+    checkStatus(training.compute());
+    const std::chrono::steady_clock::time_point trainingFinish = std::chrono::steady_clock::now();
+    ModelPtr model = training.getResult()->get(training::model);
+
+    /* Predict the test data */
+    prediction::Batch<float> prediction;
+    prediction.input.set(prediction::data, testData);
+    prediction.input.set(prediction::model, model);
+
+    const std::chrono::steady_clock::time_point predictionStart = std::chrono::steady_clock::now();
+    checkStatus(prediction.compute());
+    const std::chrono::steady_clock::time_point predictionFinish = std::chrono::steady_clock::now();
+
+    /* Count the leaves of the model */
+    LeafCounter counter;
+    for (size_t i = 0; i < model->getNumberOfTrees(); i++)
+        model->traverseDFS(i, counter);
+
+    /* Compute the mean squared error of the predictions */
+    const double mse = meanSquaredError<float>(prediction.getResult()->get(prediction::prediction), testResponse);
+
+    printf("%10s %10lu %10lu %14.1f %16.1f %12.5f\n", (maxLeaves ? "leaf-wise" : "depth-wise"),
+           (unsigned long)(maxLeaves ? maxLeaves : size_t(1) << maxTreeDepth), (unsigned long)counter.nLeaves,
+           std::chrono::duration<double, std::milli>(trainingFinish - trainingStart).count(),
+           std::chrono::duration<double, std::milli>(predictionFinish - predictionStart).count(), mse);
+}
+
+/* The response changes fast in the corner of the first two features and slowly elsewhere, so the trees
+   need many leaves in the corner and few outside of it */
+float computeResponse(float *row)
+{
+    const bool inCorner = (row[0] < 0.2f && row[1] < 0.2f);
+    return 0.1f * row[2] + (inCorner ? float((size_t(row[0] * 40) + size_t(row[1] * 40) + size_t(row[2] * 8)) % 4) : 0.0f);
+}
@@ -0,0 +1,199 @@
+/* file: hnsw_knn_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the approximate k-nearest neighbors search based on the hierarchical navigable small world graph
+!    in the batch processing mode. The example generates clustered high-dimensional data, compares the found neighbors
+!    with the exact ones and reports the recall and the number of queries processed per second for several sizes
+!    of the search candidate list.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-HNSW_KNN_DENSE_BATCH"></a>
+ * \example hnsw_knn_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdlib>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Data set parameters */
+const size_t nFeatures          = 64;
+const size_t nTrainObservations = 50000;
+const size_t nTestObservations  = 1000;
+const size_t nClusters          = 100;
+
+const size_t nNeighbors = 10;
+
+/* Sizes of the list of candidates used on the prediction stage */
+const size_t efSearchValues[] = { 10, 20, 50, 100, 200 };
+
+hnsw_knn::training::ResultPtr trainingResult;
+NumericTablePtr trainData;
+NumericTablePtr testData;
+
+void generateData(const vector<float> &centers, size_t nRows, NumericTablePtr &data);
+void trainModel();
+void computeExactNeighbors(vector<int> &exactIndices);
+void testModel(const vector<int> &exactIndices);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    /* The points are spread around the centers of the clusters */
+    vector<float> centers(nClusters * nFeatures);
+    for (size_t i = 0; i < centers.size(); i++) { centers[i] = 10.0f * rand() / RAND_MAX; }
+
+    generateData(centers, nTrainObservations, trainData);
+    generateData(centers, nTestObservations, testData);
+
+    trainModel();
+
+    vector<int> exactIndices;
+    computeExactNeighbors(exactIndices);
+    testModel(exactIndices);
+
+    return 0;
+}
+
+void generateData(const vector<float> &centers, size_t nRows, NumericTablePtr &data)
+{
+    data = HomogenNumericTable<float>::create(nFeatures, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<float> block;
+    data->getBlockOfRows(0, nRows, writeOnly, block);
+    float *x = block.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const float *center = &centers[(rand() % nClusters) * nFeatures];
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            x[i * nFeatures + j] = center[j] + (float)rand() / RAND_MAX - 0.5f;
+        }
+    }
+    data->releaseBlockOfRows(block);
+}
+
+void trainModel()
+{
+    /* Create an algorithm object to build the graph */
+    hnsw_knn::training::Batch<> algorithm;
+    algorithm.parameter.maxNeighbors   = 16;
+    algorithm.parameter.efConstruction = 200;
+
+    /* Pass the training data set to the algorithm */
+    algorithm.input.set(hnsw_knn::training::data, trainData);
+
+    /* Build the graph */
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    checkStatus(algorithm.compute());
+    const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    std::cout << "Graph of " << trainData->getNumberOfRows() << " points with " << nFeatures << " features is built in " <<
+        std::chrono::duration<double, std::milli>(finish - start).count() << " ms" << std::endl;
+
+    /* Retrieve the results of the training algorithm  */
+    trainingResult = algorithm.getResult();
+}
+
+void computeExactNeighbors(vector<int> &exactIndices)
+{
+    const size_t nTrain = trainData->getNumberOfRows();
+    const size_t nTest  = testData->getNumberOfRows();
+
+    BlockDescriptor<float> trainBlock, testBlock;
+    trainData->getBlockOfRows(0, nTrain, readOnly, trainBlock);
+    testData->getBlockOfRows(0, nTest, readOnly, testBlock);
+    const float *train = trainBlock.getBlockPtr();
+    const float *test  = testBlock.getBlockPtr();
+
+    exactIndices.resize(nTest * nNeighbors);
+    vector<pair<float, int> > distances(nTrain);
+    for (size_t i = 0; i < nTest; i++)
+    {
+        for (size_t j = 0; j < nTrain; j++)
+        {
+            float d = 0;
+            for (size_t f = 0; f < nFeatures; f++)
+            {
+                const float diff = test[i * nFeatures + f] - train[j * nFeatures + f];
+                d += diff * diff;
+            }
+            distances[j] = make_pair(d, (int)j);
+        }
+        partial_sort(distances.begin(), distances.begin() + nNeighbors, distances.end());
+        for (size_t j = 0; j < nNeighbors; j++) { exactIndices[i * nNeighbors + j] = distances[j].second; }
+    }
+
+    trainData->releaseBlockOfRows(trainBlock);
+    testData->releaseBlockOfRows(testBlock);
+}
+
+void testModel(const vector<int> &exactIndices)
+{
+    const size_t nTest = testData->getNumberOfRows();
+
+    std::cout << std::setw(8) << "efSearch" << std::setw(11) << "recall@" << std::left << std::setw(2) << nNeighbors << std::right
+              << std::setw(20) << "queries per second" << std::endl;
+    for (size_t e = 0; e < sizeof(efSearchValues) / sizeof(efSearchValues[0]); e++)
+    {
+        /* Create an algorithm object to search the neighbors of the test points */
+        hnsw_knn::prediction::Batch<> algorithm;
+        algorithm.parameter.k        = nNeighbors;
+        algorithm.parameter.efSearch = efSearchValues[e];
+
+        /* Pass the testing data set and the trained model to the algorithm */
+        algorithm.input.set(hnsw_knn::prediction::data,  testData);
+        algorithm.input.set(hnsw_knn::prediction::model, trainingResult->get(hnsw_knn::training::model));
+
+        /* Search the neighbors */
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        checkStatus(algorithm.compute());
+        const std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(finish - start).count();
+
+        /* Count the exact neighbors among the found ones */
+        NumericTablePtr indices = algorithm.getResult()->get(hnsw_knn::prediction::indices);
+        BlockDescriptor<int> block;
+        indices->getBlockOfRows(0, nTest, readOnly, block);
+        const int *found = block.getBlockPtr();
+        size_t nMatches = 0;
+        for (size_t i = 0; i < nTest; i++)
+        {
+            const int *exact = &exactIndices[i * nNeighbors];
+            for (size_t j = 0; j < nNeighbors; j++)
+            {
+                if (find(exact, exact + nNeighbors, found[i * nNeighbors + j]) != exact + nNeighbors) { nMatches++; }
+            }
+        }
+        indices->releaseBlockOfRows(block);
+
+        std::cout << std::setw(8) << efSearchValues[e] << std::fixed << std::setprecision(4) << std::setw(13)
+                  << (double)nMatches / (nTest * nNeighbors) << std::setprecision(0) << std::setw(20) << nTest / seconds << std::endl;
+    }
+}
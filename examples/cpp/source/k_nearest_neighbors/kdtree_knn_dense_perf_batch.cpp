@@ -0,0 +1,110 @@
+/* file: kdtree_knn_dense_perf_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the performance of k-Nearest Neighbor classification with the K-D tree method
+!    in the batch processing mode.
+!
+!    The program generates uniformly distributed points of various dimensions, trains the kNN model
+!    and reports the training time and the number of queries processed per second for several
+!    numbers of neighbors.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_PERF_BATCH"></a>
+ * \example kdtree_knn_dense_perf_batch.cpp
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Data set parameters */
+const size_t nTrainObservations = 100000;
+const size_t nTestObservations  = 10000;
+const size_t nClasses           = 4;
+
+/* Dimensions of the points and numbers of neighbors to measure */
+const size_t dimensions[] = { 2, 4, 8, 16, 32 };
+const size_t neighbors[]  = { 1, 5, 20 };
+
+NumericTablePtr generateTable(size_t nColumns, size_t nRows, bool isLabels);
+
+int main(int argc, char *argv[])
+{
+    srand(777);
+
+    printf("%10s %4s %14s %18s\n", "dimension", "k", "training, ms", "queries per second");
+    for (size_t d = 0; d < sizeof(dimensions) / sizeof(dimensions[0]); d++)
+    {
+        const size_t nFeatures = dimensions[d];
+        NumericTablePtr trainData   = generateTable(nFeatures, nTrainObservations, false);
+        NumericTablePtr trainLabels = generateTable(1, nTrainObservations, true);
+        NumericTablePtr testData    = generateTable(nFeatures, nTestObservations, false);
+
+        for (size_t n = 0; n < sizeof(neighbors) / sizeof(neighbors[0]); n++)
+        {
+            /* Train the kNN model */
+            kdtree_knn_classification::training::Batch<float> training;
+            training.parameter.k = neighbors[n];
+            training.input.set(classifier::training::data, trainData);
+            training.input.set(classifier::training::labels, trainLabels);
+
+            const std::chrono::steady_clock::time_point trainingStart = std::chrono::steady_clock::now();
+            training.compute();
+            const std::chrono::steady_clock::time_point trainingFinish = std::chrono::steady_clock::now();
+
+            /* Classify the test points */
+            kdtree_knn_classification::prediction::Batch<float> prediction;
+            prediction.parameter.k = neighbors[n];
+            prediction.input.set(classifier::prediction::data, testData);
+            prediction.input.set(classifier::prediction::model, training.getResult()->get(classifier::training::model));
+
+            const std::chrono::steady_clock::time_point predictionStart = std::chrono::steady_clock::now();
+            prediction.compute();
+            const std::chrono::steady_clock::time_point predictionFinish = std::chrono::steady_clock::now();
+
+            printf("%10lu %4lu %14.1f %18.0f\n", (unsigned long)nFeatures, (unsigned long)neighbors[n],
+                   std::chrono::duration<double, std::milli>(trainingFinish - trainingStart).count(),
+                   nTestObservations / std::chrono::duration<double>(predictionFinish - predictionStart).count());
+        }
+    }
+
+    return 0;
+}
+
+NumericTablePtr generateTable(size_t nColumns, size_t nRows, bool isLabels)
+{
+    NumericTablePtr table = HomogenNumericTable<float>::create(nColumns, nRows, NumericTable::doAllocate);
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRows, writeOnly, block);
+    float *values = block.getBlockPtr();
+    for (size_t i = 0; i < nColumns * nRows; i++)
+    {
+        values[i] = (isLabels ? (float)(rand() % nClasses) : (float)rand() / RAND_MAX);
+    }
+    table->releaseBlockOfRows(block);
+    return table;
+}
@@ -0,0 +1,142 @@
+/* file: kdtree_knn_dense_regression_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of k-Nearest Neighbor regression and neighbor search in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_REGRESSION_BATCH"></a>
+ * \example kdtree_knn_dense_regression_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName             = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables, the first one is used as the response */
+const size_t nNeighbors          = 5;  /* Number of nearest neighbors */
+
+kdtree_knn_classification::training::ResultPtr trainingResult;
+kdtree_knn_classification::prediction::ResultPtr predictionResult;
+NumericTablePtr testGroundTruth;
+
+void trainModel();
+void testModel();
+void printResults();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    testModel();
+    printResults();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and responses */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainResponses(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr unusedResponses(new HomogenNumericTable<>(nDependentVariables - 1, 0, NumericTable::doNotAllocate));
+    MergedNumericTablePtr mergedData(new MergedNumericTable(trainData, trainResponses));
+    mergedData->addNumericTable(unusedResponses);
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the KD-tree based kNN model */
+    kdtree_knn_classification::training::Batch<> algorithm;
+
+    /* Pass the training data set and responses to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainResponses);
+
+    /* Train the KD-tree based kNN model */
+    algorithm.compute();
+
+    /* Retrieve the results of the training algorithm  */
+    trainingResult = algorithm.getResult();
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+                                                     DataSource::notAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and responses */
+    NumericTablePtr testData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    testGroundTruth = NumericTablePtr(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr unusedResponses(new HomogenNumericTable<>(nDependentVariables - 1, 0, NumericTable::doNotAllocate));
+    MergedNumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+    mergedData->addNumericTable(unusedResponses);
+
+    /* Retrieve the data from input file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object for KD-tree based kNN prediction with the default method */
+    kdtree_knn_classification::prediction::Batch<> algorithm;
+    algorithm.parameter.k = nNeighbors;
+
+    /* Average the responses of neighbors weighted by the inverse distances, and return the neighbors
+       found by the same search */
+    algorithm.parameter.predictionMode   = kdtree_knn_classification::responseAveraging;
+    algorithm.parameter.voteWeights      = kdtree_knn_classification::voteDistance;
+    algorithm.parameter.resultsToCompute = kdtree_knn_classification::computeIndicesOfNeighbors | kdtree_knn_classification::computeDistances;
+
+    /* Pass the testing data set and trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data,  testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Retrieve algorithm results */
+    predictionResult = algorithm.getResult();
+}
+
+void printResults()
+{
+    printNumericTables<float, float>(testGroundTruth,
+                                     predictionResult->get(classifier::prediction::prediction),
+                                     "Ground truth", "Regression results",
+                                     "KD-tree based kNN regression results (first 10 observations):", 10);
+    printNumericTable(predictionResult->get(kdtree_knn_classification::prediction::indices),
+                      "Indices of the nearest neighbors (first 10 observations):", 10);
+    printNumericTable(predictionResult->get(kdtree_knn_classification::prediction::distances),
+                      "Distances to the nearest neighbors (first 10 observations):", 10);
+}
@@ -0,0 +1,152 @@
+/* file: kdtree_knn_dense_update_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the incremental updates of the KD-tree based k-Nearest Neighbor model in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_UPDATE_BATCH"></a>
+ * \example kdtree_knn_dense_update_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName             = "../data/batch/k_nearest_neighbors_test.csv";
+
+size_t nFeatures = 5;
+const size_t nRemoved = 100; /* Number of the training points removed from the model */
+
+kdtree_knn_classification::ModelPtr model;
+NumericTablePtr testData;
+NumericTablePtr testGroundTruth;
+
+void trainModel();
+void updateModel();
+void testModel(const char * message);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    updateModel();
+    testModel("Nearest neighbors of the inserted points in the updated model (first 10 observations):");
+
+    /* Train the new model on the points of the updated model. The updated model stays usable
+       for the prediction while the new one is trained, so the rebuild can run in the background */
+    if (model->isRebuildRecommended())
+    {
+        model = model->rebuild();
+        testModel("Nearest neighbors of the inserted points in the rebuilt model (first 10 observations):");
+    }
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and labels */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainGroundTruth(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainGroundTruth));
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the KD-tree based kNN model */
+    kdtree_knn_classification::training::Batch<> algorithm;
+
+    /* Recommend the full rebuild of the model after the number of updates reaches a tenth of the training points */
+    algorithm.parameter.rebuildThreshold = 0.1;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainGroundTruth);
+
+    /* Train the KD-tree based kNN model */
+    algorithm.compute();
+
+    /* Retrieve the trained model */
+    model = algorithm.getResult()->get(classifier::training::model);
+}
+
+void updateModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+                                                     DataSource::notAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and labels */
+    testData = NumericTablePtr(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    testGroundTruth = NumericTablePtr(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Retrieve the data from input file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Remove the first training points from the model */
+    services::SharedPtr<HomogenNumericTable<int> > removedIndices = HomogenNumericTable<int>::create(1, nRemoved, NumericTable::doAllocate);
+    int * const indices = removedIndices->getArray();
+    for (size_t i = 0; i < nRemoved; ++i)
+    {
+        indices[i] = (int)i;
+    }
+    checkStatus(model->removePoints(removedIndices));
+
+    /* Insert the testing points into the model, they get the indices that follow the indices of the training points */
+    checkStatus(model->insertPoints(testData, testGroundTruth));
+
+    printf("Ratio of the updates of the model: %.3f\n", model->getUpdateRatio());
+    printf("Full rebuild of the model is recommended: %s\n\n", model->isRebuildRecommended() ? "yes" : "no");
+}
+
+void testModel(const char * message)
+{
+    /* Create an algorithm object for KD-tree based kNN prediction with the default method */
+    kdtree_knn_classification::prediction::Batch<> algorithm;
+    algorithm.parameter.resultsToCompute = kdtree_knn_classification::computeIndicesOfNeighbors | kdtree_knn_classification::computeDistances;
+
+    /* Pass the testing data set and the model to the algorithm */
+    algorithm.input.set(classifier::prediction::data,  testData);
+    algorithm.input.set(classifier::prediction::model, model);
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Every inserted point is the nearest neighbor of itself */
+    kdtree_knn_classification::prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTables<int, int>(predictionResult->get(kdtree_knn_classification::prediction::indices),
+                                 predictionResult->get(classifier::prediction::prediction),
+                                 "Neighbor index", "Predicted label", message, 10);
+    printf("\n");
+}
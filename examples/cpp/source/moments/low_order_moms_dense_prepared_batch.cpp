@@ -0,0 +1,151 @@
+/* file: low_order_moms_dense_prepared_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the repeated computation of moments of low order in the batch
+!    processing mode with the prepared algorithm object
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_PREPARED_BATCH"></a>
+ * \example low_order_moms_dense_prepared_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+const size_t nSelectedFeatures = 5; /* Number of features in the input of the second computation */
+const double tolerance = 1e-6;
+
+NumericTablePtr selectFeatures(const NumericTablePtr &data, size_t nFeatures, size_t firstRow, size_t nRows);
+double computeDifference(const low_order_moments::ResultPtr &result, const NumericTablePtr &data);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Retrieve the input data */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+    dataSource.loadDataBlock();
+    NumericTablePtr data = dataSource.getNumericTable();
+    const size_t nRows = data->getNumberOfRows();
+
+    /* Create an algorithm object that is reused for the sequence of computations */
+    low_order_moments::Batch<> algorithm;
+    algorithm.enablePreparedCompute(true);
+
+    /* Input data of the computations. The second input has fewer features than the first one,
+       and the third input has the same dimensions as the second one */
+    NumericTablePtr inputs[] =
+    {
+        data,
+        selectFeatures(data, nSelectedFeatures, 0, nRows / 2),
+        selectFeatures(data, nSelectedFeatures, nRows / 2, nRows / 2)
+    };
+    const char *descriptions[] =
+    {
+        "all features",
+        "fewer features, the result is reallocated",
+        "same dimensions, the result is reused"
+    };
+
+    int status = 0;
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+    {
+        algorithm.input.set(low_order_moments::data, inputs[i]);
+        algorithm.compute();
+
+        low_order_moments::ResultPtr res = algorithm.getResult();
+        const size_t nFeatures = res->get(low_order_moments::mean)->getNumberOfColumns();
+
+        /* Compare with the results of the algorithm object created for this input */
+        const double diff = computeDifference(res, inputs[i]);
+        const bool passed = (nFeatures == inputs[i]->getNumberOfColumns() && diff < tolerance);
+        if (!passed) status = -1;
+
+        std::cout << "Computation " << i + 1 << " (" << descriptions[i] << "): "
+                  << nFeatures << " features, maximal difference " << diff
+                  << (passed ? " - PASSED" : " - FAILED") << std::endl;
+    }
+    return status;
+}
+
+NumericTablePtr selectFeatures(const NumericTablePtr &data, size_t nFeatures, size_t firstRow, size_t nRows)
+{
+    const size_t nCols = data->getNumberOfColumns();
+    NumericTablePtr selected(new HomogenNumericTable<>(nFeatures, nRows, NumericTable::doAllocate));
+
+    BlockDescriptor<> srcBlock, dstBlock;
+    data->getBlockOfRows(firstRow, nRows, readOnly, srcBlock);
+    selected->getBlockOfRows(0, nRows, writeOnly, dstBlock);
+    const float *src = srcBlock.getBlockPtr();
+    float *dst = dstBlock.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+        for (size_t j = 0; j < nFeatures; j++)
+            dst[i * nFeatures + j] = src[i * nCols + j];
+    selected->releaseBlockOfRows(dstBlock);
+    data->releaseBlockOfRows(srcBlock);
+    return selected;
+}
+
+double computeDifference(const low_order_moments::ResultPtr &result, const NumericTablePtr &data)
+{
+    low_order_moments::Batch<> reference;
+    reference.input.set(low_order_moments::data, data);
+    reference.compute();
+    low_order_moments::ResultPtr referenceResult = reference.getResult();
+
+    const low_order_moments::ResultId ids[] =
+    {
+        low_order_moments::minimum, low_order_moments::maximum, low_order_moments::sum,
+        low_order_moments::mean, low_order_moments::variance
+    };
+
+    double diff = 0.0;
+    for (size_t k = 0; k < sizeof(ids) / sizeof(ids[0]); k++)
+    {
+        NumericTablePtr value    = result->get(ids[k]);
+        NumericTablePtr expected = referenceResult->get(ids[k]);
+        const size_t n = expected->getNumberOfColumns();
+        if (value->getNumberOfColumns() != n) return 1.0;
+
+        BlockDescriptor<> valueBlock, expectedBlock;
+        value->getBlockOfRows(0, 1, readOnly, valueBlock);
+        expected->getBlockOfRows(0, 1, readOnly, expectedBlock);
+        for (size_t j = 0; j < n; j++)
+        {
+            const double d = std::abs((double)valueBlock.getBlockPtr()[j] - (double)expectedBlock.getBlockPtr()[j]);
+            const double scale = std::max(1.0, std::abs((double)expectedBlock.getBlockPtr()[j]));
+            diff = std::max(diff, d / scale);
+        }
+        value->releaseBlockOfRows(valueBlock);
+        expected->releaseBlockOfRows(expectedBlock);
+    }
+    return diff;
+}
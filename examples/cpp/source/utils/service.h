@@ -28,6 +28,8 @@
 using namespace daal::data_management;
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <string>
 #include <iostream>
 #include <fstream>
@@ -1010,4 +1012,71 @@ TensorPtr getNextSubtensor(TensorPtr inputTensor, size_t startPos, size_t nEleme
     return subtensorPtr;
 }
 
+/* Creates the data table of nRows x nColumns random values from [0, 1) and the response table.
+   The response of a row is computed by responseFunction(row), it can modify the values of the row */
+template <typename T, typename ResponseFunction>
+void generateRandomData(size_t nColumns, size_t nRows, ResponseFunction responseFunction,
+                        NumericTablePtr &data, NumericTablePtr &response)
+{
+    data = HomogenNumericTable<T>::create(nColumns, nRows, NumericTable::doAllocate);
+    response = HomogenNumericTable<T>::create(1, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<T> dataBlock;
+    BlockDescriptor<T> responseBlock;
+    data->getBlockOfRows(0, nRows, writeOnly, dataBlock);
+    response->getBlockOfRows(0, nRows, writeOnly, responseBlock);
+    T *x = dataBlock.getBlockPtr();
+    T *y = responseBlock.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        T *row = x + i * nColumns;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            row[j] = (T)rand() / RAND_MAX;
+        }
+        y[i] = responseFunction(row);
+    }
+    data->releaseBlockOfRows(dataBlock);
+    response->releaseBlockOfRows(responseBlock);
+}
+
+/* Returns the maximal absolute difference of the first nRows values of the single column tables */
+template <typename T>
+T maxAbsDifference(const NumericTablePtr &a, const NumericTablePtr &b, size_t nRows)
+{
+    BlockDescriptor<T> aBlock;
+    BlockDescriptor<T> bBlock;
+    a->getBlockOfRows(0, nRows, readOnly, aBlock);
+    b->getBlockOfRows(0, nRows, readOnly, bBlock);
+    T diff = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const T d = (T)fabs(aBlock.getBlockPtr()[i] - bBlock.getBlockPtr()[i]);
+        diff = (d > diff ? d : diff);
+    }
+    a->releaseBlockOfRows(aBlock);
+    b->releaseBlockOfRows(bBlock);
+    return diff;
+}
+
+/* Returns the mean squared error of the prediction of the response */
+template <typename T>
+double meanSquaredError(const NumericTablePtr &prediction, const NumericTablePtr &response)
+{
+    const size_t nRows = response->getNumberOfRows();
+    BlockDescriptor<T> predictionBlock;
+    BlockDescriptor<T> responseBlock;
+    prediction->getBlockOfRows(0, nRows, readOnly, predictionBlock);
+    response->getBlockOfRows(0, nRows, readOnly, responseBlock);
+    double sum = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const double d = (double)predictionBlock.getBlockPtr()[i] - (double)responseBlock.getBlockPtr()[i];
+        sum += d * d;
+    }
+    prediction->releaseBlockOfRows(predictionBlock);
+    response->releaseBlockOfRows(responseBlock);
+    return sum / nRows;
+}
+
 #endif
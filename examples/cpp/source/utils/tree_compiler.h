@@ -0,0 +1,298 @@
+/* file: tree_compiler.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Auxiliary classes used in C++ examples to compile tree ensembles into
+!    native code: the trees are read with the model traversal methods, emitted
+!    as C++ source with nested comparisons, built into a shared object by the
+!    system compiler and loaded as a prediction function.
+!******************************************************************************/
+
+#ifndef _TREE_COMPILER_H
+#define _TREE_COMPILER_H
+
+#include "daal.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+namespace tree_compiler
+{
+
+/* Node of a binary tree: for the split node value is the threshold, for the leaf it is the response or the class label */
+struct Node
+{
+    bool isLeaf;
+    size_t featureIndex;
+    double value;
+    size_t left;
+    size_t right;
+};
+
+/* Nodes of a tree, the root is the first one */
+typedef std::vector<Node> Tree;
+
+/* The way predictions of the trees are combined */
+enum Aggregation
+{
+    sum,                /* Sum of the responses (gradient boosted trees regression) */
+    average,            /* Average of the responses (decision forest regression) */
+    binaryLogit,        /* Class 1 if the sum of the responses is not negative, class 0 otherwise (binary gradient boosted trees classification) */
+    sumPerClass,        /* Tree i adds its response to class i % nClasses, the class with the largest sum wins (multiclass gradient boosted trees classification) */
+    majorityVote        /* The label predicted by the most trees wins (decision forest classification) */
+};
+
+/* Prediction function of the generated code: nRows observations of nFeatures values each are read from x, nRows predictions are written to res */
+typedef void (*PredictFunction)(const float* x, size_t nRows, float* res);
+
+inline double leafValue(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor& desc) { return desc.response; }
+inline double leafValue(const daal::algorithms::tree_utils::classification::LeafNodeDescriptor& desc) { return double(desc.label); }
+
+/* Visitor building the tree from the depth-first traversal of the model: a node is the left child of the last node
+   one level above it if that node has no left child yet, and the right child otherwise */
+template <typename LeafNodeDescriptor>
+class TreeBuilder : public daal::algorithms::tree_utils::TreeNodeVisitor<LeafNodeDescriptor>
+{
+public:
+    TreeBuilder(Tree& tree) : _tree(tree) { _tree.clear(); }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::SplitNodeDescriptor& desc)
+    {
+        addNode(desc.level, false, desc.featureIndex, desc.featureValue);
+        return true;
+    }
+
+    virtual bool onLeafNode(const LeafNodeDescriptor& desc)
+    {
+        addNode(desc.level, true, 0, leafValue(desc));
+        return true;
+    }
+
+private:
+    void addNode(size_t level, bool isLeaf, size_t featureIndex, double value)
+    {
+        const Node node = { isLeaf, featureIndex, value, 0, 0 };
+        const size_t iNode = _tree.size();
+        _tree.push_back(node);
+        _lastOnLevel.resize(level + 1);
+        _lastOnLevel[level] = iNode;
+        if(level == 0)
+            return;
+        Node& parent = _tree[_lastOnLevel[level - 1]];
+        if(parent.left == 0)
+            parent.left = iNode;
+        else
+            parent.right = iNode;
+    }
+
+    Tree& _tree;
+    std::vector<size_t> _lastOnLevel;
+};
+
+/* Reads all the trees of the model, LeafNodeDescriptor selects the kind of the visitor the model accepts */
+template <typename LeafNodeDescriptor, typename ModelType>
+std::vector<Tree> readTrees(const ModelType& model)
+{
+    std::vector<Tree> trees(model.getNumberOfTrees());
+    for(size_t i = 0; i < trees.size(); ++i)
+    {
+        TreeBuilder<LeafNodeDescriptor> builder(trees[i]);
+        model.traverseDFS(i, builder);
+    }
+    return trees;
+}
+
+/* Writes the value so that it is read back exactly */
+inline std::string literal(double value)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.17g", value);
+    std::string s(buf);
+    if(s.find_first_of(".eEn") == std::string::npos)
+        s += ".0";
+    return s;
+}
+
+inline void writeNode(std::ostream& os, const Tree& tree, size_t iNode, size_t indent, bool isLabel)
+{
+    const std::string pad(indent * 4, ' ');
+    const Node& node = tree[iNode];
+    if(node.isLeaf)
+    {
+        if(isLabel)
+            os << pad << "return " << size_t(node.value) << ";\n";
+        else
+            os << pad << "return " << literal(node.value) << ";\n";
+        return;
+    }
+    /* The thresholds are compared in double precision as the library does for the thresholds stored in double.
+       The library goes to the right child if the value is greater than the threshold, so the missing (NaN) values go left */
+    os << pad << "if(!(double(x[" << node.featureIndex << "]) > " << literal(node.value) << "))\n" << pad << "{\n";
+    writeNode(os, tree, node.left, indent + 1, isLabel);
+    os << pad << "}\n" << pad << "else\n" << pad << "{\n";
+    writeNode(os, tree, node.right, indent + 1, isLabel);
+    os << pad << "}\n";
+}
+
+/* Generates the source implementing the function 'predict' of the PredictFunction type. Observations are processed
+   in blocks of nRowsInBlock rows, each tree is applied to all the rows of the block before the next one is taken,
+   so that the code of the tree stays in cache and the row loop can be vectorized by the compiler */
+inline std::string generateSource(const std::vector<Tree>& trees, size_t nFeatures, size_t nClasses, Aggregation aggregation,
+    size_t nRowsInBlock = 16)
+{
+    const bool isLabel = (aggregation == majorityVote);
+    std::ostringstream os;
+    os << "#include <cstddef>\n#include <cmath>\n\n";
+    os << "namespace\n{\n";
+    os << "const size_t nFeatures = " << nFeatures << ";\n";
+    os << "const size_t nClasses = " << nClasses << ";\n";
+    os << "const size_t nRowsInBlock = " << nRowsInBlock << ";\n\n";
+    for(size_t i = 0; i < trees.size(); ++i)
+    {
+        os << "#pragma omp declare simd uniform(x) notinbranch\n";
+        os << "inline " << (isLabel ? "size_t" : "double") << " tree" << i << "(const float* x)\n{\n";
+        writeNode(os, trees[i], 0, 1, isLabel);
+        os << "}\n\n";
+    }
+    os << "} // namespace\n\n";
+
+    os << "extern \"C\" void predict(const float* x, size_t nRows, float* res)\n{\n";
+    os << "    for(size_t iStartRow = 0; iStartRow < nRows; iStartRow += nRowsInBlock)\n    {\n";
+    os << "        const size_t n = (iStartRow + nRowsInBlock <= nRows ? nRowsInBlock : nRows - iStartRow);\n";
+    os << "        const float* xBlock = x + iStartRow * nFeatures;\n";
+    if(isLabel)
+        os << "        size_t acc[nRowsInBlock * nClasses] = { 0 };\n";
+    else
+        os << "        float acc[nRowsInBlock * nClasses] = { 0 };\n";
+    for(size_t i = 0; i < trees.size(); ++i)
+    {
+        os << "#pragma omp simd\n";
+        os << "        for(size_t i = 0; i < n; ++i)\n";
+        if(isLabel)
+            os << "            ++acc[i * nClasses + tree" << i << "(xBlock + i * nFeatures)];\n";
+        else
+            os << "            acc[i * nClasses + " << (aggregation == sumPerClass ? i % nClasses : 0) << "] += float(tree"
+               << i << "(xBlock + i * nFeatures));\n";
+    }
+    os << "        for(size_t i = 0; i < n; ++i)\n        {\n";
+    switch(aggregation)
+    {
+    case sum:
+        os << "            res[iStartRow + i] = acc[i * nClasses];\n";
+        break;
+    case average:
+        os << "            res[iStartRow + i] = acc[i * nClasses] / " << trees.size() << ".0f;\n";
+        break;
+    case binaryLogit:
+        os << "            res[iStartRow + i] = std::signbit(acc[i * nClasses]) ? 0.0f : 1.0f;\n";
+        break;
+    case sumPerClass:
+    case majorityVote:
+        os << "            size_t maxClass = 0;\n";
+        os << "            for(size_t j = 1; j < nClasses; ++j)\n";
+        os << "                if(acc[i * nClasses + j] > acc[i * nClasses + maxClass])\n";
+        os << "                    maxClass = j;\n";
+        os << "            res[iStartRow + i] = float(maxClass);\n";
+        break;
+    }
+    os << "        }\n    }\n}\n";
+    return os.str();
+}
+
+/* Shared object built from the generated source */
+class CompiledModel
+{
+public:
+    CompiledModel() : _handle(NULL), _predict(NULL) {}
+    ~CompiledModel() { unload(); }
+
+    /* Writes the source to <path>.cpp, compiles it into <path>.so with the compiler from the CXX environment variable
+       (c++ by default) and loads it. Returns false and prints the reason if any step fails */
+    bool build(const std::string& source, const std::string& path)
+    {
+#if defined(_WIN32)
+        std::cout << "Loading of the compiled model is not supported on this platform" << std::endl;
+        return false;
+#else
+        unload();
+        const std::string sourceFileName = path + ".cpp";
+        const std::string libraryFileName = path + ".so";
+        {
+            std::ofstream file(sourceFileName.c_str());
+            file << source;
+            if(!file.good())
+            {
+                std::cout << "Failed to write " << sourceFileName << std::endl;
+                return false;
+            }
+        }
+        const char* cxx = getenv("CXX");
+        const std::string command = std::string(cxx ? cxx : "c++") +
+            " -O2 -march=native -fopenmp-simd -shared -fPIC -o " + libraryFileName + " " + sourceFileName;
+        if(system(command.c_str()) != 0)
+        {
+            std::cout << "Failed to compile the model: " << command << std::endl;
+            return false;
+        }
+        _handle = dlopen(libraryFileName.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if(!_handle)
+        {
+            std::cout << "Failed to load " << libraryFileName << ": " << dlerror() << std::endl;
+            return false;
+        }
+        _predict = (PredictFunction)dlsym(_handle, "predict");
+        if(!_predict)
+        {
+            std::cout << "Function 'predict' not found in " << libraryFileName << std::endl;
+            unload();
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    void predict(const float* x, size_t nRows, float* res) const { _predict(x, nRows, res); }
+
+private:
+    void unload()
+    {
+#if !defined(_WIN32)
+        if(_handle)
+            dlclose(_handle);
+#endif
+        _handle = NULL;
+        _predict = NULL;
+    }
+
+    void* _handle;
+    PredictFunction _predict;
+};
+
+} // namespace tree_compiler
+
+#endif
@@ -316,6 +316,19 @@ public:
         resetFlag = flag;
     }
 
+    /**
+     * Enables or disables the prepared computation mode.
+     * In this mode the algorithm object is reused for a sequence of compute() calls:
+     * the computation environment is kept between the calls, and while the input numeric tables
+     * keep the dimensions of the previous call, the result is not reallocated.
+     * If the dimensions of the inputs change, the result is reallocated for the new inputs
+     * unless it already fits them.
+     * Inputs and results are validated on every call unless the checks are disabled.
+     * Parameters of the algorithm should not be modified while the mode is enabled.
+     * \param[in] flag True to enable the prepared computation mode, false to disable it
+     */
+    void enablePreparedCompute(bool flag);
+
     /**
     * Returns HostAppIface used by the class
     * \return HostAppIface used by the class
@@ -0,0 +1,80 @@
+/* file: classifier_predict_session.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low-latency prediction session of the classification algorithms.
+//--
+*/
+
+#ifndef __CLASSIFIER_PREDICT_SESSION_H__
+#define __CLASSIFIER_PREDICT_SESSION_H__
+
+#include "algorithms/prediction_session.h"
+#include "algorithms/classifier/classifier_predict.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace prediction
+{
+namespace interface2
+{
+/**
+ * @ingroup classifier
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__PREDICTION__SESSION"></a>
+ * \brief Computes the class labels for small blocks of observations with low latency.
+ *        Supports the prediction algorithms derived from \ref classifier::prediction::interface2::Batch "classifier::prediction::Batch",
+ *        for example, gradient boosted trees, decision forest, logistic regression, SVM, naive Bayes and k-nearest neighbors
+ *
+ * \par References
+ *      - \ref classifier::prediction::interface2::Batch "classifier::prediction::Batch" class
+ */
+class DAAL_EXPORT Session : public algorithms::PredictionSession
+{
+public:
+    /**
+     * Constructs the prediction session
+     * \param[in] algorithm Prediction algorithm with the trained model set to its input.
+     *                      The session works with the copy of the algorithm, which computes the class labels only
+     * \param[in] nFeatures Number of features in the observations
+     * \param[in] maxRows   Maximal number of observations processed by one call of the algorithm
+     */
+    Session(const Batch &algorithm, size_t nFeatures, size_t maxRows = 32);
+
+    virtual ~Session() {}
+
+protected:
+    services::Status bind(const data_management::NumericTablePtr &data, const data_management::NumericTablePtr &prediction) DAAL_C11_OVERRIDE;
+
+    services::SharedPtr<Batch> _algorithm;
+};
+/** @} */
+} // namespace interface2
+using interface2::Session;
+
+} // namespace prediction
+} // namespace classifier
+} // namespace algorithms
+} // namespace daal
+#endif
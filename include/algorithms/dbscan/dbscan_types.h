@@ -53,6 +53,9 @@ const int undefined = -2;
 enum Method
 {
     defaultDense = 0,   /*!< Default: performance-oriented method */
+    gridDense    = 1    /*!< Neighborhoods of observations are found with a uniform grid of cells of size epsilon built over
+                             the data set. Intended for the data sets with a few features, the data sets with more than
+                             4 features are processed as in the default method. The results are the same as of the default method */
 };
 
 /**
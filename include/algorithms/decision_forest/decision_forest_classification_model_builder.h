@@ -131,6 +131,27 @@ public:
         return resId;
     }
 
+    /**
+    *  Create several trees in the decision forest model at once
+    *  Nodes of the trees are stored one after another in the arrays, the root is the first node of a tree
+    *  and indexes of the child nodes are counted from the first node of their tree
+    *  \param[in] nTrees          Number of created trees
+    *  \param[in] treeOffsets     Array of nTrees + 1 elements, the nodes of the i-th tree are in [treeOffsets[i], treeOffsets[i + 1])
+    *  \param[in] featureIndexes  Split node: feature index for spliting, leaf node: -1
+    *  \param[in] leftChildren    Split node: index of the left child, ignored for leaf nodes
+    *  \param[in] rightChildren   Split node: index of the right child, ignored for leaf nodes
+    *  \param[in] values          Split node: feature value for spliting, leaf node: class label to be predicted
+    *  \return Identifier of the first created tree, the created trees have consecutive identifiers
+    */
+    TreeId addTrees(size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+                    const size_t* leftChildren, const size_t* rightChildren, const double* values)
+    {
+        TreeId resId;
+        _status |= addTreesInternal(nTrees, treeOffsets, featureIndexes, leftChildren, rightChildren, values, resId);
+        services::throwIfPossible(_status);
+        return resId;
+    }
+
     /**
     *  Get built model
     *  \return Model pointer
@@ -157,6 +178,8 @@ protected:
     services::Status createTreeInternal(size_t nNodes, TreeId& resId);
     services::Status addLeafNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t classLabel, NodeId& res);
     services::Status addSplitNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t featureIndex, double featureValue, NodeId& res);
+    services::Status addTreesInternal(size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+                                      const size_t* leftChildren, const size_t* rightChildren, const double* values, TreeId& resId);
 };
 /** @} */
 } // namespace interface1
@@ -242,11 +242,12 @@ public:
  * \par Enumerations
  *      - \ref Method                         Decision forest training methods
  *      - \ref classifier::training::InputId  Identifiers of input objects for the Decision forest training algorithm
+ *      - \ref InputModelId                   Identifiers of input models for the Decision forest training algorithm
  *      - \ref classifier::training::ResultId Identifiers of Decision forest training results
  *
  * \par References
  *      - \ref decision_forest::classification::interface1::Model "Model" class
- *      - \ref classifier::training::interface1::Input "classifier::training::Input" class
+ *      - \ref interface1::Input "Input" class
  */
 template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::training::Batch
@@ -254,8 +255,8 @@ class DAAL_EXPORT Batch : public classifier::training::Batch
 public:
     typedef classifier::training::Batch super;
 
-    typedef typename super::InputType                                        InputType;
-    typedef algorithms::decision_forest::classification::training::Parameter ParameterType;
+    typedef algorithms::decision_forest::classification::training::Input     InputType;
+    typedef typename algorithms::decision_forest::classification::training::MethodParameter<method>::Type ParameterType;
     typedef algorithms::decision_forest::classification::training::Result    ResultType;
 
     ParameterType parameter;        /*!< \ref interface1::Parameter "Parameters" of the algorithm */
@@ -28,6 +28,7 @@
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
 #include "algorithms/decision_forest/decision_forest_training_parameter.h"
+#include "algorithms/tree_utils/tree_utils_binned_features.h"
 
 namespace daal
 {
@@ -54,7 +55,32 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0  /*!< Bagging, random choice of features, Gini impurity */
+    defaultDense = 0, /*!< Bagging, random choice of features, Gini impurity */
+    hist         = 1  /*!< Bagging, random choice of features, Gini impurity.
+                           Continuous features are bucketed to discrete bins once for all trees
+                           and splits are found on the bin borders */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__INPUTMODELID"></a>
+ * \brief Available identifiers of input models for decision forest model-based training
+ */
+enum InputModelId
+{
+    inputModel = classifier::training::lastInputId + 1, /*!< Optional model to continue the training from. Its trees are copied
+                                                             to the trained model followed by the newly trained trees */
+    lastInputModelId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__INPUTBINNEDFEATURESID"></a>
+ * \brief Available identifiers of the input binned features for model-based training
+ */
+enum InputBinnedFeaturesId
+{
+    binnedFeatures = lastInputModelId + 1, /*!< Optional binned features of the input data. Used instead of
+                                                binning the data when computed with the parameters of the training */
+    lastInputBinnedFeaturesId = binnedFeatures
 };
 
 /**
@@ -122,10 +148,84 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [Parameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__HISTPARAMETER"></a>
+ * \brief Decision forest algorithm parameters of the 'hist' training method
+ *
+ * \snippet decision_forest/decision_forest_classification_training_types.h HistParameter source code
+ */
+/* [HistParameter source code] */
+struct DAAL_EXPORT HistParameter : public Parameter, public daal::algorithms::decision_forest::training::HistParameter
+{
+    /** Default constructor */
+    HistParameter(size_t nClasses) : Parameter(nClasses) {}
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [HistParameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__METHODPARAMETER"></a>
+ * \brief Type of the parameters of the decision forest training method
+ * \tparam method  Decision forest training method, \ref Method
+ */
+template<Method method> struct MethodParameter       { typedef Parameter     Type; };
+template<>              struct MethodParameter<hist> { typedef HistParameter Type; };
 }
 
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for decision forest model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    Input();
+    Input(const Input& other) : classifier::training::Input(other){}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns an input model for decision forest model-based training
+     * \param[in] id    Identifier of the input model, \ref InputModelId
+     * \return          %Input model that corresponds to the given identifier
+     */
+    decision_forest::classification::ModelPtr get(InputModelId id) const;
+
+    /**
+     * Sets an input model for decision forest model-based training
+     * \param[in] id      Identifier of the input model, \ref InputModelId
+     * \param[in] value   Pointer to the model
+     */
+    void set(InputModelId id, const decision_forest::classification::ModelPtr &value);
+
+    /**
+     * Returns the input binned features for model-based training
+     * \param[in] id    Identifier of the input binned features, \ref InputBinnedFeaturesId
+     * \return          %Input binned features that correspond to the given identifier
+     */
+    tree_utils::BinnedFeaturesPtr get(InputBinnedFeaturesId id) const;
+
+    /**
+     * Sets the input binned features for model-based training
+     * \param[in] id      Identifier of the input binned features, \ref InputBinnedFeaturesId
+     * \param[in] value   Pointer to the binned features
+     */
+    void set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value);
+
+    /**
+     * Checks an input object for the decision forest algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+typedef services::SharedPtr<Input> InputPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method
@@ -215,6 +315,10 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
 using interface2::Parameter;
+using interface2::HistParameter;
+using interface2::MethodParameter;
+using interface1::Input;
+using interface1::InputPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
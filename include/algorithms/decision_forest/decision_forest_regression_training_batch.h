@@ -95,7 +95,7 @@ class DAAL_EXPORT Batch : public algorithms::regression::training::Batch
 {
 public:
     typedef algorithms::decision_forest::regression::training::Input     InputType;
-    typedef algorithms::decision_forest::regression::training::Parameter ParameterType;
+    typedef typename algorithms::decision_forest::regression::training::MethodParameter<method>::Type ParameterType;
     typedef algorithms::decision_forest::regression::training::Result    ResultType;
 
     InputType input;                /*!< %Input data structure */
@@ -31,6 +31,7 @@
 #include "algorithms/decision_forest/decision_forest_regression_model.h"
 #include "algorithms/decision_forest/decision_forest_training_parameter.h"
 #include "algorithms/regression/regression_training_types.h"
+#include "algorithms/tree_utils/tree_utils_binned_features.h"
 
 namespace daal
 {
@@ -60,7 +61,10 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0  /*!< Bagging, random choice of features, variance-based impurity */
+    defaultDense = 0, /*!< Bagging, random choice of features, variance-based impurity */
+    hist         = 1  /*!< Bagging, random choice of features, variance-based impurity.
+                           Continuous features are bucketed to discrete bins once for all trees
+                           and splits are found on the bin borders */
 };
 
 /**
@@ -74,6 +78,28 @@ enum InputId
     lastInputId       = dependentVariable
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__REGRESSION__TRAINING__INPUTMODELID"></a>
+ * \brief Available identifiers of input models for decision forest model-based training
+ */
+enum InputModelId
+{
+    inputModel = lastInputId + 1, /*!< Optional model to continue the training from. Its trees are copied to the trained model
+                                       followed by the newly trained trees */
+    lastInputModelId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__REGRESSION__TRAINING__INPUTBINNEDFEATURESID"></a>
+ * \brief Available identifiers of the input binned features for model-based training
+ */
+enum InputBinnedFeaturesId
+{
+    binnedFeatures = lastInputModelId + 1, /*!< Optional binned features of the input data. Used instead of
+                                                binning the data when computed with the parameters of the training */
+    lastInputBinnedFeaturesId = binnedFeatures
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__DECISION_FOREST__REGRESSION__TRAINING__RESULTID"></a>
  * \brief Available identifiers of the result of decision forest model-based training
@@ -129,6 +155,29 @@ public:
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSION__HISTPARAMETER"></a>
+ * \brief Parameters for the decision forest algorithm trained with the 'hist' method
+ *
+ * \snippet decision_forest/decision_forest_regression_training_types.h HistParameter source code
+ */
+/* [HistParameter source code] */
+class DAAL_EXPORT HistParameter : public Parameter, public daal::algorithms::decision_forest::training::HistParameter
+{
+public:
+    HistParameter();
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [HistParameter source code] */
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__DECISION_FOREST__REGRESSION__TRAINING__METHODPARAMETER"></a>
+ * \brief Type of the parameters of the decision forest training method
+ * \tparam method  Decision forest training method, \ref Method
+ */
+template<Method method> struct MethodParameter       { typedef Parameter     Type; };
+template<>              struct MethodParameter<hist> { typedef HistParameter Type; };
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSSION__TRAINING__INPUT"></a>
  * \brief %Input objects for decision forest model-based training
@@ -158,6 +207,34 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns an input model for decision forest model-based training
+     * \param[in] id    Identifier of the input model
+     * \return          %Input model that corresponds to the given identifier
+     */
+    decision_forest::regression::ModelPtr get(InputModelId id) const;
+
+    /**
+     * Sets an input model for decision forest model-based training
+     * \param[in] id      Identifier of the input model
+     * \param[in] value   Pointer to the model
+     */
+    void set(InputModelId id, const decision_forest::regression::ModelPtr &value);
+
+    /**
+     * Returns the input binned features for model-based training
+     * \param[in] id    Identifier of the input binned features
+     * \return          %Input binned features that correspond to the given identifier
+     */
+    tree_utils::BinnedFeaturesPtr get(InputBinnedFeaturesId id) const;
+
+    /**
+     * Sets the input binned features for model-based training
+     * \param[in] id      Identifier of the input binned features
+     * \param[in] value   Pointer to the binned features
+     */
+    void set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value);
+
     /**
     * Checks an input object for the decision forest algorithm
     * \param[in] par     Algorithm parameter
@@ -255,6 +332,8 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
 using interface1::Parameter;
+using interface1::HistParameter;
+using interface1::MethodParameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -129,8 +129,27 @@ public:
     bool bootstrap;                         /*!< If true then training set for a tree is a bootstrap of the whole training set */
 };
 /* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__TRAINING__HISTPARAMETER"></a>
+ * \brief Parameters of the decision forest algorithm specific to the 'hist' training method
+ *
+ * \snippet decision_forest/decision_forest_training_parameter.h HistParameter source code
+ */
+/* [HistParameter source code] */
+class DAAL_EXPORT HistParameter
+{
+public:
+    HistParameter() : maxBins(256), minBinSize(5) {}
+
+    size_t maxBins;                         /*!< Maximal number of discrete bins to bucket continuous features.
+                                                 Default is 256. Increasing the number results in higher computation costs */
+    size_t minBinSize;                      /*!< Minimal number of observations in a bin. Default is 5 */
+};
+/* [HistParameter source code] */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::HistParameter;
 /** @} */
 } // namespace training
 }
@@ -27,6 +27,7 @@
 #include "algorithms/classifier/classifier_model.h"
 #include "algorithms/regression/tree_traverse.h"
 #include "algorithms/tree_utils/tree_utils_regression.h"
+#include "algorithms/tree_utils/tree_utils_arrays.h"
 
 namespace daal
 {
@@ -123,6 +124,25 @@ public:
      */
     virtual size_t getNumberOfTrees() const = 0;
 
+    /**
+     *  Exports the trees of the model to contiguous arrays, the trees are processed in parallel
+     *  \param[in]  iFirstTree  Index of the first tree to export
+     *  \param[in]  nTrees      Number of trees to export
+     *  \param[out] trees       Arrays of the nodes of the trees, the leaf nodes contain responses
+     *  \return Status of the export
+     */
+    virtual services::Status exportTrees(size_t iFirstTree, size_t nTrees, tree_utils::TreeArrays& trees) const = 0;
+
+    /**
+     *  Exports all the trees of the model to contiguous arrays
+     *  \param[out] trees  Arrays of the nodes of the trees
+     *  \return Status of the export
+     */
+    services::Status exportTrees(tree_utils::TreeArrays& trees) const
+    {
+        return exportTrees(0, getNumberOfTrees(), trees);
+    }
+
 protected:
     Model() : classifier::Model()
     {}
@@ -131,6 +131,28 @@ public:
         return resId;
     }
 
+    /**
+    *  Create several trees in the gradient boosted trees classification model for certain class at once
+    *  Nodes of the trees are stored one after another in the arrays, the root is the first node of a tree
+    *  and indexes of the child nodes are counted from the first node of their tree
+    *  \param[in] classLabel      Label of class for which trees are created. classLabel bellows  interval from 0 to (nClasses - 1)
+    *  \param[in] nTrees          Number of created trees
+    *  \param[in] treeOffsets     Array of nTrees + 1 elements, the nodes of the i-th tree are in [treeOffsets[i], treeOffsets[i + 1])
+    *  \param[in] featureIndexes  Split node: feature index for spliting, leaf node: -1
+    *  \param[in] leftChildren    Split node: index of the left child, ignored for leaf nodes
+    *  \param[in] rightChildren   Split node: index of the right child, ignored for leaf nodes
+    *  \param[in] values          Split node: feature value for spliting, leaf node: response
+    *  \return Identifier of the first created tree, the created trees have consecutive identifiers
+    */
+    TreeId addTrees(size_t classLabel, size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+                    const size_t* leftChildren, const size_t* rightChildren, const double* values)
+    {
+        TreeId resId;
+        _status |= addTreesInternal(classLabel, nTrees, treeOffsets, featureIndexes, leftChildren, rightChildren, values, resId);
+        services::throwIfPossible(_status);
+        return resId;
+    }
+
     /**
     *  Get built model
     *  \return Model pointer
@@ -158,6 +180,8 @@ protected:
     services::Status createTreeInternal(size_t nNodes, size_t classLabel, TreeId& resId);
     services::Status addLeafNodeInternal(TreeId treeId, NodeId parentId, size_t position, double response, NodeId& res);
     services::Status addSplitNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t featureIndex, double featureValue, NodeId& res);
+    services::Status addTreesInternal(size_t classLabel, size_t nTrees, const size_t* treeOffsets, const int* featureIndexes,
+                                      const size_t* leftChildren, const size_t* rightChildren, const double* values, TreeId& resId);
     services::Status convertModelInternal();
     size_t _nClasses;
     size_t _nIterations;
@@ -242,11 +242,12 @@ public:
  * \par Enumerations
  *      - \ref Method                         Gradient Boosted Trees training methods
  *      - \ref classifier::training::InputId  Identifiers of input objects for the Gradient Boosted Trees training algorithm
+ *      - \ref InputId                        Identifiers of optional input objects for the Gradient Boosted Trees training algorithm
  *      - \ref classifier::training::ResultId Identifiers of Gradient Boosted Trees training results
  *
  * \par References
  *      - \ref gbt::classification::interface1::Model "Model" class
- *      - \ref classifier::training::interface1::Input "classifier::training::Input" class
+ *      - \ref interface1::Input "Input" class
  */
 template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::training::Batch
@@ -254,7 +255,7 @@ class DAAL_EXPORT Batch : public classifier::training::Batch
 public:
     typedef classifier::training::Batch super;
 
-    typedef typename super::InputType                            InputType;
+    typedef algorithms::gbt::classification::training::Input     InputType;
     typedef algorithms::gbt::classification::training::Parameter ParameterType;
     typedef algorithms::gbt::classification::training::Result    ResultType;
 
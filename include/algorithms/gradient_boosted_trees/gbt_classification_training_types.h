@@ -28,6 +28,7 @@
 #include "algorithms/classifier/classifier_training_types.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_training_parameter.h"
+#include "algorithms/tree_utils/tree_utils_binned_features.h"
 
 namespace daal
 {
@@ -69,6 +70,39 @@ enum LossFunctionType
     custom        /* custom function type */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUTID"></a>
+ * \brief Available identifiers of optional input objects for model-based training
+ */
+enum InputId
+{
+    validationData   = classifier::training::lastInputId + 1, /*!< Optional validation data table used for early stopping */
+    validationLabels,                                         /*!< Optional labels of the validation data */
+    lastInputId = validationLabels
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUTMODELID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum InputModelId
+{
+    inputModel = lastInputId + 1, /*!< Optional model to continue the training from. Its trees are copied to the trained model
+                                       and the new trees are fitted to the residuals of its predictions */
+    lastInputModelId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUTBINNEDFEATURESID"></a>
+ * \brief Available identifiers of the input binned features for model-based training
+ */
+enum InputBinnedFeaturesId
+{
+    binnedFeatures = lastInputModelId + 1, /*!< Optional binned features of the input data. Used instead of
+                                                binning the data when computed with the parameters of the training */
+    lastInputBinnedFeaturesId = binnedFeatures
+};
+
 enum OptionalResultNumericTableId
 {
     variableImportanceWeight = classifier::training::lastResultId + 1,
@@ -92,7 +126,7 @@ namespace interface1
  * \snippet gradient_boosted_trees/gbt_classification_training_types.h Parameter source code
  */
 /* [interface1::Parameter source code] */
-struct DAAL_EXPORT Parameter : public classifier::interface1::Parameter, public daal::algorithms::gbt::training::Parameter
+struct DAAL_EXPORT Parameter : public classifier::interface1::Parameter, public daal::algorithms::gbt::training::interface1::Parameter
 {
     /** Default constructor */
     DAAL_DEPRECATED Parameter(size_t nClasses) : classifier::interface1::Parameter(nClasses), loss(crossEntropy) {}
@@ -107,6 +141,28 @@ struct DAAL_EXPORT Parameter : public classifier::interface1::Parameter, public
  */
 namespace interface2
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__PARAMETER"></a>
+ * \brief Gradient Boosted Trees algorithm parameters
+ *
+ * \snippet gradient_boosted_trees/gbt_classification_training_types.h interface2::Parameter source code
+ */
+/* [interface2::Parameter source code] */
+struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algorithms::gbt::training::interface1::Parameter
+{
+    /** Default constructor */
+    Parameter(size_t nClasses) : classifier::Parameter(nClasses), loss(crossEntropy) {}
+    services::Status check() const DAAL_C11_OVERRIDE;
+    LossFunctionType loss; /*!< Loss function type */
+};
+/* [interface2::Parameter source code] */
+}
+
+/**
+ * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
 /**
  * <a name="DAAL-STRUCT-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__PARAMETER"></a>
  * \brief Gradient Boosted Trees algorithm parameters
@@ -126,6 +182,71 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    Input();
+    Input(const Input& other) : classifier::training::Input(other){}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns an input object for model-based training
+     * \param[in] id    Identifier of the input object, \ref InputId
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets an input object for model-based training
+     * \param[in] id      Identifier of the input object, \ref InputId
+     * \param[in] value   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id    Identifier of the input model, \ref InputModelId
+     * \return          %Input model that corresponds to the given identifier
+     */
+    gbt::classification::ModelPtr get(InputModelId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id      Identifier of the input model, \ref InputModelId
+     * \param[in] value   Pointer to the model
+     */
+    void set(InputModelId id, const gbt::classification::ModelPtr &value);
+
+    /**
+     * Returns the input binned features for model-based training
+     * \param[in] id    Identifier of the input binned features, \ref InputBinnedFeaturesId
+     * \return          %Input binned features that correspond to the given identifier
+     */
+    tree_utils::BinnedFeaturesPtr get(InputBinnedFeaturesId id) const;
+
+    /**
+     * Sets the input binned features for model-based training
+     * \param[in] id      Identifier of the input binned features, \ref InputBinnedFeaturesId
+     * \param[in] value   Pointer to the binned features
+     */
+    void set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value);
+
+    /**
+     * Checks an input object for the gradient boosted trees algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+typedef services::SharedPtr<Input> InputPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access the result obtained with the compute() method
@@ -197,7 +318,9 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface2::Parameter;
+using interface3::Parameter;
+using interface1::Input;
+using interface1::InputPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
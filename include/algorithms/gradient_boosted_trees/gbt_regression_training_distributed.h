@@ -0,0 +1,398 @@
+/* file: gbt_regression_training_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the gradient boosted trees regression training
+//  algorithm in the distributed processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAINING_DISTRIBUTED_H__
+#define __GBT_REGRESSION_TRAINING_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * @defgroup gbt_regression_training_distributed Distributed
+ * @ingroup gbt_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the gradient boosted trees regression training algorithm
+ *        in the distributed processing mode.
+ *        This class is associated with daal::algorithms::gbt::regression::training::Distributed class
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the gradient boosted trees regression training
+ *        in the first step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step1Local, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the gradient boosted trees regression training with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+    /**
+     * Computes the local sketch of the bins of the features or the histograms of the nodes of the tree
+     * in the first step of the distributed processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing, the result of the training is computed on the master node
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods for the gradient boosted trees regression training
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the gradient boosted trees regression training with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+    /**
+     * Merges the partial results computed on local nodes and grows the tree
+     * in the second step of the distributed processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the gradient boosted trees model from the trees built in the second step of the distributed processing mode
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED"></a>
+ * \brief Trains the gradient boosted trees regression model in the distributed processing mode.
+ *        Only inexact split method is supported: the local nodes compute the sketches of the bins of the features
+ *        and the histograms of gradients for the nodes of the tree, the master node merges them,
+ *        chooses the splits and sends the updated tree back to the local nodes.
+ *        Observations and features sampling is not supported in the distributed processing mode.
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method                                     Gradient boosted trees training methods
+ *      - \ref InputId                                    Identifiers of input objects on local nodes
+ *      - \ref DistributedStep1LocalInputId               Identifiers of input numeric tables on local nodes
+ *      - \ref DistributedLocalInputDataId                Identifiers of input data collections on local nodes
+ *      - \ref DistributedStep1LocalPartialResultId       Identifiers of partial results on local nodes
+ *      - \ref DistributedStep2MasterInputId              Identifiers of input objects on the master node
+ *      - \ref DistributedStep2MasterPartialResultId      Identifiers of partial results on the master node
+ *      - \ref ResultId                                   Identifiers of the results of the training
+ */
+template<ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed : public Training<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the partial results of the gradient boosted trees regression training
+ *        in the first step of the distributed processing mode.
+ *        If binBorders input is not set, the local sketch of the bins of the features is computed.
+ *        Otherwise, the histograms of the open nodes of the tree input are computed.
+ *        internalResult partial result has to be passed as internalInput to the next computation on the same node
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedStep1LocalInput         InputType;
+    typedef algorithms::gbt::regression::training::Parameter                          ParameterType;
+    typedef algorithms::gbt::regression::training::Result                             ResultType;
+    typedef algorithms::gbt::regression::training::DistributedStep1LocalPartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the algorithm by copying input objects and parameters of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store partial results of the algorithm
+     * \param[in] partialResult    Structure to store partial results of the algorithm
+     */
+    services::Status setPartialResult(const DistributedStep1LocalPartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the algorithm
+     * \return Structure that contains partial results of the algorithm
+     */
+    DistributedStep1LocalPartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm with a copy of input objects
+     * and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training parameters */
+
+protected:
+    DistributedStep1LocalPartialResultPtr _partialResult;
+
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResultType());
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the partial results of the gradient boosted trees regression training
+ *        in the second step of the distributed processing mode.
+ *        The partial results of the master node are kept between the iterations: globalBinBorders and currentTree
+ *        have to be sent to the local nodes until isFinished() of the partial result returns true.
+ *        Then finalizeCompute() returns the trained model
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedStep2MasterInput         InputType;
+    typedef algorithms::gbt::regression::training::Parameter                           ParameterType;
+    typedef algorithms::gbt::regression::training::Result                              ResultType;
+    typedef algorithms::gbt::regression::training::DistributedStep2MasterPartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the algorithm by copying input objects and parameters of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store partial results of the algorithm
+     * \param[in] partialResult    Structure to store partial results of the algorithm
+     */
+    services::Status setPartialResult(const DistributedStep2MasterPartialResultPtr& partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the algorithm
+     * \return Structure that contains partial results of the algorithm
+     */
+    DistributedStep2MasterPartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the results of the algorithm
+     * \param[in] res    Structure to store the results of the algorithm
+     */
+    services::Status setResult(const ResultPtr& res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the results of the algorithm
+     * \return Structure that contains the results of the algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm with a copy of input objects
+     * and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training parameters */
+
+protected:
+    DistributedStep2MasterPartialResultPtr _partialResult;
+    ResultPtr _result;
+
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        data_management::NumericTablePtr binBordersTable = _partialResult->get(globalBinBorders);
+        DAAL_CHECK(binBordersTable, services::ErrorNullPartialResult);
+        services::Status s;
+        _result->set(model, gbt::regression::Model::create(binBordersTable->getNumberOfRows(), &s));
+        _res = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return services::Status();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResultType());
+        _result.reset(new ResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -31,6 +31,7 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_training_parameter.h"
 #include "algorithms/regression/regression_training_types.h"
+#include "algorithms/tree_utils/tree_utils_binned_features.h"
 
 namespace daal
 {
@@ -83,7 +84,31 @@ enum InputId
 {
     data              = algorithms::regression::training::data,               /*!< %Input data table */
     dependentVariable = algorithms::regression::training::dependentVariables, /*!< %Values of the dependent variable for the input data */
-    lastInputId       = dependentVariable
+    validationData,              /*!< Optional validation data table used for early stopping */
+    validationDependentVariable, /*!< Optional values of the dependent variable for the validation data */
+    lastInputId       = validationDependentVariable
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__INPUTMODELID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum InputModelId
+{
+    inputModel = lastInputId + 1, /*!< Optional model to continue the training from. Its trees are copied to the trained model
+                                       and the new trees are fitted to the residuals of its predictions */
+    lastInputModelId = inputModel
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__INPUTBINNEDFEATURESID"></a>
+ * \brief Available identifiers of the input binned features for model-based training
+ */
+enum InputBinnedFeaturesId
+{
+    binnedFeatures = lastInputModelId + 1, /*!< Optional binned features of the input data. Used instead of
+                                                binning the data when computed with the parameters of the training */
+    lastInputBinnedFeaturesId = binnedFeatures
 };
 
 /**
@@ -106,11 +131,118 @@ enum OptionalResultNumericTableId
     lastOptionalResultNumericTableId = variableImportanceGain
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUTID"></a>
+ * \brief Available identifiers of input numeric tables for the gradient boosted trees training
+ *        in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalInputId
+{
+    binBorders = lastInputBinnedFeaturesId + 1, /*!< Right borders of the bins of the features computed on the master node.
+                                       If not set, the local sketch of the bins is computed */
+    tree,                         /*!< Tree being built on the master node */
+    lastDistributedStep1LocalInputId = tree
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDLOCALINPUTDATAID"></a>
+ * \brief Available identifiers of input data collections for the gradient boosted trees training
+ *        in the first step of the distributed processing mode
+ */
+enum DistributedLocalInputDataId
+{
+    internalInput = lastDistributedStep1LocalInputId + 1, /*!< %DataCollection with internal algorithm data calculated by previous steps on this node */
+    lastDistributedLocalInputDataId = internalInput
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of the gradient boosted trees training
+ *        in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalPartialResultId
+{
+    binSketch,  /*!< Right borders of the local bins of the features followed by the numbers of observations in them */
+    histograms, /*!< Sums of gradients, hessians and numbers of observations in the bins of the features
+                     for the nodes of the tree which are computed locally */
+    lastDistributedStep1LocalPartialResultId = histograms
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULTDATAID"></a>
+ * \brief Available identifiers of partial result data collections of the gradient boosted trees training
+ *        in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalPartialResultDataId
+{
+    internalResult = lastDistributedStep1LocalPartialResultId + 1, /*!< %DataCollection with internal algorithm data required as an input for the future steps on the node */
+    lastDistributedStep1LocalPartialResultDataId = internalResult
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for the gradient boosted trees training
+ *        in the second step of the distributed processing mode
+ */
+enum DistributedStep2MasterInputId
+{
+    partialResults, /*!< Collection of partial results computed on local nodes in the first step */
+    lastDistributedStep2MasterInputId = partialResults
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of the gradient boosted trees training
+ *        in the second step of the distributed processing mode
+ */
+enum DistributedStep2MasterPartialResultId
+{
+    globalBinBorders, /*!< Right borders of the bins of the features, binBorders input of the first step */
+    currentTree,      /*!< Tree being built, tree input of the first step */
+    finished,         /*!< Numeric table of size 1 x 1 equal to 1 when all the trees are built */
+    lastDistributedStep2MasterPartialResultId = finished
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULTDATAID"></a>
+ * \brief Available identifiers of partial result data collections of the gradient boosted trees training
+ *        in the second step of the distributed processing mode
+ */
+enum DistributedStep2MasterPartialResultDataId
+{
+    trees = lastDistributedStep2MasterPartialResultId + 1, /*!< %DataCollection of the trees built so far */
+    internalMasterResult,                                   /*!< %DataCollection with internal algorithm data required in the next iterations on the master node */
+    lastDistributedStep2MasterPartialResultDataId = internalMasterResult
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PARAMETER"></a>
+ * \brief Parameters for the gradient boosted trees algorithm
+ *
+ * \snippet gradient_boosted_trees/gbt_regression_training_types.h interface1::Parameter source code
+ */
+/* [interface1::Parameter source code] */
+class DAAL_EXPORT Parameter : public daal::algorithms::Parameter, public daal::algorithms::gbt::training::interface1::Parameter
+{
+public:
+    Parameter();
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    LossFunctionType loss; /*!< Loss function type */
+};
+/* [interface1::Parameter source code] */
+} // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PARAMETER"></a>
  * \brief Parameters for the gradient boosted trees algorithm
@@ -127,6 +259,10 @@ public:
     LossFunctionType loss; /*!< Loss function type */
 };
 /* [Parameter source code] */
+} // namespace interface2
+
+namespace interface1
+{
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__INPUT"></a>
@@ -157,6 +293,34 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr &value);
 
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id    Identifier of the input model
+     * \return          %Input model that corresponds to the given identifier
+     */
+    gbt::regression::ModelPtr get(InputModelId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id      Identifier of the input model
+     * \param[in] value   Pointer to the model
+     */
+    void set(InputModelId id, const gbt::regression::ModelPtr &value);
+
+    /**
+     * Returns the input binned features for model-based training
+     * \param[in] id    Identifier of the input binned features
+     * \return          %Input binned features that correspond to the given identifier
+     */
+    tree_utils::BinnedFeaturesPtr get(InputBinnedFeaturesId id) const;
+
+    /**
+     * Sets the input binned features for model-based training
+     * \param[in] id      Identifier of the input binned features
+     * \param[in] value   Pointer to the binned features
+     */
+    void set(InputBinnedFeaturesId id, const tree_utils::BinnedFeaturesPtr &value);
+
     /**
     * Checks an input object for the gradient boosted trees algorithm
     * \param[in] par     Algorithm parameter
@@ -164,6 +328,9 @@ public:
     * \return Status of checking
     */
     services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    Input(size_t nElements);
 };
 
 /**
@@ -187,6 +354,16 @@ public:
     template<typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory to store the result of model-based training
+     * \param[in] input Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method Computation method for the algorithm
+     * \return Status of allocation
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns the result of model-based training
      * \param[in] id    Identifier of the result
@@ -234,11 +411,279 @@ protected:
 };
 typedef services::SharedPtr<Result> ResultPtr;
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUT"></a>
+ * \brief %Input objects for the gradient boosted trees training in the first step
+ *        of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep1LocalInput : public Input
+{
+public:
+    /** Default constructor */
+    DistributedStep1LocalInput();
+
+    /** Copy constructor */
+    DistributedStep1LocalInput(const DistributedStep1LocalInput& other) : Input(other){}
+
+    virtual ~DistributedStep1LocalInput() {}
+
+    using Input::get;
+    using Input::set;
+
+    /**
+     * Returns an input object for the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep1LocalInputId id) const;
+
+    /**
+     * Sets an input object for the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(DistributedStep1LocalInputId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Returns an input data collection for the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedLocalInputDataId id) const;
+
+    /**
+     * Sets an input data collection for the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(DistributedLocalInputDataId id, const data_management::DataCollectionPtr &value);
+
+    /**
+    * Checks an input object for the gradient boosted trees training in the first step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method
+ *        of the gradient boosted trees training in the first step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep1LocalPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedStep1LocalPartialResult);
+    DistributedStep1LocalPartialResult();
+
+    virtual ~DistributedStep1LocalPartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the gradient boosted trees training in the first step of the distributed processing mode.
+     * Sizes of the partial results depend on the input tree, the memory is allocated on computation
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] parameter Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns a partial result of the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep1LocalPartialResultId id) const;
+
+    /**
+     * Sets a partial result of the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(DistributedStep1LocalPartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns a partial result data collection of the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedStep1LocalPartialResultDataId id) const;
+
+    /**
+     * Sets a partial result data collection of the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(DistributedStep1LocalPartialResultDataId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Checks partial results of the gradient boosted trees training in the first step of the distributed processing mode
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     Parameter of the algorithm
+     * \param[in] method  Computation method of the algorithm
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        /* The internal data stays on the local node and is not sent to the master node */
+        data_management::DataCollectionPtr internalData = get(internalResult);
+        if(!onDeserialize)
+            set(internalResult, data_management::DataCollectionPtr());
+        services::Status s = daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+        if(!onDeserialize)
+            set(internalResult, internalData);
+        return s;
+    }
+};
+typedef services::SharedPtr<DistributedStep1LocalPartialResult> DistributedStep1LocalPartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects for the gradient boosted trees training in the second step
+ *        of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    DistributedStep2MasterInput();
+
+    /** Copy constructor */
+    DistributedStep2MasterInput(const DistributedStep2MasterInput& other) : daal::algorithms::Input(other){}
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns an input object for the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedStep2MasterInputId id) const;
+
+    /**
+     * Sets an input object for the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id      Identifier of the input object
+     * \param[in] ptr     Pointer to the object
+     */
+    void set(DistributedStep2MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds a partial result computed on a local node to the collection of input objects
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the partial result
+     */
+    void add(DistributedStep2MasterInputId id, const DistributedStep1LocalPartialResultPtr &value);
+
+    /**
+    * Checks an input object for the gradient boosted trees training in the second step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method
+ *        of the gradient boosted trees training in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedStep2MasterPartialResult);
+    DistributedStep2MasterPartialResult();
+
+    virtual ~DistributedStep2MasterPartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] parameter Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns a partial result of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep2MasterPartialResultId id) const;
+
+    /**
+     * Sets a partial result of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(DistributedStep2MasterPartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns a partial result data collection of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedStep2MasterPartialResultDataId id) const;
+
+    /**
+     * Sets a partial result data collection of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(DistributedStep2MasterPartialResultDataId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns true if all the trees are built and finalizeCompute() can be called
+     * \return True if all the trees are built
+     */
+    bool isFinished() const;
+
+    /**
+     * Checks partial results of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     Parameter of the algorithm
+     * \param[in] method  Computation method of the algorithm
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of the gradient boosted trees training in the second step of the distributed processing mode
+     * \param[in] par     Parameter of the algorithm
+     * \param[in] method  Computation method of the algorithm
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedStep2MasterPartialResult> DistributedStep2MasterPartialResultPtr;
+
 } // namespace interface1
-using interface1::Parameter;
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
+using interface1::DistributedStep1LocalInput;
+using interface1::DistributedStep1LocalPartialResult;
+using interface1::DistributedStep1LocalPartialResultPtr;
+using interface1::DistributedStep2MasterInput;
+using interface1::DistributedStep2MasterPartialResult;
+using interface1::DistributedStep2MasterPartialResultPtr;
 
 } // namespace training
 /** @} */
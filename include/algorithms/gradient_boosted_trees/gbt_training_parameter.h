@@ -83,9 +83,9 @@ namespace interface1
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__PARAMETER"></a>
  * \brief Parameters for the gradient boosted trees algorithm
  *
- * \snippet gradient_boosted_trees/gbt_training_parameter.h Parameter source code
+ * \snippet gradient_boosted_trees/gbt_training_parameter.h interface1::Parameter source code
  */
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 class DAAL_EXPORT Parameter
 {
 public:
@@ -119,9 +119,40 @@ public:
     int internalOptions;                    /*!< Internal options */
     DAAL_UINT64 resultsToCompute;           /*!< */
 };
-/* [Parameter source code] */
+/* [interface1::Parameter source code] */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__PARAMETER"></a>
+ * \brief Parameters for the gradient boosted trees algorithm
+ *
+ * \snippet gradient_boosted_trees/gbt_training_parameter.h Parameter source code
+ */
+/* [Parameter source code] */
+class DAAL_EXPORT Parameter : public interface1::Parameter
+{
+public:
+    Parameter();
+
+    size_t maxLeaves;                       /*!< Maximal number of leaf nodes in a tree, 0 for unlimited. If non-zero, the tree grows
+                                                 leaf-wise: the leaf with the largest loss reduction is split first,
+                                                 maxTreeDepth still limits the depth of the tree.
+                                                 Otherwise the tree grows level by level.
+                                                 Default is 0 */
+    size_t maxIterationsWithoutImprovement; /*!< Used only if the validation data set is provided. The training stops when the loss on
+                                                 the validation data set has not decreased for this number of iterations in a row,
+                                                 the trees built after the iteration with the smallest loss are discarded.
+                                                 0 to build all maxIterations trees. Default is 0 */
+};
+/* [Parameter source code] */
+} // namespace interface2
+using interface2::Parameter;
 /** @} */
 } // namespace training
 }
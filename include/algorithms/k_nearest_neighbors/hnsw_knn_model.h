@@ -0,0 +1,177 @@
+/* file: hnsw_knn_model.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the approximate k-nearest neighbors search model
+//  based on the hierarchical navigable small world (HNSW) graph
+//--
+*/
+
+#ifndef __HNSW_KNN_MODEL_H__
+#define __HNSW_KNN_MODEL_H__
+
+#include "algorithms/model.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/engines/mcg59/mcg59.h"
+
+namespace daal
+{
+namespace algorithms
+{
+
+/**
+ * @defgroup hnsw_knn Approximate k-Nearest Neighbors Search
+ * \copydoc daal::algorithms::hnsw_knn
+ * @ingroup training_and_prediction
+ * @{
+ */
+
+/**
+ * \brief Contains classes for the approximate k-nearest neighbors search algorithm based on
+ *        the hierarchical navigable small world (HNSW) graph
+ */
+namespace hnsw_knn
+{
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__HNSW_KNN__PARAMETER"></a>
+ * \brief Parameters of the approximate k-nearest neighbors search algorithm based on the HNSW graph
+ *
+ * \snippet k_nearest_neighbors/hnsw_knn_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nNeighbors       Number of neighbors to search for
+     *  \param[in] maxNeighbors     Maximum number of links of a graph node on the upper layers of the graph
+     *  \param[in] efConstruction   Size of the list of candidates used to search the neighbors of a node being inserted into the graph
+     *  \param[in] efSearch         Size of the list of candidates used to search the neighbors of a query
+     */
+    Parameter(size_t nNeighbors = 1, size_t maxNeighbors = 16, size_t efConstruction = 200, size_t efSearch = 50)
+        : k(nNeighbors),
+          maxNeighbors(maxNeighbors),
+          efConstruction(efConstruction),
+          efSearch(efSearch),
+          engine(engines::mcg59::Batch<>::create())
+    {}
+
+    /**
+     * Checks a parameter of the approximate k-nearest neighbors search algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t k;                  /*!< Number of neighbors to search for */
+    size_t maxNeighbors;       /*!< Maximum number of links of a graph node on the upper layers (M). The bottom layer keeps
+                                    up to 2 * maxNeighbors links. Larger values increase recall, memory footprint and training time */
+    size_t efConstruction;     /*!< Size of the list of candidates used on the training stage. Larger values build a graph
+                                    of better quality at the cost of longer training */
+    size_t efSearch;           /*!< Size of the list of candidates used on the prediction stage, not smaller than k.
+                                    Larger values increase recall and decrease the number of queries processed per second */
+    engines::EnginePtr engine; /*!< Engine for the random selection of the layers of graph nodes */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__MODEL"></a>
+ * \brief Model of the approximate k-nearest neighbors search algorithm. Contains the training data
+ *        and the hierarchical navigable small world graph built over it
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public daal::algorithms::Model
+{
+public:
+    DECLARE_MODEL_IFACE(Model, daal::algorithms::Model);
+
+    /**
+     * Empty constructor for deserialization
+     */
+    Model();
+
+    /**
+     * Constructs the model of the approximate k-nearest neighbors search algorithm
+     * \param[in]  nFeatures Number of features in the dataset
+     * \param[out] stat      Status of the model construction
+     */
+    static services::SharedPtr<Model> create(size_t nFeatures = 0, services::Status *stat = NULL);
+
+    virtual ~Model();
+
+    class ModelImpl;
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    const ModelImpl *impl() const { return _impl; }
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    ModelImpl *impl() { return _impl; }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     *  Retrieves the number of points in the graph
+     *  \return Number of points in the graph
+     */
+    size_t getNumberOfPoints() const;
+
+protected:
+    Model(size_t nFeatures, services::Status &st);
+
+    services::Status serializeImpl(data_management::InputDataArchive   *arch) DAAL_C11_OVERRIDE;
+
+    services::Status deserializeImpl(const data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE;
+
+private:
+    ModelImpl *_impl;  /*!< Model implementation */
+};
+typedef services::SharedPtr<Model> ModelPtr;
+typedef services::SharedPtr<const Model> ModelConstPtr;
+} // namespace interface1
+
+using interface1::Parameter;
+using interface1::Model;
+using interface1::ModelPtr;
+using interface1::ModelConstPtr;
+
+} // namespace hnsw_knn
+
+/** @} */
+} // namespace algorithms
+} // namespace daal
+
+#endif
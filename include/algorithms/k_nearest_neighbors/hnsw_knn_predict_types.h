@@ -0,0 +1,215 @@
+/* file: hnsw_knn_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the approximate k-nearest neighbors search algorithm
+//--
+*/
+
+#ifndef __HNSW_KNN_PREDICT_TYPES_H__
+#define __HNSW_KNN_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+/**
+ * @defgroup hnsw_knn_prediction Prediction
+ * \copydoc daal::algorithms::hnsw_knn::prediction
+ * @ingroup hnsw_knn
+ * @{
+ */
+/**
+ * \brief Contains classes for searching the approximate k nearest neighbors of query points in the graph
+ */
+namespace prediction
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__PREDICTION__METHOD"></a>
+ * \brief Available methods for searching the approximate k nearest neighbors
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__PREDICTION__NUMERICTABLEINPUTID"></a>
+ * \brief Available identifiers of input numeric tables of the approximate k-nearest neighbors search algorithm
+ */
+enum NumericTableInputId
+{
+    data,                       /*!< %Input data table with query points */
+    lastNumericTableInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__PREDICTION__MODELINPUTID"></a>
+ * \brief Available identifiers of input models of the approximate k-nearest neighbors search algorithm
+ */
+enum ModelInputId
+{
+    model = lastNumericTableInputId + 1, /*!< Trained model */
+    lastModelInputId = model
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the results of the approximate k-nearest neighbors search algorithm
+ */
+enum ResultId
+{
+    indices,                    /*!< Table of size nQueries x k with the indices of the found neighbors in the training data
+                                     sorted by the increasing distance, -1 if fewer than k neighbors are found */
+    distances,                  /*!< Table of size nQueries x k with the Euclidean distances to the found neighbors */
+    lastResultId = distances
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__PREDICTION__INPUT"></a>
+ * \brief %Input objects of the approximate k-nearest neighbors search algorithm
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other) : daal::algorithms::Input(other) {}
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input numeric table of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Returns an input model of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets an input numeric table of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets an input model of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(ModelInputId id, const ModelPtr &ptr);
+
+    /**
+     * Checks input objects of the approximate k-nearest neighbors search algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method
+ *        of the approximate k-nearest neighbors search algorithm
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+
+    Result();
+
+    virtual ~Result() {}
+
+    /**
+     * Allocates memory to store the result of the approximate k-nearest neighbors search algorithm
+     * \param[in] input     %Input of the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the approximate k-nearest neighbors search algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the result of the approximate k-nearest neighbors search algorithm
+     * \param[in] input     %Input object of the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace prediction
+/** @} */
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,189 @@
+/* file: hnsw_knn_training_batch.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the approximate k-nearest neighbors search training algorithm
+//  in the batch processing mode
+//--
+*/
+
+#ifndef __HNSW_KNN_TRAINING_BATCH_H__
+#define __HNSW_KNN_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * @defgroup hnsw_knn_training_batch Batch
+ * @ingroup hnsw_knn_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__TRAINING__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the approximate k-nearest neighbors search training algorithm
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Training method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the approximate k-nearest neighbors search training algorithm
+     * with a specified environment in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the approximate k-nearest neighbors search training algorithm in the batch processing mode
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__TRAINING__BATCH"></a>
+ * \brief Builds the hierarchical navigable small world graph used by the approximate k-nearest neighbors search
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method    Training methods
+ *      - \ref InputId   Identifiers of input objects
+ *      - \ref ResultId  Identifiers of the results
+ *
+ * \par References
+ *      - \ref hnsw_knn::interface1::Model "hnsw_knn::Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Training<batch>
+{
+public:
+    typedef algorithms::hnsw_knn::training::Input   InputType;
+    typedef algorithms::hnsw_knn::Parameter         ParameterType;
+    typedef algorithms::hnsw_knn::training::Result  ResultType;
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Algorithm \ref hnsw_knn::interface1::Parameter "parameter" */
+
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an approximate k-nearest neighbors search training algorithm by copying input objects
+     * and parameters of another approximate k-nearest neighbors search training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the training algorithm
+     * \return Structure that contains the results of the training algorithm
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the training algorithm
+     * \param[in] res  Structure to store the results of the training algorithm
+     */
+    services::Status setResult(const ResultPtr &res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated training algorithm with a copy of input objects
+     * and parameters of this training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    ResultPtr _result;
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result.reset(new ResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace training
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
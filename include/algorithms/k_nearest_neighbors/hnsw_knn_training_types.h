@@ -0,0 +1,188 @@
+/* file: hnsw_knn_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the approximate k-nearest neighbors search training algorithm
+//--
+*/
+
+#ifndef __HNSW_KNN_TRAINING_TYPES_H__
+#define __HNSW_KNN_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn
+{
+/**
+ * @defgroup hnsw_knn_training Training
+ * \copydoc daal::algorithms::hnsw_knn::training
+ * @ingroup hnsw_knn
+ * @{
+ */
+/**
+ * \brief Contains classes for building the graph of the approximate k-nearest neighbors search algorithm
+ */
+namespace training
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__TRAINING__METHOD"></a>
+ * \brief Available methods for building the graph of the approximate k-nearest neighbors search algorithm
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default method: inserts the points into the graph in parallel batches of growing size */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__TRAINING__INPUTID"></a>
+ * \brief Available identifiers of input objects of the approximate k-nearest neighbors search training algorithm
+ */
+enum InputId
+{
+    data,                   /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN__TRAINING__RESULTID"></a>
+ * \brief Available identifiers of the results of the approximate k-nearest neighbors search training algorithm
+ */
+enum ResultId
+{
+    model,                  /*!< Model with the graph built over the input data */
+    lastResultId = model
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__TRAINING__INPUT"></a>
+ * \brief %Input objects of the approximate k-nearest neighbors search training algorithm
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input& other) : daal::algorithms::Input(other) {}
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object of the approximate k-nearest neighbors search training algorithm
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets an input object of the approximate k-nearest neighbors search training algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks input objects of the approximate k-nearest neighbors search training algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN__TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method
+ *        of the approximate k-nearest neighbors search training algorithm
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+
+    Result();
+
+    virtual ~Result() {}
+
+    /**
+     * Allocates memory to store the result of the approximate k-nearest neighbors search training algorithm
+     * \param[in] input     %Input of the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the approximate k-nearest neighbors search training algorithm
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    ModelPtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the approximate k-nearest neighbors search training algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] value Pointer to the object
+     */
+    void set(ResultId id, const ModelPtr &value);
+
+    /**
+     * Checks the result of the approximate k-nearest neighbors search training algorithm
+     * \param[in] input     %Input object of the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace training
+/** @} */
+} // namespace hnsw_knn
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -58,6 +58,38 @@ enum DataUseInModel
     doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__RESULTTOCOMPUTEID"></a>
+ * \brief Available identifiers of the optional results of kNN model-based prediction
+ */
+enum ResultToComputeId
+{
+    computeIndicesOfNeighbors = 0x00000001ULL, /*!< Compute the indices of the nearest neighbors in the training dataset */
+    computeDistances          = 0x00000002ULL  /*!< Compute the Euclidean distances to the nearest neighbors */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__VOTEWEIGHTS"></a>
+ * \brief Weights of the nearest neighbors in the prediction
+ */
+enum VoteWeights
+{
+    voteUniform  = 0, /*!< All the nearest neighbors have the same weight */
+    voteDistance = 1  /*!< The weight of a neighbor is the inverse of the distance to it. If some neighbors coincide
+                           with the query point, only these neighbors are taken into account */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTIONMODE"></a>
+ * \brief The way the responses of the nearest neighbors are combined into the prediction
+ */
+enum PredictionMode
+{
+    classVoting       = 0, /*!< Classification: the prediction is the class label with the largest total weight of neighbors */
+    responseAveraging = 1  /*!< Regression: the prediction is the weighted average of the responses of neighbors.
+                                The labels of the training dataset contain the responses */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -144,6 +176,53 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 /* [Parameter source code] */
 }
 
+/**
+ * \brief Contains version 3.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PARAMETER"></a>
+ * \brief KD-tree based kNN algorithm parameters with the optional results of the prediction, the weights of neighbors,
+ *        the prediction mode and the threshold of the model updates
+ *
+ * \snippet k_nearest_neighbors/kdtree_knn_classification_model.h Parameter source code
+ */
+/* [interface3::Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nClasses             Number of classes
+     *  \param[in] nNeighbors           Number of neighbors
+     *  \param[in] randomSeed           Seed for random choosing elements from training dataset \DAAL_DEPRECATED_USE{ engine }
+     *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     */
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, int randomSeed = 777, DataUseInModel dataUse = doNotUse)
+        : interface2::Parameter(nClasses, nNeighbors, randomSeed, dataUse),
+          resultsToCompute(0),
+          voteWeights(voteUniform),
+          predictionMode(classVoting),
+          rebuildThreshold(0.25)
+    {}
+
+    /**
+     * Checks a parameter of the KD-tree based kNN algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the optional results to compute in the prediction,
+                                        \ref ResultToComputeId */
+    VoteWeights voteWeights;       /*!< Weights of the nearest neighbors in the prediction */
+    PredictionMode predictionMode; /*!< The way the responses of the nearest neighbors are combined into the prediction */
+    double rebuildThreshold;       /*!< Ratio of the number of points inserted into and removed from the trained model to the number
+                                        of points the model was trained on, starting from which the full rebuild of the model is
+                                        recommended, see Model::isRebuildRecommended */
+};
+/* [interface3::Parameter source code] */
+}
+
 namespace interface1
 {
 /**
@@ -198,6 +277,51 @@ public:
      */
     size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
 
+    /**
+     * Inserts the points into the model without the full rebuild of the KD-tree. Only the leaves the points fall into are
+     * split into balanced subtrees, the upper levels of the KD-tree are never rebalanced, so the tree gets deeper where
+     * the points are inserted. Use isRebuildRecommended and rebuild to restore the balanced KD-tree.
+     * The inserted points get the indices that follow the largest index of the points
+     * ever stored in the model, in the order of the rows of the data table.
+     * The model must not be used by other threads while it is updated
+     * \param[in] data    Points to insert, the table of size nPoints x nFeatures
+     * \param[in] labels  Labels of the points to insert, the table of size nPoints x 1
+     * \return Status of the operation
+     */
+    services::Status insertPoints(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels);
+
+    /**
+     * Removes the points from the model without the full rebuild of the KD-tree. The indices of the remaining points are kept.
+     * The indices that do not belong to the points of the model are ignored.
+     * The model must not be used by other threads while it is updated
+     * \param[in] indices  Indices of the points to remove, the table of size nIndices x 1
+     * \return Status of the operation
+     */
+    services::Status removePoints(const data_management::NumericTablePtr & indices);
+
+    /**
+     * Returns the ratio of the number of points inserted into and removed from the model and of the unused rows left in
+     * the model by the updates to the number of points the model was trained on
+     * \return Ratio of the updates of the model
+     */
+    double getUpdateRatio() const;
+
+    /**
+     * Checks if the ratio of the updates of the model exceeds the rebuild threshold the model was trained with.
+     * The search in the updated model is exact, but it slows down as the updated model diverges from the balanced KD-tree
+     * \return True if the full rebuild of the model is recommended
+     */
+    bool isRebuildRecommended() const;
+
+    /**
+     * Trains the new model on the points of this model. The points keep their indices and labels in the new model.
+     * The model is not modified by the rebuild, so it can be used for the prediction while the new model is trained,
+     * for example, in a background thread
+     * \param[out] stat  Status of the rebuild
+     * \return The new model
+     */
+    services::SharedPtr<Model> rebuild(services::Status * stat = NULL) const;
+
 protected:
     Model(size_t nFeatures, services::Status &st);
 
@@ -211,7 +335,7 @@ private:
 typedef services::SharedPtr<Model> ModelPtr;
 } // namespace interface1
 
-using interface2::Parameter;
+using interface3::Parameter;
 using interface1::Model;
 using interface1::ModelPtr;
 
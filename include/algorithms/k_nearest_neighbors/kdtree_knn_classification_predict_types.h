@@ -58,7 +58,23 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0,   /*!< Default method: searches the KD-tree built on the training stage */
+    bruteForceDense = 1 /*!< Brute-force method: computes distances to all training points by blocked matrix multiplication,
+                             intended for high-dimensional data */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the optional results of KD-tree based kNN model-based prediction
+ */
+enum ResultId
+{
+    indices = classifier::prediction::lastResultId + 1, /*!< %Numeric table of size n x k with the indices of the nearest neighbors
+                                                             in the training dataset. Computed when computeIndicesOfNeighbors is set
+                                                             in Parameter::resultsToCompute */
+    distances,                                          /*!< %Numeric table of size n x k with the Euclidean distances to the nearest
+                                                             neighbors. Computed when computeDistances is set in Parameter::resultsToCompute */
+    lastResultId = distances
 };
 
 /**
@@ -110,9 +126,73 @@ public:
     services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of KD-tree based kNN model-based prediction
+ *
+ * The neighbors of every query point are listed in the order of increasing distance. When the training dataset
+ * contains less than k points, the remaining entries of indices are set to -1 and the remaining distances
+ * are set to the maximal value of the floating-point type.
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result);
+    Result();
+    virtual ~Result() {}
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the optional result of KD-tree based kNN model-based prediction
+     * \param[in] id   Identifier of the result, \ref ResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the optional result of KD-tree based kNN model-based prediction
+     * \param[in] id      Identifier of the result, \ref ResultId
+     * \param[in] value   Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory to store the results of KD-tree based kNN model-based prediction
+     * \param[in] input     Pointer to the input objects of the algorithm
+     * \param[in] parameter Pointer to the parameters of the algorithm
+     * \param[in] method    Computation method
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the result of KD-tree based kNN model-based prediction
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                           int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive *arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
 } // namespace interface1
 
 using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
 
 } // namespace prediction
 /** @} */
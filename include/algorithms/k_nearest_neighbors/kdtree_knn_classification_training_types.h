@@ -58,7 +58,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0,   /*!< Default method: builds a KD-tree over the training data */
+    bruteForceDense = 1 /*!< Brute-force method: keeps the training data in row-major layout without building a KD-tree,
+                             intended for high-dimensional data */
 };
 
 /**
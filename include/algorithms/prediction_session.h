@@ -0,0 +1,144 @@
+/* file: prediction_session.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the base class of the low-latency prediction sessions.
+//--
+*/
+
+#ifndef __PREDICTION_SESSION_H__
+#define __PREDICTION_SESSION_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+class PredictionSessionImpl;
+}
+
+namespace interface1
+{
+/**
+ * @addtogroup base_algorithms
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PREDICTIONSESSION"></a>
+ * \brief Base class of the sessions that compute the model-based prediction for small blocks of observations
+ *        with low latency. The session is bound to the prediction algorithm with the trained model once,
+ *        keeps the preallocated input and output buffers and the computation environment between the calls,
+ *        and computes the blocks smaller than the sequential threshold on the calling thread only
+ */
+class DAAL_EXPORT PredictionSession
+{
+public:
+    DAAL_NEW_DELETE();
+
+    virtual ~PredictionSession();
+
+    /**
+     * Computes the model-based prediction for the block of observations
+     * \param[in]  rows  Array of size nRows x nFeatures that contains the observations in the row-major order
+     * \param[in]  nRows Number of observations
+     * \param[out] out   Array of size nRows x nOutputs to store the prediction
+     * \return Status of computations
+     */
+    services::Status predict(const float *rows, size_t nRows, float *out);
+
+    /**
+     * Returns the number of features in the observations
+     * \return Number of features in the observations
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    /**
+     * Returns the number of values predicted for each observation
+     * \return Number of values predicted for each observation
+     */
+    size_t getNumberOfOutputs() const { return _nOutputs; }
+
+    /**
+     * Returns the maximal number of observations processed by one call of the algorithm.
+     * Larger blocks are split by the session
+     * \return Maximal number of observations processed by one call of the algorithm
+     */
+    size_t getMaxNumberOfRows() const { return _maxRows; }
+
+    /**
+     * Sets the number of observations below which the prediction is computed on the calling thread only.
+     * By default equals 128, the number of observations tree ensemble prediction kernels process in one block
+     * \param[in] nRows Number of observations
+     */
+    void setSequentialThreshold(size_t nRows) { _sequentialThreshold = nRows; }
+
+    /**
+     * Returns the number of observations below which the prediction is computed on the calling thread only
+     * \return Number of observations
+     */
+    size_t getSequentialThreshold() const { return _sequentialThreshold; }
+
+    /**
+     * Returns the status of the session initialization
+     * \return Status of the session initialization
+     */
+    const services::Status &getStatus() const { return _status; }
+
+protected:
+    PredictionSession(size_t nFeatures, size_t nOutputs, size_t maxRows);
+
+    /**
+     * Allocates the input and output buffers and binds them to the prediction algorithm
+     * \param[in] algorithm Prediction algorithm with the trained model
+     * \return Status of the initialization
+     */
+    services::Status initialize(Prediction *algorithm);
+
+    /**
+     * Sets the numeric tables to the input and the result of the prediction algorithm
+     * \param[in] data       Numeric table with the observations
+     * \param[in] prediction Numeric table to store the prediction
+     * \return Status of the operation
+     */
+    virtual services::Status bind(const data_management::NumericTablePtr &data, const data_management::NumericTablePtr &prediction) = 0;
+
+    services::Status _status;
+
+private:
+    PredictionSession(const PredictionSession &);
+    PredictionSession &operator=(const PredictionSession &);
+
+    services::Status predictBlock(const float *rows, size_t nRows, float *out);
+
+    size_t _nFeatures;
+    size_t _nOutputs;
+    size_t _maxRows;
+    size_t _sequentialThreshold;
+    internal::PredictionSessionImpl *_impl;
+};
+/** @} */
+} // namespace interface1
+using interface1::PredictionSession;
+
+} // namespace algorithms
+} // namespace daal
+#endif
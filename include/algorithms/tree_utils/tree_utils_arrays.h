@@ -0,0 +1,164 @@
+/* file: tree_utils_arrays.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class holding the trees of a model in contiguous arrays
+//--
+*/
+
+#ifndef __TREE_UTILS_ARRAYS_H__
+#define __TREE_UTILS_ARRAYS_H__
+
+#include "services/daal_defines.h"
+#include "services/daal_memory.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace tree_utils
+{
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup tree_utils
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TREE_UTILS__TREEARRAYS"></a>
+ * \brief Nodes of the trees of a model stored in contiguous arrays, one element per node.
+ *        The nodes of the trees are stored one after another, the nodes of a tree are stored breadth-first
+ *        starting from its root, the indices of the child nodes are counted from the root of their tree.
+ *        The arrays have the format accepted by the addTrees methods of the model builders.
+ *        The arrays are shared pointers, so they can be handed over without copying
+ */
+class DAAL_EXPORT TreeArrays
+{
+public:
+    TreeArrays() : _nTrees(0), _nNodes(0) {}
+
+    /**
+     * Allocates the arrays
+     * \param[in] nTrees  Number of trees
+     * \param[in] nNodes  Total number of nodes in the trees
+     * \return Status of the allocation
+     */
+    services::Status allocate(size_t nTrees, size_t nNodes)
+    {
+        _nTrees = 0;
+        _nNodes = 0;
+        _treeOffsets      = allocateArray<size_t>(nTrees + 1);
+        _featureIndexes   = allocateArray<int>(nNodes);
+        _leftChildren     = allocateArray<size_t>(nNodes);
+        _rightChildren    = allocateArray<size_t>(nNodes);
+        _values           = allocateArray<double>(nNodes);
+        _impurities       = allocateArray<double>(nNodes);
+        _nodeSampleCounts = allocateArray<size_t>(nNodes);
+        if(!_treeOffsets || !_featureIndexes || !_leftChildren || !_rightChildren || !_values || !_impurities || !_nodeSampleCounts)
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        _nTrees = nTrees;
+        _nNodes = nNodes;
+        return services::Status();
+    }
+
+    /**
+     * Returns the number of trees
+     * \return Number of trees
+     */
+    size_t getNumberOfTrees() const { return _nTrees; }
+
+    /**
+     * Returns the total number of nodes in the trees
+     * \return Number of nodes
+     */
+    size_t getNumberOfNodes() const { return _nNodes; }
+
+    /**
+     * Returns the array of getNumberOfTrees() + 1 offsets, the nodes of the i-th tree are in [offsets[i], offsets[i + 1])
+     * \return Offsets of the trees
+     */
+    services::SharedPtr<size_t> getTreeOffsets() const { return _treeOffsets; }
+
+    /**
+     * Returns the indices of the features used for splitting, -1 for leaf nodes
+     * \return Feature indices
+     */
+    services::SharedPtr<int> getFeatureIndexes() const { return _featureIndexes; }
+
+    /**
+     * Returns the indices of the left children, 0 for leaf nodes
+     * \return Indices of the left children
+     */
+    services::SharedPtr<size_t> getLeftChildren() const { return _leftChildren; }
+
+    /**
+     * Returns the indices of the right children, 0 for leaf nodes
+     * \return Indices of the right children
+     */
+    services::SharedPtr<size_t> getRightChildren() const { return _rightChildren; }
+
+    /**
+     * Returns the feature values used for splitting for split nodes and the responses or class labels for leaf nodes
+     * \return Values of the nodes
+     */
+    services::SharedPtr<double> getValues() const { return _values; }
+
+    /**
+     * Returns the impurities of the nodes, 0 if the model does not contain them
+     * \return Impurities of the nodes
+     */
+    services::SharedPtr<double> getImpurities() const { return _impurities; }
+
+    /**
+     * Returns the numbers of training observations at the nodes, 0 if the model does not contain them
+     * \return Numbers of observations at the nodes
+     */
+    services::SharedPtr<size_t> getNodeSampleCounts() const { return _nodeSampleCounts; }
+
+private:
+    template <typename T>
+    static services::SharedPtr<T> allocateArray(size_t n)
+    {
+        return services::SharedPtr<T>((T *)services::daal_malloc((n ? n : 1) * sizeof(T)), services::ServiceDeleter());
+    }
+
+    size_t _nTrees;
+    size_t _nNodes;
+    services::SharedPtr<size_t> _treeOffsets;
+    services::SharedPtr<int> _featureIndexes;
+    services::SharedPtr<size_t> _leftChildren;
+    services::SharedPtr<size_t> _rightChildren;
+    services::SharedPtr<double> _values;
+    services::SharedPtr<double> _impurities;
+    services::SharedPtr<size_t> _nodeSampleCounts;
+};
+/** @} */
+} // namespace interface1
+using interface1::TreeArrays;
+
+} // namespace tree_utils
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,142 @@
+/* file: tree_utils_binned_features.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class holding the binned features of a data set shared by the trainings of tree-based models
+//--
+*/
+
+#ifndef __TREE_UTILS_BINNED_FEATURES_H__
+#define __TREE_UTILS_BINNED_FEATURES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "services/daal_defines.h"
+#include "services/collection.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace tree_utils
+{
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * @ingroup tree_utils
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__TREE_UTILS__BINNEDFEATURES"></a>
+ * \brief Features of a data set mapped to the indices of their bins or of their sorted unique values.
+ *        Computed once and used as an optional input of the trainings of the decision forest and
+ *        gradient boosted trees models on the same data set, which then skip the mapping of the features.
+ *        A training uses the object only when it was computed with the same floating-point type and
+ *        with the binning parameters the training requires, otherwise the features are mapped again
+ *
+ * \par References
+ *      - \ref computeConcurrently function
+ */
+class DAAL_EXPORT BinnedFeatures : public data_management::SerializationIface
+{
+public:
+    /** Constructs an empty object, used in deserialization */
+    BinnedFeatures();
+    virtual ~BinnedFeatures();
+
+    /**
+     * Maps the features of the data set to the indices of their bins or of their sorted unique values
+     * \tparam algorithmFPType  Data type used to read the data set, should be the same as in the trainings
+     * \param[in]  data         Data set
+     * \param[in]  maxBins      Maximal number of bins of a feature. If 0, the features are mapped to the indices of
+     *                          their sorted unique values as required by the exact split methods
+     * \param[in]  minBinSize   Minimal number of observations in a bin
+     * \param[out] stat         Status of the computation
+     * \return Pointer to the object with the mapped features
+     */
+    template <typename algorithmFPType>
+    static services::SharedPtr<BinnedFeatures> create(const data_management::NumericTable& data, size_t maxBins, size_t minBinSize,
+        services::Status *stat = NULL);
+
+    /**
+     * Returns the number of observations in the data set
+     * \return Number of observations
+     */
+    size_t getNumberOfRows() const;
+
+    /**
+     * Returns the number of features in the data set
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Returns the maximal number of bins of a feature, 0 if the features are mapped to their sorted unique values
+     * \return Maximal number of bins
+     */
+    size_t getMaxBins() const;
+
+    /**
+     * Returns the minimal number of observations in a bin
+     * \return Minimal number of observations in a bin
+     */
+    size_t getMinBinSize() const;
+
+    static int serializationTag();
+    virtual int getSerializationTag() const DAAL_C11_OVERRIDE;
+    services::Status serializeImpl(data_management::InputDataArchive *arch) DAAL_C11_OVERRIDE;
+    services::Status deserializeImpl(const data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE;
+
+public:
+    class BinnedFeaturesImpl;
+
+    const BinnedFeaturesImpl* impl() const { return _impl; }
+
+private:
+    static data_management::SerializationDesc _desc;
+
+    BinnedFeatures(const BinnedFeatures&);
+    BinnedFeatures& operator=(const BinnedFeatures&);
+
+    BinnedFeaturesImpl* _impl;
+};
+typedef services::SharedPtr<BinnedFeatures> BinnedFeaturesPtr;
+
+/**
+ * Runs the training algorithms concurrently, e.g. the trainings of several configurations of a model
+ * on the same data set which share its \ref BinnedFeatures
+ * \param[in] algorithms  Training algorithms with the inputs and the parameters set
+ * \return Status of the computations, contains the errors of all failed trainings
+ */
+DAAL_EXPORT services::Status computeConcurrently(const services::Collection<services::SharedPtr<Training<batch> > >& algorithms);
+/** @} */
+} // namespace interface1
+using interface1::BinnedFeatures;
+using interface1::BinnedFeaturesPtr;
+using interface1::computeConcurrently;
+
+} // namespace tree_utils
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -34,6 +34,7 @@
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
 #include "data_management/data_source/string_data_source.h"
+#include "data_management/data_source/sampling_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
 #include "data_management/data/data_archive.h"
@@ -58,6 +59,7 @@
 #include "algorithms/classifier/classifier_training_online.h"
 #include "algorithms/classifier/classifier_predict_types.h"
 #include "algorithms/classifier/classifier_predict.h"
+#include "algorithms/classifier/classifier_predict_session.h"
 #include "algorithms/classifier/classifier_model.h"
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
@@ -202,6 +204,7 @@
 #include "algorithms/analysis.h"
 #include "algorithms/model.h"
 #include "algorithms/prediction.h"
+#include "algorithms/prediction_session.h"
 #include "algorithms/training.h"
 #include "algorithms/algorithm_quality_metric_batch.h"
 #include "algorithms/algorithm_quality_metric_set_types.h"
@@ -340,6 +343,11 @@
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_types.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_model.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_types.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_training_batch.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_predict_types.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_predict.h"
 #include "algorithms/decision_tree/decision_tree_classification_model.h"
 #include "algorithms/decision_tree/decision_tree_classification_predict.h"
 #include "algorithms/decision_tree/decision_tree_classification_training_batch.h"
@@ -367,6 +375,7 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_distributed.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "algorithms/logistic_regression/logistic_regression_model.h"
 #include "algorithms/logistic_regression/logistic_regression_model_builder.h"
@@ -380,6 +389,7 @@
 #include "algorithms/regression/regression_training_batch.h"
 #include "algorithms/regression/regression_training_online.h"
 #include "algorithms/regression/regression_predict.h"
+#include "algorithms/regression/regression_predict_session.h"
 #include "algorithms/stump/stump_regression_model.h"
 #include "algorithms/stump/stump_regression_predict.h"
 #include "algorithms/stump/stump_regression_training_batch.h"
@@ -356,11 +356,11 @@ protected:
         size_t sizeOfRowInDict = 0;
         for( size_t i = 0; i < ncols; ++i )
         {
-            if (!(*_ddict)[i].typeSize)
+            if (!_ddict->getFeature(i).typeSize)
             {
                 return false;
             }
-            sizeOfRowInDict += (*_ddict)[i].typeSize;
+            sizeOfRowInDict += _ddict->getFeature(i).typeSize;
         }
         if (sizeOfRowInDict > _structSize)
         {
@@ -392,7 +392,7 @@ protected:
         for( size_t i = 0; i < ncols; ++i )
         {
             _offsets[i] = offset;
-            offset += (*_ddict)[i].typeSize;
+            offset += _ddict->getFeature(i).typeSize;
         }
         _structSize = offset;
 
@@ -457,7 +457,7 @@ private:
 
         for( size_t j = 0 ; j < ncols ; j++ )
         {
-            NumericTableFeature &f = (*_ddict)[j];
+            const NumericTableFeature &f = _ddict->getFeature(j);
 
             char *location = ptr + _offsets[j];
 
@@ -482,7 +482,7 @@ private:
 
             for( size_t j = 0 ; j < ncols ; j++ )
             {
-                NumericTableFeature &f = (*_ddict)[j];
+                const NumericTableFeature &f = _ddict->getFeature(j);
 
                 char *location = ptr + _offsets[j];
 
@@ -514,7 +514,7 @@ private:
 
         if((block.getRWFlag() & (int)readOnly))
         {
-            NumericTableFeature &f = (*_ddict)[feat_idx];
+            const NumericTableFeature &f = _ddict->getFeature(feat_idx);
             char *ptr = (char *)(_ptr.get()) + _structSize * idx + _offsets[feat_idx];
             internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())
                 (nrows, ptr, _structSize, block.getBlockPtr(), sizeof(T));
@@ -529,7 +529,7 @@ private:
         {
             size_t feat_idx = block.getColumnsOffset();
 
-            NumericTableFeature &f = (*_ddict)[feat_idx];
+            const NumericTableFeature &f = _ddict->getFeature(feat_idx);
 
             char *ptr = (char *)(_ptr.get()) + _structSize * block.getRowsOffset() + _offsets[feat_idx];
 
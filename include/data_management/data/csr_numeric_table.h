@@ -660,7 +660,7 @@ public:
         if( nrow == 0 )
             return services::Status(services::ErrorIncorrectNumberOfObservations);
 
-        NumericTableFeature &f = (*_ddict)[0];
+        const NumericTableFeature &f = _ddict->getFeature(0);
 
         _ptr        = services::SharedPtr<byte>  (   (byte*)daal::services::daal_malloc( dataSize   * f.typeSize     ), services::ServiceDeleter  ());
         _colIndices = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc( dataSize   * sizeof(size_t) ), services::ServiceDeleter());
@@ -762,7 +762,7 @@ protected:
 
         if( nfeat > 0 )
         {
-            NumericTableFeature &f = (*_ddict)[0];
+            const NumericTableFeature &f = _ddict->getFeature(0);
 
             arch->set( (char *)_ptr.get(), dataSize * f.typeSize );
             arch->set( _colIndices.get(), dataSize );
@@ -803,7 +803,7 @@ protected:
             return services::Status();
         }
 
-        NumericTableFeature &f = (*_ddict)[0];
+        const NumericTableFeature &f = _ddict->getFeature(0);
 
         T* buffer;
         T* castingBuffer;
@@ -878,7 +878,7 @@ protected:
         if( !block.resizeBuffer( 1, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
-        NumericTableFeature &f = (*_ddict)[0];
+        const NumericTableFeature &f = _ddict->getFeature(0);
 
         char   *rowCursor     = (char *)_ptr.get() + (rowOffsets[idx] - 1) * f.typeSize;
         size_t *indicesCursor = _colIndices.get() + (rowOffsets[idx] - 1);
@@ -931,7 +931,7 @@ protected:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
-        NumericTableFeature &f = (*_ddict)[0];
+        const NumericTableFeature &f = _ddict->getFeature(0);
 
 
         size_t nValues = rowOffsets[idx + nrows] - rowOffsets[idx];
@@ -975,7 +975,7 @@ protected:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
-            NumericTableFeature &f = (*_ddict)[0];
+            const NumericTableFeature &f = _ddict->getFeature(0);
             if (f.indexType != features::internal::getIndexNumType<T>())
             {
                 size_t nrows = block.getNumberOfRows();
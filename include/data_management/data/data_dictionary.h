@@ -157,7 +157,8 @@ public:
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DICTIONARY"></a>
  *  \brief Class that represents a dictionary of a data set
- *  and provides methods to work with the data dictionary
+ *  and provides methods to work with the data dictionary.
+ *  The non-const accessors may expand the compact storage of the features and are not thread-safe
  */
 template<typename Feature, int SerializationTag>
 class DAAL_EXPORT Dictionary : public SerializationIface, public DictionaryIface
@@ -173,7 +174,7 @@ public:
      *  \DAAL_DEPRECATED_USE{ Dictionary::create }
      */
     Dictionary( size_t nfeat, FeaturesEqual featuresEqual = notEqual ):
-        _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection())
+        _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection()), _compact(false)
     {
         if(nfeat) { setNumberOfFeatures(nfeat); }
     }
@@ -194,7 +195,7 @@ public:
      *  Default constructor of a data dictionary
      *  \DAAL_DEPRECATED_USE{ Dictionary::create }
      */
-    Dictionary(): _nfeat(0), _dict(0), _featuresEqual(DictionaryIface::notEqual), _errors(new services::KernelErrorCollection()) {}
+    Dictionary(): _nfeat(0), _featuresEqual(DictionaryIface::notEqual), _dict(0), _errors(new services::KernelErrorCollection()), _compact(false) {}
 
     /**
      *  Constructs a default data dictionary
@@ -223,6 +224,7 @@ public:
             _dict = NULL;
         }
         _nfeat = 0;
+        _compact = false;
         return services::Status();
     }
 
@@ -239,12 +241,16 @@ public:
                 _dict[0] = defaultFeature;
             }
         }
-        else
+        else if (_nfeat > 0)
         {
-            for( size_t i = 0 ; i < _nfeat ; i++ )
+            /* All features become equal, so the dictionary returns to the compact representation */
+            if (!_compact)
             {
-                _dict[i] = defaultFeature;
+                delete[] _dict;
+                _dict    = new Feature[1];
+                _compact = true;
             }
+            _dict[0] = defaultFeature;
         }
         return services::Status();
     }
@@ -269,14 +275,10 @@ public:
     {
         resetDictionary();
         _nfeat = numberOfFeatures;
-        if (_featuresEqual == DictionaryIface::equal)
-        {
-            _dict  = new Feature[1];
-        }
-        else
-        {
-            _dict  = new Feature[_nfeat];
-        }
+        /* Features of the dictionary are equal until one of them is modified,
+           so a single descriptor is stored regardless of the number of features */
+        _dict    = new Feature[1];
+        _compact = (_featuresEqual == DictionaryIface::notEqual);
         return services::Status();
     }
 
@@ -311,10 +313,42 @@ public:
         }
         else
         {
+            /* The returned feature can be modified, so the features are materialized.
+               Use the const accessor or getFeature() to read the features without it */
+            materialize();
             return _dict[idx];
         }
     }
 
+    /**
+     *  Returns a feature with a given index for reading
+     *  \param[in]  idx  Index of the feature
+     *  \return Requested feature
+     */
+    const Feature &operator[](const size_t idx) const
+    {
+        return (_featuresEqual == DictionaryIface::equal || _compact) ? _dict[0] : _dict[idx];
+    }
+
+    /**
+     *  Returns a feature with a given index for reading without materialization of the compact dictionary
+     *  \param[in]  idx  Index of the feature
+     *  \return Requested feature
+     */
+    const Feature &getFeature(const size_t idx) const
+    {
+        return (*this)[idx];
+    }
+
+    /**
+     *  Returns true if all features of the dictionary are equal and stored as a single descriptor
+     *  \return True if the dictionary is stored as a single descriptor
+     */
+    bool isCompact() const
+    {
+        return _featuresEqual == DictionaryIface::equal || _compact;
+    }
+
     /**
      *  \brief Adds a feature to a data dictionary
      *
@@ -333,6 +367,7 @@ public:
         }
         else
         {
+            materialize();
             _dict[idx] = feature;
         }
         return services::Status();
@@ -353,7 +388,7 @@ public:
     services::Status checkDictionary() const
     {
         size_t nFeat = _nfeat;
-        if (_featuresEqual == DictionaryIface::equal) nFeat = 1;
+        if (isCompact() && nFeat > 1) nFeat = 1;
 
         for (size_t i = 0; i < nFeat; ++i)
         {
@@ -399,6 +434,7 @@ private:
         arch->segmentHeader();
 
         arch->set( _nfeat );
+
         arch->set( _featuresEqual );
 
         if( onDeserialize )
@@ -406,12 +442,21 @@ private:
             size_t nfeat = _nfeat;
             _nfeat = 0;
             setNumberOfFeatures(nfeat);
+            materialize();
         }
 
-        if (_featuresEqual)
+        if (_featuresEqual == DictionaryIface::equal)
         {
             arch->setObj( _dict, 1 );
         }
+        else if (_compact)
+        {
+            /* Compact dictionary is stored in the format of the dictionary with different features */
+            for (size_t i = 0; i < _nfeat; i++)
+            {
+                arch->setObj( _dict, 1 );
+            }
+        }
         else
         {
             arch->setObj( _dict, _nfeat );
@@ -422,19 +467,36 @@ private:
         return services::Status();
     }
 
+    /** \private */
+    void materialize()
+    {
+        if (_compact)
+        {
+            Feature *dict = new Feature[_nfeat];
+            for (size_t i = 0; i < _nfeat; i++)
+            {
+                dict[i] = _dict[0];
+            }
+            delete[] _dict;
+            _dict    = dict;
+            _compact = false;
+        }
+    }
+
 protected:
     size_t        _nfeat;
     FeaturesEqual _featuresEqual;
     Feature      *_dict;
     services::SharedPtr<services::KernelErrorCollection> _errors;
+    bool          _compact;
 
     Dictionary( size_t nfeat, FeaturesEqual featuresEqual, services::Status &st ):
-        _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection())
+        _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection()), _compact(false)
     {
         if(nfeat) { st |= setNumberOfFeatures(nfeat); }
     }
 
-    Dictionary(services::Status &st): _nfeat(0), _dict(0), _featuresEqual(DictionaryIface::notEqual), _errors(new services::KernelErrorCollection()) {}
+    Dictionary(services::Status &st): _nfeat(0), _featuresEqual(DictionaryIface::notEqual), _dict(0), _errors(new services::KernelErrorCollection()), _compact(false) {}
 };
 typedef Dictionary<NumericTableFeature, SERIALIZATION_DATADICTIONARY_NT_ID> NumericTableDictionary;
 typedef services::SharedPtr<NumericTableDictionary> NumericTableDictionaryPtr;
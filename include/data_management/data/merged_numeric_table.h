@@ -117,7 +117,7 @@ public:
 
         for (size_t i = 0; i < cols; i++)
         {
-            NumericTableFeature &f = table->getDictionarySharedPtr()->operator[](i);
+            const NumericTableFeature &f = table->getDictionarySharedPtr()->getFeature(i);
             _ddict->setFeature(f, ncols + i);
         }
 
@@ -133,6 +133,43 @@ public:
         return s;
     }
 
+    /**
+     *  Returns the number of nested tables in the Merged Numeric Table
+     *  \return Number of nested tables
+     */
+    size_t getNumberOfTables() const
+    {
+        return _tables->size();
+    }
+
+    /**
+     *  Returns the nested table with a given index, so that the nested tables of the
+     *  Merged Numeric Table can be processed in place
+     *  \param[in] idx  Index of the nested table
+     *  \return Pointer to the nested table
+     */
+    NumericTablePtr getNumericTable(size_t idx) const
+    {
+        if (idx >= _tables->size())
+            return NumericTablePtr();
+        return services::staticPointerCast<NumericTable, SerializationIface>((*_tables)[idx]);
+    }
+
+    /**
+     *  Returns the index of the first column of the nested table in the Merged Numeric Table
+     *  \param[in] idx  Index of the nested table
+     *  \return Index of the first column of the nested table
+     */
+    size_t getColumnOffset(size_t idx) const
+    {
+        size_t cols = 0;
+        for (size_t k = 0; k < idx && k < _tables->size(); k++)
+        {
+            cols += ((NumericTable*)((*_tables)[k].get()))->getNumberOfColumns();
+        }
+        return cols;
+    }
+
     //the descriptions of the methods below are inherited from the base class
     services::Status resize(size_t nrow) DAAL_C11_OVERRIDE
     {
@@ -304,6 +341,23 @@ private:
         }
     }
 
+    /* Finds the nested table that contains the column and the index of the column in it */
+    NumericTable *findTableOfColumn(size_t featIdx, size_t &tableFeatIdx) const
+    {
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable* nt = (NumericTable*)((*_tables)[k].get());
+            size_t lcols = nt->getNumberOfColumns();
+            if (featIdx < lcols)
+            {
+                tableFeatIdx = featIdx;
+                return nt;
+            }
+            featIdx -= lcols;
+        }
+        return NULL;
+    }
+
 protected:
 
     template <typename T>
@@ -322,6 +376,13 @@ protected:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
+        if (_tables->size() == 1)
+        {
+            /* The block consists of the rows of the only nested table, so it is returned without copying */
+            NumericTable* nt = (NumericTable*)(_tables->operator[](0).get());
+            return nt->getBlockOfRows(idx, nrows, (ReadWriteMode)rwFlag, block);
+        }
+
         if( !block.resizeBuffer( ncols, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -350,6 +411,12 @@ protected:
     services::Status releaseTBlock(BlockDescriptor<T>& block)
     {
         services::Status s;
+        if (_tables->size() == 1 && block.getRowsOffset() < getNumberOfRows())
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](0).get());
+            return nt->releaseBlockOfRows(block);
+        }
+
         if(block.getRWFlag() & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
@@ -378,81 +445,38 @@ protected:
     template <typename T>
     services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block)
     {
-        services::Status s;
-        size_t ncols = getNumberOfColumns();
         size_t nobs = getNumberOfRows();
         block.setDetails( feat_idx, idx, rwFlag );
 
-        if (idx >= nobs)
+        size_t tableFeatIdx = 0;
+        NumericTable* nt = findTableOfColumn(feat_idx, tableFeatIdx);
+        if (idx >= nobs || !nt)
         {
             block.resizeBuffer( 1, 0 );
             return services::Status();
         }
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
-        if( !block.resizeBuffer( 1, nrows ) )
-            return services::Status(services::ErrorMemoryAllocationFailed);
-
-        if( rwFlag & (int)readOnly )
-        {
-            T* buffer = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
-                size_t lcols = nt->getNumberOfColumns();
 
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    s |= nt->getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, innerBlock);
-                    T* location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        buffer[i] = location[i];
-                    }
-                    s |= nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
-        }
+        /* Each column belongs to one nested table, so its block is returned without copying */
+        services::Status s = nt->getBlockOfColumnValues(tableFeatIdx, idx, nrows, (ReadWriteMode)rwFlag, block);
+        block.setDetails( feat_idx, idx, rwFlag );
         return s;
     }
 
     template <typename T>
     services::Status releaseTFeature( BlockDescriptor<T>& block )
     {
-        services::Status s;
-        if (block.getRWFlag() & (int)writeOnly)
+        size_t tableFeatIdx = 0;
+        NumericTable* nt = findTableOfColumn(block.getColumnsOffset(), tableFeatIdx);
+        if (block.getRowsOffset() >= getNumberOfRows() || !nt)
         {
-            size_t feat_idx = block.getColumnsOffset();
-            size_t idx = block.getRowsOffset();
-            size_t nrows = block.getNumberOfRows();
-            T* buffer = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
-                size_t lcols = nt->getNumberOfColumns();
-
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    s |= nt->getBlockOfColumnValues(feat_idx, idx, nrows, writeOnly, innerBlock);
-                    T* location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        location[i] = buffer[i];
-                    }
-                    s |= nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
+            block.reset();
+            return services::Status();
         }
-        block.reset();
-        return s;
+
+        block.setDetails( tableFeatIdx, block.getRowsOffset(), (int)block.getRWFlag() );
+        return nt->releaseBlockOfColumnValues(block);
     }
 
     services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE;
@@ -691,7 +691,7 @@ public:
     {
         if ( _ddict.get() != NULL && _ddict->getNumberOfFeatures() > feature_idx )
         {
-            const NumericTableFeature &f = (*_ddict)[feature_idx];
+            const NumericTableFeature &f = _ddict->getFeature(feature_idx);
             return f.featureType;
         }
         else
@@ -706,7 +706,7 @@ public:
         if ( _ddict.get() != NULL && _ddict->getNumberOfFeatures() > feature_idx &&
              getFeatureType(feature_idx) != features::DAAL_CONTINUOUS )
         {
-            const NumericTableFeature &f = (*_ddict)[feature_idx];
+            const NumericTableFeature &f = _ddict->getFeature(feature_idx);
             return f.categoryNumber;
         }
         else
@@ -107,14 +107,14 @@ public:
                 return s;
             if (featuresEqual == DictionaryIface::equal)
             {
-                NumericTableFeature &f = table->getDictionarySharedPtr()->operator[](0);
+                const NumericTableFeature &f = table->getDictionarySharedPtr()->getFeature(0);
                 _ddict->setFeature(f, 0);
             }
             else
             {
                 for (size_t i = 0; i < cols; i++)
                 {
-                    NumericTableFeature &f = table->getDictionarySharedPtr()->operator[](i);
+                    const NumericTableFeature &f = table->getDictionarySharedPtr()->getFeature(i);
                     _ddict->setFeature(f, i);
                 }
             }
@@ -124,6 +124,43 @@ public:
         return setNumberOfRowsImpl(_obsnum + obs);
     }
 
+    /**
+     *  Returns the number of nested tables in the Row Merged Numeric Table
+     *  \return Number of nested tables
+     */
+    size_t getNumberOfTables() const
+    {
+        return _tables->size();
+    }
+
+    /**
+     *  Returns the nested table with a given index, so that the partitions of the
+     *  Row Merged Numeric Table can be processed in place
+     *  \param[in] idx  Index of the nested table
+     *  \return Pointer to the nested table
+     */
+    NumericTablePtr getNumericTable(size_t idx) const
+    {
+        if (idx >= _tables->size())
+            return NumericTablePtr();
+        return services::staticPointerCast<NumericTable, SerializationIface>((*_tables)[idx]);
+    }
+
+    /**
+     *  Returns the index of the first row of the nested table in the Row Merged Numeric Table
+     *  \param[in] idx  Index of the nested table
+     *  \return Index of the first row of the nested table
+     */
+    size_t getRowOffset(size_t idx) const
+    {
+        size_t rows = 0;
+        for (size_t k = 0; k < idx && k < _tables->size(); k++)
+        {
+            rows += ((NumericTable*)((*_tables)[k].get()))->getNumberOfRows();
+        }
+        return rows;
+    }
+
     services::Status resize(size_t nrows) DAAL_C11_OVERRIDE
     {
         return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
@@ -247,6 +284,24 @@ private:
         }
     }
 
+    /* Finds the nested table that contains rows [idx, idx + nrows) entirely */
+    bool findTableOfRows(size_t idx, size_t nrows, size_t &tableIdx, size_t &tableRowOffset) const
+    {
+        size_t rows = 0;
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            size_t lrows = ((NumericTable*)((*_tables)[k].get()))->getNumberOfRows();
+            if (idx < rows + lrows)
+            {
+                tableIdx = k;
+                tableRowOffset = rows;
+                return (idx + nrows <= rows + lrows);
+            }
+            rows += lrows;
+        }
+        return false;
+    }
+
 protected:
     template <typename T>
     services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block)
@@ -264,6 +319,16 @@ protected:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
+        size_t tableIdx, tableRowOffset;
+        if (findTableOfRows(idx, nrows, tableIdx, tableRowOffset))
+        {
+            /* The rows belong to one nested table, so its block is returned without copying */
+            NumericTable* nt = (NumericTable*)(_tables->operator[](tableIdx).get());
+            s = nt->getBlockOfRows(idx - tableRowOffset, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails( 0, idx, rwFlag );
+            return s;
+        }
+
         if( !block.resizeBuffer( ncols, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -297,6 +362,14 @@ protected:
     services::Status releaseTBlock(BlockDescriptor<T>& block)
     {
         services::Status s;
+        size_t tableIdx, tableRowOffset;
+        if (findTableOfRows(block.getRowsOffset(), block.getNumberOfRows(), tableIdx, tableRowOffset))
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](tableIdx).get());
+            block.setDetails( 0, block.getRowsOffset() - tableRowOffset, (int)block.getRWFlag() );
+            return nt->releaseBlockOfRows(block);
+        }
+
         if(block.getRWFlag() & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
@@ -342,6 +415,17 @@ protected:
         }
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        size_t tableIdx, tableRowOffset;
+        if (findTableOfRows(idx, nrows, tableIdx, tableRowOffset))
+        {
+            /* The values belong to one nested table, so its block is returned without copying */
+            NumericTable* nt = (NumericTable*)(_tables->operator[](tableIdx).get());
+            s = nt->getBlockOfColumnValues(feat_idx, idx - tableRowOffset, nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails( feat_idx, idx, rwFlag );
+            return s;
+        }
+
         if( !block.resizeBuffer( 1, nrows ) )
             return services::Status(services::ErrorMemoryAllocationFailed);
 
@@ -364,7 +448,7 @@ protected:
                     T* location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        buffer[i] = location[i - idxBegin];
+                        buffer[i - idx] = location[i - idxBegin];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
@@ -379,6 +463,14 @@ protected:
     services::Status releaseTFeature( BlockDescriptor<T>& block )
     {
         services::Status s;
+        size_t tableIdx, tableRowOffset;
+        if (findTableOfRows(block.getRowsOffset(), block.getNumberOfRows(), tableIdx, tableRowOffset))
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](tableIdx).get());
+            block.setDetails( block.getColumnsOffset(), block.getRowsOffset() - tableRowOffset, (int)block.getRWFlag() );
+            return nt->releaseBlockOfColumnValues(block);
+        }
+
         if (block.getRWFlag() & (int)writeOnly)
         {
             size_t feat_idx = block.getColumnsOffset();
@@ -401,7 +493,7 @@ protected:
                     T* location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        location[i - idxBegin] = buffer[i];
+                        location[i - idxBegin] = buffer[i - idx];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
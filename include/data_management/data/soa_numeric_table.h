@@ -344,7 +344,7 @@ protected:
 
         for(size_t i = 0; i < ncol; i++)
         {
-            NumericTableFeature f = (*_ddict)[i];
+            const NumericTableFeature &f = _ddict->getFeature(i);
             if( f.typeSize != 0 )
             {
                 _arrays[i] = services::SharedPtr<byte>((byte *)daal::services::daal_malloc( f.typeSize * nrows ), services::ServiceDeleter());
@@ -394,7 +394,7 @@ protected:
 
         for(size_t i = 0; i < ncol; i++)
         {
-            NumericTableFeature f = (*_ddict)[i];
+            const NumericTableFeature &f = _ddict->getFeature(i);
             void *ptr = getArraySharedPtr(i).get();
 
             arch->set( (char *)ptr, nrows * f.typeSize );
@@ -439,7 +439,7 @@ private:
 
             for( size_t j = 0 ; j < ncols ; j++ )
             {
-                NumericTableFeature &f = (*_ddict)[j];
+                const NumericTableFeature &f = _ddict->getFeature(j);
 
                 char *ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
 
@@ -475,7 +475,7 @@ private:
 
                 for( size_t j = 0 ; j < ncols ; j++ )
                 {
-                    NumericTableFeature &f = (*_ddict)[j];
+                    const NumericTableFeature &f = _ddict->getFeature(j);
 
                     char *ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
 
@@ -508,7 +508,7 @@ private:
 
         nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
 
-        NumericTableFeature &f = (*_ddict)[feat_idx];
+        const NumericTableFeature &f = _ddict->getFeature(feat_idx);
 
         if( features::internal::getIndexNumType<T>() == f.indexType )
         {
@@ -538,7 +538,7 @@ private:
         {
             size_t feat_idx = block.getColumnsOffset();
 
-            NumericTableFeature &f = (*_ddict)[feat_idx];
+            const NumericTableFeature &f = _ddict->getFeature(feat_idx);
 
             if( features::internal::getIndexNumType<T>() != f.indexType )
             {
@@ -63,7 +63,7 @@ public:
 
         for(size_t i = 0; i < nFeatures; i++)
         {
-            DataSourceFeature &feature = (*dict)[i];
+            DataSourceFeature feature;
 
             feature.setFeatureName(kS(featureNames)[i]);
 
@@ -93,6 +93,7 @@ public:
                     _errors->add(services::ErrorKDBTypeUnsupported);
                     break;
             }
+            dict->setFeature(feature, i);
         }
     }
 
@@ -110,7 +111,7 @@ public:
 
         for(size_t i = 0; i < nFeatures; i++)
         {
-            DataSourceFeature &feature = (*dict)[i];
+            DataSourceFeature feature;
 
             I curType;
 
@@ -142,6 +143,7 @@ public:
                     _errors->add(services::ErrorKDBTypeUnsupported);
                     break;
             }
+            dict->setFeature(feature, i);
         }
     }
 
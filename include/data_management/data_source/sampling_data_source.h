@@ -0,0 +1,405 @@
+/* file: sampling_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that samples rows of another data source.
+//--
+*/
+
+#ifndef __SAMPLING_DATA_SOURCE_H__
+#define __SAMPLING_DATA_SOURCE_H__
+
+#include "services/daal_memory.h"
+#include "services/collection.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/engines/mt19937/mt19937.h"
+#include "algorithms/distributions/uniform/uniform.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ * <a name="DAAL-ENUM-DATA_MANAGEMENT__SAMPLINGMETHOD"></a>
+ * \brief Methods of selection of rows in the sampling data source
+ */
+enum SamplingMethod
+{
+    reservoirSampling  = 0, /*!< Uniform sample of the fixed size selected with the reservoir algorithm */
+    bernoulliSampling  = 1, /*!< Each row is selected independently with the given probability */
+    stratifiedSampling = 2  /*!< Reservoir sample of the fixed size for each value of the class label */
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SAMPLINGPARAMETER"></a>
+ *  \brief Parameters of the sampling data source
+ */
+class SamplingParameter
+{
+public:
+    /**
+     *  Constructs parameters of the sampling data source
+     *  \param[in] method_       Method of selection of rows
+     *  \param[in] sampleSize_   Number of rows in the sample for reservoir sampling or per class for stratified sampling
+     *  \param[in] probability_  Probability to select a row for Bernoulli sampling
+     */
+    SamplingParameter(SamplingMethod method_ = reservoirSampling, size_t sampleSize_ = 1000, double probability_ = 0.1) :
+        method(method_), sampleSize(sampleSize_), probability(probability_), labelIndex((size_t)-1), blockSize(4096),
+        engine(algorithms::engines::mt19937::Batch<>::create()) {}
+
+    SamplingMethod method;                   /*!< Method of selection of rows */
+    size_t sampleSize;                       /*!< Number of rows in the sample for reservoir sampling or per class for stratified sampling */
+    double probability;                      /*!< Probability to select a row for Bernoulli sampling */
+    size_t labelIndex;                       /*!< Index of the column with class labels for stratified sampling.
+                                                  The last column is used by default */
+    size_t blockSize;                        /*!< Number of rows read from the sampled data source at a time */
+    algorithms::engines::EnginePtr engine;   /*!< Engine used to draw random numbers */
+
+    /**
+     * Checks the correctness of the parameters
+     * \return Status of the check
+     */
+    services::Status check() const
+    {
+        DAAL_CHECK_EX(method == reservoirSampling || method == bernoulliSampling || method == stratifiedSampling,
+            services::ErrorIncorrectParameter, services::ParameterName, "method");
+        DAAL_CHECK_EX(method == bernoulliSampling || sampleSize > 0, services::ErrorIncorrectParameter, services::ParameterName, "sampleSize");
+        DAAL_CHECK_EX(method != bernoulliSampling || (probability >= 0 && probability <= 1), services::ErrorIncorrectParameter,
+            services::ParameterName, "probability");
+        DAAL_CHECK_EX(blockSize > 0, services::ErrorIncorrectParameter, services::ParameterName, "blockSize");
+        DAAL_CHECK_EX(engine.get(), services::ErrorIncorrectParameter, services::ParameterName, "engine");
+        return services::Status();
+    }
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SAMPLINGDATASOURCE"></a>
+ *  \brief Data source that selects a random sample of rows while streaming through another data source.
+ *         Only the rows of the sample are stored, so the memory is proportional to the size of the sample.
+ *         Random numbers are drawn with the engine from the parameters, so the sample is reproducible
+ *         for the same state of the engine.
+ */
+class SamplingDataSource : public DataSource
+{
+public:
+    /**
+     *  Constructs a data source that samples rows of another data source
+     *  \param[in] source                  Data source to sample rows from
+     *  \param[in] parameter               Parameters of the sampling
+     *  \param[in] doAllocateNumericTable  Flag that specifies whether a Numeric Table with the sample
+     *                                     is allocated inside the Data Source
+     */
+    SamplingDataSource(DataSource &source, const SamplingParameter &parameter = SamplingParameter(),
+                       NumericTableAllocationFlag doAllocateNumericTable = DataSource::notAllocateNumericTable) :
+        DataSource(), _source(&source), _par(parameter), _nColumns(0), _nSeenRows(0), _endOfData(false)
+    {
+        DataSource::_autoNumericTableFlag = doAllocateNumericTable;
+        DataSource::_autoDictionaryFlag   = DataSource::doDictionaryFromContext;
+    }
+
+    virtual ~SamplingDataSource() {}
+
+    using DataSource::loadDataBlock;
+
+    /**
+     *  Returns the parameters of the sampling
+     *  \return Parameters of the sampling
+     */
+    const SamplingParameter &getParameter() const { return _par; }
+
+    /**
+     *  Returns the number of rows of the sampled data source processed so far
+     *  \return Number of processed rows
+     */
+    size_t getNumberOfProcessedRows() const { return _nSeenRows; }
+
+    /**
+     *  Discards the current sample, so that the sampling starts from the current position of the sampled data source
+     */
+    void resetSample()
+    {
+        _strata.clear();
+        _nSeenRows = 0;
+        _endOfData = false;
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        _dict = _source->getDictionarySharedPtr();
+        if (!_dict)
+            return services::throwIfPossible(services::Status(services::ErrorDictionaryNotAvailable));
+        return services::Status();
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        return _endOfData ? DataSourceIface::endOfData : _source->getStatus();
+    }
+
+    size_t getNumericTableNumberOfColumns() DAAL_C11_OVERRIDE
+    {
+        return _source->getNumericTableNumberOfColumns();
+    }
+
+    /**
+     *  Returns the number of rows in the current sample
+     *  \return Number of rows in the sample
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        size_t nRows = 0;
+        for (size_t i = 0; i < _strata.size(); i++)
+        {
+            nRows += _strata[i]->nRows;
+        }
+        return nRows;
+    }
+
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE
+    {
+        if (_spnt)
+            return services::throwIfPossible(services::Status(services::ErrorNumericTableAlreadyAllocated));
+
+        services::Status s = checkDictionary();
+        if (!s)
+            return s;
+
+        _spnt = HomogenNumericTable<DAAL_DATA_TYPE>::create(getNumericTableNumberOfColumns(), 0, NumericTableIface::doNotAllocate, &s);
+        return s;
+    }
+
+    void freeNumericTable() DAAL_C11_OVERRIDE
+    {
+        _spnt = NumericTablePtr();
+    }
+
+    /**
+     *  Reads at most maxRows rows from the sampled data source, updates the sample with them
+     *  and writes the current sample into the provided Numeric Table
+     *  \param[in] maxRows Maximum number of rows to read from the sampled data source
+     *  \param[in] nt      Pointer to the Numeric Table
+     *  \return Number of rows in the sample
+     */
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = streamRows(maxRows);
+        if (s)
+            s = writeSample(nt);
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return nt->getNumberOfRows();
+    }
+
+    /**
+     *  Reads all rows of the sampled data source, selects the sample from them
+     *  and writes the sample into the provided Numeric Table
+     *  \param[in] nt      Pointer to the Numeric Table
+     *  \return Number of rows in the sample
+     */
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        return loadDataBlock((size_t)-1, nt);
+    }
+
+protected:
+    /* Rows selected for one stratum of the sample */
+    struct Stratum
+    {
+        Stratum(DAAL_DATA_TYPE label_) : label(label_), nRows(0), nSeenRows(0) {}
+
+        DAAL_DATA_TYPE label;                   /* Value of the class label for stratified sampling */
+        size_t nRows;                           /* Number of rows in the sample */
+        size_t nSeenRows;                       /* Number of rows of the stratum read from the sampled data source */
+        services::Collection<DAAL_DATA_TYPE> data;
+    };
+    typedef services::SharedPtr<Stratum> StratumPtr;
+
+    services::Status initialize()
+    {
+        services::Status s = checkDictionary();
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_STATUS(s, _par.check());
+
+        const size_t nColumns = getNumericTableNumberOfColumns();
+        DAAL_CHECK(nColumns > 0, services::ErrorIncorrectNumberOfFeatures);
+        DAAL_CHECK_EX(_par.method != stratifiedSampling || _par.labelIndex == (size_t)-1 || _par.labelIndex < nColumns,
+            services::ErrorIncorrectParameter, services::ParameterName, "labelIndex");
+
+        if (_block && _nColumns == nColumns)
+            return s;
+
+        _nColumns = nColumns;
+        _block = HomogenNumericTable<DAAL_DATA_TYPE>::create(_nColumns, 0, NumericTableIface::doNotAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _uniformNumbers = HomogenNumericTable<double>::create(1, _par.blockSize, NumericTableIface::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _uniform.input.set(algorithms::distributions::tableToFill, _uniformNumbers);
+        return s;
+    }
+
+    services::Status streamRows(size_t maxRows)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, initialize());
+
+        _uniform.parameter.engine = _par.engine;
+        const size_t labelIndex = (_par.labelIndex == (size_t)-1 ? _nColumns - 1 : _par.labelIndex);
+
+        size_t nRead = 0;
+        while (!_endOfData && nRead < maxRows)
+        {
+            const size_t nToRead = (maxRows - nRead < _par.blockSize ? maxRows - nRead : _par.blockSize);
+            const size_t nRows = _source->loadDataBlock(nToRead, _block.get());
+            DAAL_CHECK_STATUS(s, _source->status());
+            if (nRows < nToRead || _source->getStatus() == DataSourceIface::endOfData)
+                _endOfData = true;
+            if (!nRows)
+                break;
+
+            DAAL_CHECK_STATUS(s, _uniformNumbers->resize(nRows));
+            DAAL_CHECK_STATUS(s, _uniform.computeNoThrow());
+
+            BlockDescriptor<DAAL_DATA_TYPE> rowsBlock;
+            BlockDescriptor<double> uniformBlock;
+            DAAL_CHECK_STATUS(s, _block->getBlockOfRows(0, nRows, readOnly, rowsBlock));
+            DAAL_CHECK_STATUS(s, _uniformNumbers->getBlockOfRows(0, nRows, readOnly, uniformBlock));
+            const DAAL_DATA_TYPE *rows = rowsBlock.getBlockPtr();
+            const double *u = uniformBlock.getBlockPtr();
+
+            for (size_t i = 0; s && i < nRows; i++)
+            {
+                const DAAL_DATA_TYPE *row = rows + i * _nColumns;
+                if (_par.method == bernoulliSampling)
+                {
+                    if (u[i] < _par.probability)
+                        s |= appendRow(getStratum(0), row);
+                }
+                else
+                {
+                    s |= addToReservoir(getStratum(_par.method == stratifiedSampling ? row[labelIndex] : 0), row, u[i]);
+                }
+            }
+
+            _uniformNumbers->releaseBlockOfRows(uniformBlock);
+            _block->releaseBlockOfRows(rowsBlock);
+            DAAL_CHECK_STATUS_VAR(s);
+
+            nRead += nRows;
+            _nSeenRows += nRows;
+        }
+        return s;
+    }
+
+    Stratum &getStratum(DAAL_DATA_TYPE label)
+    {
+        for (size_t i = 0; i < _strata.size(); i++)
+        {
+            if (_strata[i]->label == label)
+                return *_strata[i];
+        }
+        _strata.push_back(StratumPtr(new Stratum(label)));
+        return *_strata[_strata.size() - 1];
+    }
+
+    services::Status appendRow(Stratum &stratum, const DAAL_DATA_TYPE *row)
+    {
+        for (size_t j = 0; j < _nColumns; j++)
+        {
+            DAAL_CHECK(stratum.data.safe_push_back(row[j]), services::ErrorMemoryAllocationFailed);
+        }
+        stratum.nRows++;
+        stratum.nSeenRows++;
+        return services::Status();
+    }
+
+    /* Algorithm R: the t-th row of the stratum replaces a random row of the sample with the probability sampleSize/t */
+    services::Status addToReservoir(Stratum &stratum, const DAAL_DATA_TYPE *row, double u)
+    {
+        if (stratum.nRows < _par.sampleSize)
+            return appendRow(stratum, row);
+
+        stratum.nSeenRows++;
+        const size_t idx = (size_t)(u * (double)stratum.nSeenRows);
+        if (idx < _par.sampleSize)
+        {
+            DAAL_DATA_TYPE *dst = stratum.data.data() + idx * _nColumns;
+            for (size_t j = 0; j < _nColumns; j++)
+            {
+                dst[j] = row[j];
+            }
+        }
+        return services::Status();
+    }
+
+    services::Status writeSample(NumericTable *nt)
+    {
+        DAAL_CHECK(nt, services::ErrorNullInputNumericTable);
+        DAAL_CHECK(nt->getNumberOfColumns() == _nColumns, services::ErrorIncorrectNumberOfFeatures);
+
+        services::Status s;
+        const size_t nRows = getNumberOfAvailableRows();
+        DAAL_CHECK_STATUS(s, nt->resize(nRows));
+        if (!nRows)
+            return s;
+
+        BlockDescriptor<DAAL_DATA_TYPE> block;
+        DAAL_CHECK_STATUS(s, nt->getBlockOfRows(0, nRows, writeOnly, block));
+        DAAL_DATA_TYPE *dst = block.getBlockPtr();
+        for (size_t i = 0; i < _strata.size(); i++)
+        {
+            const size_t size = _strata[i]->nRows * _nColumns * sizeof(DAAL_DATA_TYPE);
+            services::daal_memcpy_s(dst, size, _strata[i]->data.data(), size);
+            dst += _strata[i]->nRows * _nColumns;
+        }
+        return nt->releaseBlockOfRows(block);
+    }
+
+protected:
+    DataSource *_source;
+    SamplingParameter _par;
+    size_t _nColumns;
+    size_t _nSeenRows;
+    bool _endOfData;
+    services::Collection<StratumPtr> _strata;
+    NumericTablePtr _block;
+    NumericTablePtr _uniformNumbers;
+    algorithms::distributions::uniform::Batch<double> _uniform;
+};
+/** @} */
+} // namespace interface1
+using interface1::SamplingMethod;
+using interface1::reservoirSampling;
+using interface1::bernoulliSampling;
+using interface1::stratifiedSampling;
+using interface1::SamplingParameter;
+using interface1::SamplingDataSource;
+
+} // namespace data_management
+} // namespace daal
+#endif
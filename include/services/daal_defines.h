@@ -413,6 +413,10 @@ const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID
 
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID                                            = 106000;
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID                                  = 106010;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID                                = 106020;
+const int SERIALIZATION_HNSW_KNN_MODEL_ID                                                      = 106100;
+const int SERIALIZATION_HNSW_KNN_TRAINING_RESULT_ID                                            = 106110;
+const int SERIALIZATION_HNSW_KNN_PREDICTION_RESULT_ID                                          = 106120;
 
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_MODEL_ID                                = 107000;
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_TRAINING_RESULT_ID                      = 107010;
@@ -427,6 +431,9 @@ const int SERIALIZATION_GBT_REGRESSION_MODEL_ID
 const int SERIALIZATION_GBT_REGRESSION_TRAINING_RESULT_ID                                      = 107140;
 const int SERIALIZATION_GBT_REGRESSION_PREDICTION_RESULT_ID                                    = 107150;
 const int SERIALIZATION_GBT_DECISION_TREE_ID                                                   = 107160;
+const int SERIALIZATION_GBT_REGRESSION_TRAINING_DISTRIBUTED_STEP1_PARTIAL_RESULT_ID            = 107170;
+const int SERIALIZATION_GBT_REGRESSION_TRAINING_DISTRIBUTED_STEP2_PARTIAL_RESULT_ID            = 107180;
+const int SERIALIZATION_TREE_UTILS_BINNED_FEATURES_ID                                          = 107190;
 
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_MODEL_ID                                  = 108000;
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_TRAINING_RESULT_ID                        = 108010;
@@ -0,0 +1,264 @@
+/* file: gbt_regression_dense_distributed_mpi.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ sample of gradient boosted trees regression in the distributed
+!    processing mode.
+!
+!    The program trains the gradient boosted trees regression model on a
+!    training data set distributed across the nodes and computes regression
+!    for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-SAMPLE-CPP-GBT_REGRESSION_DENSE_DISTRIBUTED"></a>
+ * \example gbt_regression_dense_distributed_mpi.cpp
+ */
+
+#include <mpi.h>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+typedef std::vector<byte> ByteBuffer;
+typedef float algorithmFPType;     /* Algorithm floating-point type */
+
+const string trainDatasetFileNames[] =
+{
+    "./data/distributed/linear_regression_train_1.csv",
+    "./data/distributed/linear_regression_train_2.csv",
+    "./data/distributed/linear_regression_train_3.csv",
+    "./data/distributed/linear_regression_train_4.csv"
+};
+string testDatasetFileName = "./data/distributed/linear_regression_test.csv";
+
+const size_t nBlocks       = 4;
+const size_t nFeatures     = 10;  /* Number of features in training and testing data sets */
+const size_t nResponses    = 2;   /* Number of responses in the data files, the first one is used */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 20;
+
+int rankId, comm_size;
+#define mpi_root 0
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr& trainingResult);
+void loadData(const string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+void gatherPartialResults(training::Distributed<step1Local, algorithmFPType>& localAlgorithm,
+                          training::Distributed<step2Master, algorithmFPType>& masterAlgorithm);
+NumericTablePtr broadcastTable(const NumericTablePtr& table);
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rankId);
+
+    training::ResultPtr trainingResult = trainModel();
+
+    if(rankId == mpi_root)
+    {
+        testModel(trainingResult);
+    }
+
+    MPI_Finalize();
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    const bool isRoot = (rankId == mpi_root);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileNames[rankId], trainData, trainDependentVariable);
+
+    /* Create an algorithm object to compute the histograms on the local node */
+    training::Distributed<step1Local, algorithmFPType> localAlgorithm;
+    localAlgorithm.input.set(training::data, trainData);
+    localAlgorithm.input.set(training::dependentVariable, trainDependentVariable);
+    localAlgorithm.parameter.maxIterations = maxIterations;
+
+    /* Create an algorithm object to build the trees on the master node */
+    training::Distributed<step2Master, algorithmFPType> masterAlgorithm;
+    masterAlgorithm.parameter.maxIterations = maxIterations;
+
+    /* Compute the sketches of the bins of the features on local nodes and merge them on the master node */
+    localAlgorithm.compute();
+    gatherPartialResults(localAlgorithm, masterAlgorithm);
+    if(isRoot)
+    {
+        masterAlgorithm.compute();
+    }
+
+    /* The bins of the features do not change during the training */
+    NumericTablePtr binBorders = broadcastTable(isRoot ? masterAlgorithm.getPartialResult()->get(training::globalBinBorders) : NumericTablePtr());
+    localAlgorithm.input.set(training::binBorders, binBorders);
+
+    while(true)
+    {
+        int finished = isRoot ? (int)masterAlgorithm.getPartialResult()->isFinished() : 0;
+        MPI_Bcast(&finished, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+        if(finished)
+            break;
+
+        /* Compute the histograms of the open nodes of the current tree on local nodes */
+        NumericTablePtr tree = broadcastTable(isRoot ? masterAlgorithm.getPartialResult()->get(training::currentTree) : NumericTablePtr());
+        localAlgorithm.input.set(training::tree, tree);
+        localAlgorithm.compute();
+
+        /* Binned data stays on the local node between the iterations */
+        localAlgorithm.input.set(training::internalInput, localAlgorithm.getPartialResult()->get(training::internalResult));
+
+        /* Merge the histograms and choose the splits on the master node */
+        gatherPartialResults(localAlgorithm, masterAlgorithm);
+        if(isRoot)
+        {
+            masterAlgorithm.compute();
+        }
+    }
+
+    if(isRoot)
+    {
+        /* Build the gradient boosted trees regression model on the master node */
+        masterAlgorithm.finalizeCompute();
+        return masterAlgorithm.getResult();
+    }
+    return training::ResultPtr();
+}
+
+void gatherPartialResults(training::Distributed<step1Local, algorithmFPType>& localAlgorithm,
+                          training::Distributed<step2Master, algorithmFPType>& masterAlgorithm)
+{
+    const bool isRoot = (rankId == mpi_root);
+
+    /* Serialize partial results required by step 2 */
+    InputDataArchive dataArch;
+    localAlgorithm.getPartialResult()->serialize(dataArch);
+    const int perNodeArchLength = (int)dataArch.getSizeOfArchive();
+
+    /* Transfer archive lengths to the root node */
+    int aPerNodeArchLength[nBlocks];
+    MPI_Gather(&perNodeArchLength, 1, MPI_INT, aPerNodeArchLength, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+
+    ByteBuffer serializedData;
+    int displs[nBlocks];
+    if(isRoot)
+    {
+        int totalArchLength = 0;
+        for(size_t i = 0; i < nBlocks; ++i)
+        {
+            displs[i] = totalArchLength;
+            totalArchLength += aPerNodeArchLength[i];
+        }
+        serializedData.resize(totalArchLength);
+    }
+
+    ByteBuffer nodeResults(perNodeArchLength);
+    dataArch.copyArchiveToArray(&nodeResults[0], perNodeArchLength);
+
+    /* Transfer partial results to step 2 on the root node */
+    MPI_Gatherv(&nodeResults[0], perNodeArchLength, MPI_CHAR, serializedData.size() ? &serializedData[0] : NULL,
+        aPerNodeArchLength, displs, MPI_CHAR, mpi_root, MPI_COMM_WORLD);
+
+    if(isRoot)
+    {
+        for(size_t i = 0; i < nBlocks; ++i)
+        {
+            /* Deserialize partial results from step 1 */
+            OutputDataArchive dataArch(&serializedData[displs[i]], aPerNodeArchLength[i]);
+            training::DistributedStep1LocalPartialResultPtr dataForStep2FromStep1(new training::DistributedStep1LocalPartialResult());
+            dataForStep2FromStep1->deserialize(dataArch);
+
+            /* Set local partial results as input for the master-node algorithm */
+            masterAlgorithm.input.add(training::partialResults, dataForStep2FromStep1);
+        }
+    }
+}
+
+NumericTablePtr broadcastTable(const NumericTablePtr& table)
+{
+    const bool isRoot = (rankId == mpi_root);
+    InputDataArchive inputArch;
+    int archLength = 0;
+    if(isRoot)
+    {
+        table->serialize(inputArch);
+        archLength = (int)inputArch.getSizeOfArchive();
+    }
+    MPI_Bcast(&archLength, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+
+    ByteBuffer buffer(archLength);
+    if(isRoot)
+        inputArch.copyArchiveToArray(&buffer[0], archLength);
+    MPI_Bcast(&buffer[0], archLength, MPI_CHAR, mpi_root, MPI_COMM_WORLD);
+
+    if(isRoot)
+        return table;
+
+    /* Deserialize the table on local nodes */
+    OutputDataArchive outArch(&buffer[0], archLength);
+    NumericTablePtr result(new HomogenNumericTable<algorithmFPType>());
+    result->deserialize(outArch);
+    return result;
+}
+
+void testModel(const training::ResultPtr& trainingResult)
+{
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction),
+        "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void loadData(const string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data, the first response and the rest of responses */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr otherResponses(new HomogenNumericTable<>(nResponses - 1, 0, NumericTable::doNotAllocate));
+    MergedNumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+    mergedData->addNumericTable(otherResponses);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
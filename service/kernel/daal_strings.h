@@ -120,6 +120,7 @@
     DECLARE_DAAL_STRING_CONST(nTransactions                      ) \
     DECLARE_DAAL_STRING_CONST(maxBins                            ) \
     DECLARE_DAAL_STRING_CONST(minBinSize                         ) \
+    DECLARE_DAAL_STRING_CONST(maxLeaves                          ) \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize                     ) \
     DECLARE_DAAL_STRING_CONST(minItemsetSize                     ) \
     DECLARE_DAAL_STRING_CONST(largeItemsets                      ) \
@@ -371,7 +372,26 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments                  ) \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries            ) \
     DECLARE_DAAL_STRING_CONST(gramMatrix                         ) \
-    DECLARE_DAAL_STRING_CONST(lassoParameters                    )
+    DECLARE_DAAL_STRING_CONST(lassoParameters                    ) \
+    DECLARE_DAAL_STRING_CONST(binBorders                         ) \
+    DECLARE_DAAL_STRING_CONST(tree                               ) \
+    DECLARE_DAAL_STRING_CONST(binSketch                          ) \
+    DECLARE_DAAL_STRING_CONST(histograms                         ) \
+    DECLARE_DAAL_STRING_CONST(globalBinBorders                   ) \
+    DECLARE_DAAL_STRING_CONST(currentTree                        ) \
+    DECLARE_DAAL_STRING_CONST(validationData                     ) \
+    DECLARE_DAAL_STRING_CONST(validationDependentVariable        ) \
+    DECLARE_DAAL_STRING_CONST(validationLabels                   ) \
+    DECLARE_DAAL_STRING_CONST(inputModel                         ) \
+    DECLARE_DAAL_STRING_CONST(binnedFeatures                     ) \
+    DECLARE_DAAL_STRING_CONST(distances                          ) \
+    DECLARE_DAAL_STRING_CONST(maxNeighbors                       ) \
+    DECLARE_DAAL_STRING_CONST(efConstruction                     ) \
+    DECLARE_DAAL_STRING_CONST(efSearch                           ) \
+    DECLARE_DAAL_STRING_CONST(voteWeights                        ) \
+    DECLARE_DAAL_STRING_CONST(predictionMode                     ) \
+    DECLARE_DAAL_STRING_CONST(rebuildThreshold                   ) \
+    DECLARE_DAAL_STRING_CONST(engine                             )
 
 /**
  *  Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) namespace